@@ -0,0 +1,2477 @@
+/*
+ *  alad-utils.h: optional layers on top of the function tables of alad.h, for programs that call OpenAL a lot every frame.
+ *
+ *  Include it after alad.h, in exactly one source file with
+ *
+ *          #define ALAD_UTILS_IMPLEMENTATION
+ *          #include "alad-utils.h"
+ *
+ *  and without the define everywhere else. alad.h has to be loaded (aladLoadAL(); and aladUpdateAL(); with a current context) before any
+ *  of this is used.
+ *
+ *  Some of these layers wrap the AL table: enabling one copies the table aladAL points to at that time, points aladAL at its own table,
+ *  which calls through that copy, and disabling it points aladAL back. Layers enabled after each other therefore stack, and should be
+ *  disabled in reverse order. aladLoadAL(); and aladUpdateAL(); point aladAL at another table; the enabled layers then wrap that one
+ *  again by themselves (through aladSetUpdateCallback), in the order they were enabled. aladActivateContextFunctions(context) points it
+ *  elsewhere as well, but without telling anyone, so enable the layers again after it, in the same order as before. Enabling a layer that
+ *  is still enabled keeps what it has stored and only wraps the table aladAL points to now, unless aladAL still reaches the layer. A layer
+ *  belongs to the context that is current when it is enabled.
+ *
+ *  Shadow cache:
+ *
+ *          aladEnableShadow(maxSources);
+ *
+ *  keeps the source and listener parameters set through aladAL in memory, so that alGetSource* and alGetListener* are answered without
+ *  calling the driver. Only the sources generated with alGenSources after enabling it are cached, up to maxSources at once; the others,
+ *  and the parameters that the driver changes on its own (like the offsets), are still asked for. With AL_SOFT_events, the state and the
+ *  queued and processed buffer counts are cached too: the shadow registers an event callback, which marks a source's values as stale
+ *  when its state changes or a buffer of it completes, and the next getter asks the driver once. A value the driver rejects (outside of
+ *  the range the specification gives, or a fraction for AL_LOOPING and AL_SOURCE_RELATIVE) isn't cached, and the getter asks the driver
+ *  until the parameter is set to a valid value again. The cached sources are those of the context that was current when it was enabled;
+ *  while another one is current, everything goes to the driver, and when the shadow wraps a table with another context current, it starts
+ *  over with an empty cache (and without caching the state, since its events come from the first context). aladDisableShadow(); frees the
+ *  cache; the tables of layers enabled on top of it afterwards just call through.
+ *
+ *  Filter:
+ *
+ *          aladEnableFilter(maxSources, maxBuffers);
+ *
+ *  remembers the last value written to each parameter of a source, buffer or the listener through alSource*, alListener* and alBufferi,
+ *  and drops a write that sends the same value again before it reaches the driver (and takes its lock). Only parameters that nothing but
+ *  a setter changes are filtered, not offsets or AL_BUFFER, which do something even when repeated. It keeps track of maxSources sources
+ *  and maxBuffers buffers at once, and only those generated with alGenSources and alGenBuffers while it is enabled; the writes to others,
+ *  which may not even exist, are passed on. Like with the shadow, a value the driver rejects (outside of the range the specification
+ *  gives, or a fraction for an int parameter) isn't remembered, and the next write of the parameter goes through. aladGetFilterStatistics(reset) returns how many writes went
+ *  through the filter and how many of them were dropped, and resets both counts if reset is AL_TRUE. Its values are those of the context
+ *  that was current when it was enabled; writes while another context is current (such as the listeners of openal-explicit-polyfill.h)
+ *  are passed on and make it forget the parameter, and enabling it again on another context starts over. The filter isn't synchronized,
+ *  use it from one thread at a time. aladDisableFilter(); ends it.
+ *
+ *  Bulk transforms:
+ *
+ *          aladUpdateSources(n, sources, px, py, pz, dt);
+ *
+ *  sets the positions of n sources from three arrays of coordinates, as an engine that keeps its transforms as a structure of arrays
+ *  has them anyway, and their velocities from how far each one moved since the last call, dt seconds ago. The velocities are computed
+ *  for all sources at once with SSE, AVX or NEON, whichever the compiler targets, or else one by one. All of it is sent within
+ *  aladBeginFrame(NULL); and aladEndFrame, so the driver applies it together. The last positions are remembered per index, so the
+ *  sources should come in the same order every time; a source at an index that held another one last time, or that the last call didn't
+ *  reach, gets a velocity of 0. To update several groups of sources, give each its own aladSourceMotion from aladCreateSourceMotion(); and
+ *  use aladUpdateSourcesEx(motion, ...).
+ *  aladDestroySourceMotion(motion) frees one, with NULL it frees the memory of the default one. The updates return AL_FALSE if the memory for the
+ *  last positions can't be grown, then it only sets the positions.
+ *
+ *  Source pool:
+ *
+ *          aladSourcePool *pool = aladCreateSourcePool(count);
+ *
+ *  generates count sources at once (it clears the AL error state to see whether that worked, and returns NULL if not). After that,
+ *  aladAcquireSource(pool, NULL) hands one out and aladReleaseSource(pool, source) takes it back, from any thread and without calling
+ *  the driver or taking a lock; acquiring returns 0 if all of them are in use. Released sources aren't handed out again right away:
+ *  aladRecycleSources(pool), called with the pool's context current (once per frame, say), stops and rewinds all sources released since
+ *  the last time, detaches their buffers and resets their parameters to the defaults, all within one aladBeginFrame, and then makes them
+ *  available again. It returns how many it recycled. A thread that acquires many sources can keep an aladSourceCache, initialized to
+ *  {0}, and pass it instead of NULL; the cache then takes ALAD_SOURCE_CACHE_SIZE / 2 sources at a time from the pool (8 by default, define
+ *  it before including this header to change that), and aladFlushSourceCache(pool, cache) returns what is left in it. aladDestroySourcePool(pool)
+ *  deletes all of the sources, including the ones still in use.
+ *
+ *  Virtual voices:
+ *
+ *          aladVoiceManager *voices = aladCreateVoiceManager(maxVoices, maxSources);
+ *
+ *  keeps track of up to maxVoices playing sounds, but only generates maxSources sources, or as many as the driver gives out before it
+ *  runs out. aladPlayVoice(voices, buffer, looping) starts a voice (at the origin, with a gain of 1) and returns its handle, which is
+ *  given to aladSetVoiceGain, aladSetVoicePosition and aladStopVoice; aladIsVoicePlaying tells whether it has ended, and
+ *  aladGetVoiceSource returns its source, or 0 while it is virtual. Once per frame, aladUpdateVoices(voices, dt) scores every voice by
+ *  its gain times its distance attenuation from the listener (the inverse distance model with reference distance and rolloff factor 1),
+ *  all at once with SSE, AVX or NEON like aladUpdateSources, and gives the sources to the loudest ones. A voice that loses its source
+ *  remembers its sample offset, from AL_SAMPLE_OFFSET_LATENCY_SOFT if the driver has AL_SOFT_source_latency, advances it by dt while it
+ *  is virtual, and continues from there when it gets a source again. All of it happens within one aladBeginFrame. Other parameters, like
+ *  the pitch, aren't tracked; set them on aladGetVoiceSource(voices, voice) again whenever the voice gets a new source.
+ *
+ *  Streams:
+ *
+ *          aladStream *stream = aladCreateStream(source, format, frequency, ringBytes);
+ *
+ *  plays PCM from a ring of ringBytes (rounded up to a power of two) on source. One thread writes into it, either by copying with
+ *  aladWriteStream(stream, data, bytes), which returns how much fit, or without a copy by decoding straight into the space that
+ *  aladBeginStreamWrite(stream, &bytes) returns and then committing what it wrote with aladEndStreamWrite(stream, bytes). With
+ *  AL_SOFT_callback_buffer, the source plays a callback buffer whose callback takes the data out of the ring on the mixer thread, so there
+ *  is nothing to queue or poll; if the ring runs dry, it plays silence and counts an underrun. Without it, aladUpdateStream(stream) has
+ *  to be called regularly with the source's context current: it unqueues the processed ones of two buffers, refills them with half a ring
+ *  each, and restarts the source if it ran dry (which counts as an underrun too). aladPlayStream(stream) starts playing, ideally after
+ *  filling the ring, and aladStopStream(stream) stops; aladEndStream(stream) marks the end of the data, after which the source stops once
+ *  the ring is empty. aladGetStreamStatistics(stream) returns the underrun counts. aladDestroyStream(stream) stops the source and deletes
+ *  the buffers. Only the 8 and 16 bit and float mono and stereo formats can be streamed, aladCreateStream returns NULL for others.
+ *
+ *  Event queue:
+ *
+ *          aladEnableEventQueue(capacity);
+ *
+ *  needs AL_SOFT_events, and returns AL_FALSE without it. It registers a callback for the buffer completed, source state changed and
+ *  disconnected events of the current context (the same one the shadow uses, so both can be enabled), which turns every event into an
+ *  aladEvent and puts it into a queue of capacity records (rounded up to a power of two), without locking or allocating on the event
+ *  thread. Instead of polling every source, a thread calls aladWaitEvents(milliseconds), which returns AL_TRUE as soon as there are
+ *  events (with a negative timeout, it waits as long as it takes), and then takes them out with aladPollEvents(events, max), which returns
+ *  how many it copied. Only one thread at a time may take events. To wait for other things at the same time, aladGetEventHandle()
+ *  returns a file descriptor to poll for reading (an eventfd on Linux, a pipe elsewhere) or, on Windows, an event handle to wait for; after
+ *  it wakes up, call aladWaitEvents(0) to reset it. Events that arrive while the queue is full are dropped and counted, which
+ *  aladGetDroppedEvents(reset) returns. aladDisableEventQueue(); unregisters the callback and frees the queue.
+ *
+ *  Scheduler:
+ *
+ *          aladScheduler *scheduler = aladCreateScheduler(device, capacity);
+ *
+ *  starts and stops sources at given times, in nanoseconds of the device clock (ALC_DEVICE_CLOCK_SOFT), which
+ *  aladGetSchedulerTime(scheduler) returns. aladSchedulePlay(scheduler, source, time) and aladScheduleStop(scheduler, source, time) add
+ *  an event (the heap starts with room for capacity of them and grows as needed, they return AL_FALSE if it can't), and
+ *  aladCancelScheduled(scheduler, source) removes all of a source's events and returns how many there were. aladUpdateScheduler(scheduler,
+ *  window), called regularly with the device's context current, sends everything due before now + window in one aladBeginFrame: with
+ *  AL_SOFT_source_start_delay, the starts are sample-accurate, with one alSourcePlayAtTimevSOFT for all sources that start at the same
+ *  time, so the window only has to be longer than the time between two updates. Stops can't be timed by the driver, so they are sent
+ *  with alSourceStopv on the first update at or after their time, and a source's starts after a stop that isn't due yet wait for it.
+ *  Without the extension or ALC_SOFT_device_clock, starts are emulated like stops, with one alSourcePlayv per update, and the times come
+ *  from the monotonic clock of the system instead. If <time.h> doesn't define CLOCK_MONOTONIC (as with -std=c99 and no feature macro,
+ *  such as _POSIX_C_SOURCE=199309L, defined before any system header), that is gettimeofday, which jumps when the wall clock is set; where
+ *  there is neither, aladCreateScheduler returns NULL rather than emulate the starts on a clock of whole seconds. aladUpdateScheduler
+ *  returns how many events it sent, and aladDestroyScheduler(scheduler) frees it without touching the sources.
+ */
+
+#include "alad.h"
+
+#ifndef ALAD_UTILS_H
+#define ALAD_UTILS_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+/* shadow cache over the active AL table; returns AL_FALSE if the cache can't be allocated */
+extern ALboolean aladEnableShadow(ALsizei maxSources);
+extern void aladDisableShadow(void);
+
+/* filter over the active AL table, which drops writes of values a source, buffer or the listener already has */
+typedef struct aladFilterStatistics {
+    unsigned long writes;       /* calls of the filtered setters */
+    unsigned long dropped;      /* of those, the ones that weren't passed on */
+} aladFilterStatistics;
+extern ALboolean aladEnableFilter(ALsizei maxSources, ALsizei maxBuffers);
+extern void aladDisableFilter(void);
+extern aladFilterStatistics aladGetFilterStatistics(ALboolean reset);
+
+/* bulk position updates from structure-of-arrays inputs, with the velocities derived from the last update; NULL is the default motion */
+typedef struct aladSourceMotion aladSourceMotion;
+extern aladSourceMotion* aladCreateSourceMotion(void);
+extern void aladDestroySourceMotion(aladSourceMotion *motion);
+extern ALboolean aladUpdateSourcesEx(aladSourceMotion *motion, ALsizei n, const ALuint *sources, const ALfloat *px, const ALfloat *py, const ALfloat *pz, ALfloat dt);
+extern ALboolean aladUpdateSources(ALsizei n, const ALuint *sources, const ALfloat *px, const ALfloat *py, const ALfloat *pz, ALfloat dt);
+
+/* pool of pre-generated sources; a cache belongs to one thread and starts out as {0} */
+#ifndef ALAD_SOURCE_CACHE_SIZE
+#define ALAD_SOURCE_CACHE_SIZE 8
+#endif
+typedef struct aladSourcePool aladSourcePool;
+typedef struct aladSourceCache {
+    ALsizei count;
+    ALuint  sources[ALAD_SOURCE_CACHE_SIZE];
+} aladSourceCache;
+extern aladSourcePool* aladCreateSourcePool(ALsizei count);
+extern void aladDestroySourcePool(aladSourcePool *pool);
+extern ALuint aladAcquireSource(aladSourcePool *pool, aladSourceCache *cache);
+extern void aladReleaseSource(aladSourcePool *pool, ALuint source);
+extern void aladFlushSourceCache(aladSourcePool *pool, aladSourceCache *cache);
+extern ALsizei aladRecycleSources(aladSourcePool *pool);
+
+/* virtual voices, of which only the loudest have a real source; a voice handle is 0 if there was no room */
+typedef struct aladVoiceManager aladVoiceManager;
+typedef ALuint aladVoice;
+extern aladVoiceManager* aladCreateVoiceManager(ALsizei maxVoices, ALsizei maxSources);
+extern void aladDestroyVoiceManager(aladVoiceManager *manager);
+extern aladVoice aladPlayVoice(aladVoiceManager *manager, ALuint buffer, ALboolean looping);
+extern void aladStopVoice(aladVoiceManager *manager, aladVoice voice);
+extern void aladSetVoiceGain(aladVoiceManager *manager, aladVoice voice, ALfloat gain);
+extern void aladSetVoicePosition(aladVoiceManager *manager, aladVoice voice, ALfloat x, ALfloat y, ALfloat z);
+extern ALboolean aladIsVoicePlaying(aladVoiceManager *manager, aladVoice voice);
+extern ALuint aladGetVoiceSource(aladVoiceManager *manager, aladVoice voice);
+extern void aladUpdateVoices(aladVoiceManager *manager, ALfloat dt);
+
+/* streams through a single-producer/single-consumer ring, pulled by an AL_SOFT_callback_buffer callback or queued by aladUpdateStream */
+typedef struct aladStream aladStream;
+typedef struct aladStreamStatistics {
+    unsigned long underruns;    /* times the ring ran dry before the end */
+    unsigned long silentBytes;  /* silence the callback played for them, not counted without AL_SOFT_callback_buffer */
+} aladStreamStatistics;
+extern aladStream* aladCreateStream(ALuint source, ALenum format, ALsizei frequency, ALsizei ringBytes);
+extern void aladDestroyStream(aladStream *stream);
+extern void* aladBeginStreamWrite(aladStream *stream, ALsizei *bytes);
+extern void aladEndStreamWrite(aladStream *stream, ALsizei bytes);
+extern ALsizei aladWriteStream(aladStream *stream, const void *data, ALsizei bytes);
+extern void aladEndStream(aladStream *stream);
+extern void aladUpdateStream(aladStream *stream);
+extern void aladPlayStream(aladStream *stream);
+extern void aladStopStream(aladStream *stream);
+extern aladStreamStatistics aladGetStreamStatistics(aladStream *stream);
+
+/* records of the AL_SOFT_events events, queued by the event thread for whichever thread waits for them */
+typedef struct aladEvent {
+    ALenum  type;       /* AL_EVENT_TYPE_BUFFER_COMPLETED_SOFT, AL_EVENT_TYPE_SOURCE_STATE_CHANGED_SOFT or AL_EVENT_TYPE_DISCONNECTED_SOFT */
+    ALuint  object;     /* the source, 0 for a disconnect */
+    ALuint  param;      /* the number of buffers completed, or the new state */
+} aladEvent;
+#if defined(_WIN32) || defined(__WIN32__) || defined(WIN32) || defined(__MINGW32__)
+typedef void *aladEventHandle;
+#else
+typedef int aladEventHandle;
+#endif
+extern ALboolean aladEnableEventQueue(ALsizei capacity);
+extern void aladDisableEventQueue(void);
+extern ALsizei aladPollEvents(aladEvent *events, ALsizei max);
+extern ALboolean aladWaitEvents(long milliseconds);
+extern aladEventHandle aladGetEventHandle(void);
+extern unsigned long aladGetDroppedEvents(ALboolean reset);
+
+/* starts and stops sources at device clock times, with AL_SOFT_source_start_delay and ALC_SOFT_device_clock where available */
+typedef struct aladScheduler aladScheduler;
+extern aladScheduler* aladCreateScheduler(ALCdevice *device, ALsizei capacity);
+extern void aladDestroyScheduler(aladScheduler *scheduler);
+extern ALint64SOFT aladGetSchedulerTime(aladScheduler *scheduler);
+extern ALboolean aladSchedulePlay(aladScheduler *scheduler, ALuint source, ALint64SOFT time);
+extern ALboolean aladScheduleStop(aladScheduler *scheduler, ALuint source, ALint64SOFT time);
+extern ALsizei aladCancelScheduled(aladScheduler *scheduler, ALuint source);
+extern ALsizei aladUpdateScheduler(aladScheduler *scheduler, ALint64SOFT window);
+
+
+
+#ifdef ALAD_UTILS_IMPLEMENTATION
+
+#include <stdlib.h>
+#include <float.h>
+
+#ifdef AL_API_NOEXCEPT17
+#define ALADU_NOEXCEPT_ AL_API_NOEXCEPT17
+#else
+#define ALADU_NOEXCEPT_
+#endif
+
+/* atomics, for the state shared with the mixer and event threads; the loads acquire, the stores release, the rest does both */
+#if defined(__GNUC__) || defined(__clang__)
+static long  aladu_atomic_load_long_ (volatile long *p)              { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+static void  aladu_atomic_store_long_ (volatile long *p, long v)     { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+static long  aladu_atomic_exchange_long_ (volatile long *p, long v)  { return __atomic_exchange_n(p, v, __ATOMIC_ACQ_REL); }
+static ALboolean aladu_atomic_cas_long_ (volatile long *p, long expected, long desired) {
+    return __atomic_compare_exchange_n(p, &expected, desired, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) ? AL_TRUE : AL_FALSE;
+}
+#elif defined(_MSC_VER)
+#include <intrin.h>
+static long  aladu_atomic_load_long_ (volatile long *p)              { return _InterlockedCompareExchange(p, 0, 0); }
+static void  aladu_atomic_store_long_ (volatile long *p, long v)     { _InterlockedExchange(p, v); }
+static long  aladu_atomic_exchange_long_ (volatile long *p, long v)  { return _InterlockedExchange(p, v); }
+static ALboolean aladu_atomic_cas_long_ (volatile long *p, long expected, long desired) {
+    return _InterlockedCompareExchange(p, desired, expected) == expected ? AL_TRUE : AL_FALSE;
+}
+#else
+/* no known atomics, so this is only safe as long as a single thread uses these layers and no events are delivered */
+static long  aladu_atomic_load_long_ (volatile long *p)              { return *p; }
+static void  aladu_atomic_store_long_ (volatile long *p, long v)     { *p = v; }
+static long  aladu_atomic_exchange_long_ (volatile long *p, long v)  { long old = *p; *p = v; return old; }
+static ALboolean aladu_atomic_cas_long_ (volatile long *p, long expected, long desired) {
+    if (*p != expected) return AL_FALSE;
+    *p = desired;
+    return AL_TRUE;
+}
+#endif
+
+/* rounds up to a power of two, for the open addressing tables */
+static size_t aladu_power_of_two_ (size_t n) {
+    size_t size = 1;
+    while (size < n) size <<= 1;
+    return size;
+}
+static size_t aladu_hash_id_ (ALuint id) {
+    size_t hash = (size_t) id * 0x9E3779B1UL;
+    return hash ^ (hash >> 15);
+}
+
+/* the layers that wrap the AL table, with the table each one calls through, so that enabling one again can tell whether aladAL still
+   reaches it or has been pointed at another table since, by aladUpdateAL or aladActivateContextFunctions; order counts the wraps, so
+   that the update callback wraps the new table in the same order */
+#define ALADU_LAYERS_ 2
+typedef struct aladu_layer_ {
+    const aladALFunctions   *table;
+    aladALFunctions * const *previous;
+    void                   (*wrap) (void);
+    unsigned long            order;
+} aladu_layer_;
+static aladu_layer_ aladu_layers_[ALADU_LAYERS_];
+static unsigned long aladu_layer_order_ = 0;
+static aladUpdateCallback aladu_previous_update_callback_ = nullptr;
+static ALboolean aladu_update_callback_set_ = AL_FALSE;
+static void aladu_update_callback_ (void) {
+    unsigned long order[ALADU_LAYERS_], last = 0;
+    size_t i;
+    if (aladu_previous_update_callback_ != nullptr) aladu_previous_update_callback_();
+    /* wrapping counts on, so the order is taken before */
+    for (i = 0; i < ALADU_LAYERS_; i++) order[i] = aladu_layers_[i].table != nullptr ? aladu_layers_[i].order : 0;
+    for (;;) {
+        size_t next = ALADU_LAYERS_;
+        for (i = 0; i < ALADU_LAYERS_; i++) {
+            if (order[i] > last && (next == ALADU_LAYERS_ || order[i] < order[next])) next = i;
+        }
+        if (next == ALADU_LAYERS_) return;
+        last = order[next];
+        aladu_layers_[next].wrap();
+    }
+}
+/* called by the wrap functions with the table they wrap; the update callback is chained in once */
+static void aladu_register_layer_ (size_t index, const aladALFunctions *table, aladALFunctions * const *previous, void (*wrap) (void)) {
+    aladu_layers_[index].table = table;
+    aladu_layers_[index].previous = previous;
+    aladu_layers_[index].wrap = wrap;
+    aladu_layers_[index].order = ++aladu_layer_order_;
+    if (!aladu_update_callback_set_) {
+        aladu_previous_update_callback_ = aladSetUpdateCallback(aladu_update_callback_);
+        aladu_update_callback_set_ = AL_TRUE;
+    }
+}
+static ALboolean aladu_layer_reachable_ (const aladALFunctions *table) {
+    const aladALFunctions *active = aladActiveAL;
+    size_t i, hops;
+    for (hops = 0; hops <= ALADU_LAYERS_; hops++) {
+        if (active == table) return AL_TRUE;
+        for (i = 0; i < ALADU_LAYERS_ && (aladu_layers_[i].table == nullptr || aladu_layers_[i].table != active); i++) continue;
+        if (i == ALADU_LAYERS_) return AL_FALSE;
+        active = *aladu_layers_[i].previous;
+    }
+    return AL_FALSE;
+}
+
+
+/* AL_SOFT_events: one callback for the context, which hands the events to the layers that asked for them */
+static ALboolean aladu_shadow_events_ (ALenum eventType, ALuint object);
+static void aladu_queue_event_ (ALenum eventType, ALuint object, ALuint param);
+static void AL_APIENTRY aladu_event_callback_ (ALenum eventType, ALuint object, ALuint param, ALsizei length, const ALchar *message, void *userParam) ALADU_NOEXCEPT_ {
+    (void) length; (void) message; (void) userParam;
+    aladu_shadow_events_(eventType, object);
+    aladu_queue_event_(eventType, object, param);
+}
+static const ALenum aladu_event_types_[] = { AL_EVENT_TYPE_BUFFER_COMPLETED_SOFT, AL_EVENT_TYPE_SOURCE_STATE_CHANGED_SOFT, AL_EVENT_TYPE_DISCONNECTED_SOFT };
+static long aladu_event_users_ = 0;
+static ALboolean aladu_enable_events_ (aladALFunctions *functions, ALboolean enable) {
+    aladResolveFunction(functions, offsetof(aladALFunctions, EventCallbackSOFT));
+    aladResolveFunction(functions, offsetof(aladALFunctions, EventControlSOFT));
+    if (functions->EventCallbackSOFT == nullptr || functions->EventControlSOFT == nullptr) return AL_FALSE;
+    /* registered by the first layer that asks and unregistered with the last; setting the callback again in between waits for a call
+       of it in progress, so a layer that stops receiving events can free what the callback uses right afterwards */
+    if (enable && aladu_event_users_++ != 0) return AL_TRUE;
+    if (!enable && --aladu_event_users_ != 0) {
+        functions->EventCallbackSOFT(aladu_event_callback_, nullptr);
+        return AL_TRUE;
+    }
+    if (enable) functions->EventCallbackSOFT(aladu_event_callback_, nullptr);
+    functions->EventControlSOFT((ALsizei) (sizeof(aladu_event_types_) / sizeof(aladu_event_types_[0])), aladu_event_types_, enable);
+    if (!enable) functions->EventCallbackSOFT(nullptr, nullptr);
+    return AL_TRUE;
+}
+
+
+/*
+ * Shadow cache: a structure of arrays with one column per parameter component, indexed by a slot per source. The sources are found by
+ * an open addressing table of (id, slot), with a slot of -1 for removed entries, so that the probe chains stay intact. The event thread
+ * only reads it and marks slots stale; if it races with a removal, it marks the wrong slot at worst, which only costs a driver call.
+ */
+/* min and max are the range the specification allows, the driver rejects anything else (including infinities and NaN, which no range
+   check lets through); a pitch of 0 is outside of it, but some drivers accept it */
+typedef struct aladu_shadow_param_ {
+    ALenum  param;
+    int     column;
+    int     count;
+    ALfloat initial;
+    ALfloat min;
+    ALfloat max;
+} aladu_shadow_param_;
+static const aladu_shadow_param_ aladu_shadow_floats_[] = {
+    { AL_GAIN,               0, 1, 1.0f,    0.0f,     FLT_MAX },
+    { AL_PITCH,              1, 1, 1.0f,    FLT_MIN,  FLT_MAX },
+    { AL_MIN_GAIN,           2, 1, 0.0f,    0.0f,     1.0f    },
+    { AL_MAX_GAIN,           3, 1, 1.0f,    0.0f,     1.0f    },
+    { AL_REFERENCE_DISTANCE, 4, 1, 1.0f,    0.0f,     FLT_MAX },
+    { AL_ROLLOFF_FACTOR,     5, 1, 1.0f,    0.0f,     FLT_MAX },
+    { AL_MAX_DISTANCE,       6, 1, FLT_MAX, 0.0f,     FLT_MAX },
+    { AL_CONE_INNER_ANGLE,   7, 1, 360.0f,  0.0f,     360.0f  },
+    { AL_CONE_OUTER_ANGLE,   8, 1, 360.0f,  0.0f,     360.0f  },
+    { AL_CONE_OUTER_GAIN,    9, 1, 0.0f,    0.0f,     1.0f    },
+    { AL_POSITION,          10, 3, 0.0f,    -FLT_MAX, FLT_MAX },
+    { AL_VELOCITY,          13, 3, 0.0f,    -FLT_MAX, FLT_MAX },
+    { AL_DIRECTION,         16, 3, 0.0f,    -FLT_MAX, FLT_MAX }
+};
+static const aladu_shadow_param_ aladu_shadow_ints_[] = {
+    { AL_SOURCE_RELATIVE,    0, 1, 0.0f,    0.0f,     1.0f    },
+    { AL_LOOPING,            1, 1, 0.0f,    0.0f,     1.0f    }
+};
+static const aladu_shadow_param_ aladu_shadow_listener_[] = {
+    { AL_GAIN,               0, 1, 1.0f,    0.0f,     FLT_MAX },
+    { AL_POSITION,           1, 3, 0.0f,    -FLT_MAX, FLT_MAX },
+    { AL_VELOCITY,           4, 3, 0.0f,    -FLT_MAX, FLT_MAX },
+    { AL_ORIENTATION,        7, 6, 0.0f,    -FLT_MAX, FLT_MAX }
+};
+#define ALADU_SHADOW_FLOATS_   19
+#define ALADU_SHADOW_INTS_     2
+#define ALADU_SHADOW_LISTENER_ 13
+#define ALADU_COUNT_OF_(array) (sizeof(array) / sizeof((array)[0]))
+
+typedef struct aladu_shadow_key_ {
+    volatile long id;
+    volatile long slot;
+} aladu_shadow_key_;
+typedef struct aladu_shadow_t_ {
+    void               *memory;
+    size_t              mask;
+    /* read once per event by the event thread, and cleared before the callback is set again on disabling */
+    aladu_shadow_key_ * volatile keys;
+    ALuint             *ids;
+    ALsizei            *free;
+    ALsizei             freeCount;
+    ALsizei             capacity;
+    ALfloat            *floats[ALADU_SHADOW_FLOATS_];
+    ALint              *ints[ALADU_SHADOW_INTS_];
+    /* a bit per parameter (the floats, then the ints) whose last value may have been rejected, so the getter asks the driver */
+    ALuint             *uncached;
+    /* the values only the driver changes, valid while the slot isn't stale and events are delivered */
+    ALint              *state;
+    ALint              *queued;
+    ALint              *processed;
+    volatile long      *stale;
+    ALboolean           events;
+    ALfloat             listener[ALADU_SHADOW_LISTENER_];
+    unsigned long       listenerUncached;
+    /* the sources are those of context; the events are only delivered for eventContext, the one current when it was enabled */
+    ALCcontext         *context;
+    ALCcontext         *eventContext;
+    aladALFunctions    *previous;
+} aladu_shadow_t_;
+static aladu_shadow_t_ aladu_shadow_;
+/* the table the shadow calls through, and the one aladAL points to while it is enabled */
+static aladALFunctions aladu_shadow_driver_;
+static aladALFunctions aladu_shadow_table_;
+
+static const aladu_shadow_param_* aladu_shadow_param_find_ (const aladu_shadow_param_ *params, size_t count, ALenum param) {
+    size_t i;
+    for (i = 0; i < count; i++) {
+        if (params[i].param == param) return &params[i];
+    }
+    return nullptr;
+}
+/* whether the cache is enabled and holds the sources of the current context; on another one (like the listeners of
+   openal-explicit-polyfill.h), the same ids are other sources, so everything goes to the driver */
+static ALboolean aladu_shadow_current_ (void) {
+    if (aladu_shadow_.keys == nullptr) return AL_FALSE;
+    return aladALC.GetCurrentContext == nullptr || aladALC.GetCurrentContext() == aladu_shadow_.context ? AL_TRUE : AL_FALSE;
+}
+/* returns the slot of a cached source in keys, or -1 */
+static ALsizei aladu_shadow_find_in_ (aladu_shadow_key_ *keys, ALuint source) {
+    size_t i, index;
+    if (keys == nullptr || source == 0) return -1;
+    index = aladu_hash_id_(source) & aladu_shadow_.mask;
+    for (i = 0; i <= aladu_shadow_.mask; i++, index = (index + 1) & aladu_shadow_.mask) {
+        long id = aladu_atomic_load_long_(&keys[index].id);
+        if (id == 0) return -1;
+        if ((ALuint) id == source) {
+            long slot = aladu_atomic_load_long_(&keys[index].slot);
+            if (slot >= 0) return (ALsizei) slot;
+        }
+    }
+    return -1;
+}
+/* the same for the calls through the table, which only find sources while the shadow's context is current */
+static ALsizei aladu_shadow_find_ (ALuint source) {
+    if (!aladu_shadow_current_()) return -1;
+    return aladu_shadow_find_in_(aladu_shadow_.keys, source);
+}
+static void aladu_shadow_insert_ (ALuint source) {
+    aladu_shadow_key_ *entry = nullptr;
+    size_t i, index, k;
+    ALsizei slot;
+    if (!aladu_shadow_current_() || source == 0 || aladu_shadow_.freeCount == 0 || aladu_shadow_find_in_(aladu_shadow_.keys, source) >= 0) return;
+    index = aladu_hash_id_(source) & aladu_shadow_.mask;
+    for (i = 0; i <= aladu_shadow_.mask && entry == nullptr; i++, index = (index + 1) & aladu_shadow_.mask) {
+        if (aladu_shadow_.keys[index].id == 0 || aladu_shadow_.keys[index].slot < 0) entry = &aladu_shadow_.keys[index];
+    }
+    if (entry == nullptr) return;
+    slot = aladu_shadow_.free[--aladu_shadow_.freeCount];
+    aladu_shadow_.ids[slot] = source;
+    for (k = 0; k < ALADU_COUNT_OF_(aladu_shadow_floats_); k++) {
+        int c;
+        for (c = 0; c < aladu_shadow_floats_[k].count; c++) aladu_shadow_.floats[aladu_shadow_floats_[k].column + c][slot] = aladu_shadow_floats_[k].initial;
+    }
+    for (k = 0; k < ALADU_SHADOW_INTS_; k++) aladu_shadow_.ints[k][slot] = (ALint) aladu_shadow_ints_[k].initial;
+    aladu_shadow_.uncached[slot] = 0;
+    aladu_shadow_.state[slot] = AL_INITIAL;
+    aladu_shadow_.queued[slot] = 0;
+    aladu_shadow_.processed[slot] = 0;
+    aladu_atomic_store_long_(&aladu_shadow_.stale[slot], 0);
+    /* the slot is published last, the event thread ignores the entry until then */
+    aladu_atomic_store_long_(&entry->slot, -1);
+    aladu_atomic_store_long_(&entry->id, (long) source);
+    aladu_atomic_store_long_(&entry->slot, (long) slot);
+}
+static void aladu_shadow_remove_ (ALuint source) {
+    size_t i, index;
+    if (!aladu_shadow_current_() || source == 0) return;
+    index = aladu_hash_id_(source) & aladu_shadow_.mask;
+    for (i = 0; i <= aladu_shadow_.mask; i++, index = (index + 1) & aladu_shadow_.mask) {
+        aladu_shadow_key_ *entry = &aladu_shadow_.keys[index];
+        if (entry->id == 0) return;
+        if ((ALuint) entry->id != source || entry->slot < 0) continue;
+        aladu_shadow_.free[aladu_shadow_.freeCount++] = (ALsizei) entry->slot;
+        aladu_atomic_store_long_(&entry->slot, -1);
+        /* the end of a probe chain doesn't need a tombstone */
+        if (aladu_shadow_.keys[(index + 1) & aladu_shadow_.mask].id == 0) aladu_atomic_store_long_(&entry->id, 0);
+        return;
+    }
+}
+static void aladu_shadow_mark_stale_ (ALuint source) {
+    ALsizei slot = aladu_shadow_find_(source);
+    if (slot >= 0) aladu_atomic_store_long_(&aladu_shadow_.stale[slot], 1);
+}
+static void aladu_shadow_mark_stale_v_ (ALsizei n, const ALuint *sources) {
+    ALsizei i;
+    for (i = 0; i < n; i++) aladu_shadow_mark_stale_(sources[i]);
+}
+/* runs on the event thread, for the context the shadow was enabled on */
+static ALboolean aladu_shadow_events_ (ALenum eventType, ALuint object) {
+    aladu_shadow_key_ *keys = aladu_shadow_.keys;
+    ALsizei slot;
+    if (keys == nullptr) return AL_FALSE;
+    if (eventType == AL_EVENT_TYPE_DISCONNECTED_SOFT) {
+        size_t i;
+        for (i = 0; i <= aladu_shadow_.mask; i++) {
+            long index = aladu_atomic_load_long_(&keys[i].slot);
+            if (index >= 0 && aladu_atomic_load_long_(&keys[i].id) != 0) aladu_atomic_store_long_(&aladu_shadow_.stale[index], 1);
+        }
+        return AL_TRUE;
+    }
+    slot = aladu_shadow_find_in_(keys, object);
+    if (slot < 0) return AL_FALSE;
+    aladu_atomic_store_long_(&aladu_shadow_.stale[slot], 1);
+    return AL_TRUE;
+}
+/* answers AL_SOURCE_STATE, AL_BUFFERS_QUEUED and AL_BUFFERS_PROCESSED (AL_BUFFER isn't cached, it follows the queue), refreshing them first if they're stale */
+static ALboolean aladu_shadow_driver_value_ (ALsizei slot, ALenum param, ALint *value) {
+    ALint *column;
+    if (param == AL_SOURCE_STATE)           column = aladu_shadow_.state;
+    else if (param == AL_BUFFERS_QUEUED)    column = aladu_shadow_.queued;
+    else if (param == AL_BUFFERS_PROCESSED) column = aladu_shadow_.processed;
+    else return AL_FALSE;
+    if (!aladu_shadow_.events || aladu_shadow_.context != aladu_shadow_.eventContext) return AL_FALSE;
+    /* cleared before asking, so an event that arrives meanwhile marks it again */
+    if (aladu_atomic_exchange_long_(&aladu_shadow_.stale[slot], 0) != 0) {
+        ALuint source = aladu_shadow_.ids[slot];
+        aladu_shadow_driver_.GetSourcei(source, AL_SOURCE_STATE, &aladu_shadow_.state[slot]);
+        aladu_shadow_driver_.GetSourcei(source, AL_BUFFERS_QUEUED, &aladu_shadow_.queued[slot]);
+        aladu_shadow_driver_.GetSourcei(source, AL_BUFFERS_PROCESSED, &aladu_shadow_.processed[slot]);
+    }
+    *value = column[slot];
+    return AL_TRUE;
+}
+/* whether the driver accepts all components of a value; an int parameter also has to be a whole number */
+static ALboolean aladu_shadow_accepts_ (const aladu_shadow_param_ *entry, ALboolean isInt, const ALfloat *floats, const ALint *ints) {
+    int c;
+    for (c = 0; c < entry->count; c++) {
+        ALfloat value = floats != nullptr ? floats[c] : (ALfloat) ints[c];
+        if (!(value >= entry->min && value <= entry->max)) return AL_FALSE;
+        if (isInt && ints == nullptr && (ALfloat) (ALint) value != value) return AL_FALSE;
+    }
+    return AL_TRUE;
+}
+/* stores count components of a parameter set through any setter, converting between float and int columns; a value the driver rejects
+   leaves what it had, so it isn't stored either, and the getter asks the driver until the parameter is set to a valid value */
+static ALboolean aladu_shadow_store_ (ALuint source, ALenum param, ALsizei count, const ALfloat *floats, const ALint *ints) {
+    const aladu_shadow_param_ *entry;
+    ALuint bit;
+    ALsizei slot = aladu_shadow_find_(source), c;
+    if (slot < 0) return AL_FALSE;
+    if (param == AL_BUFFER) aladu_atomic_store_long_(&aladu_shadow_.stale[slot], 1);
+    if ((entry = aladu_shadow_param_find_(aladu_shadow_floats_, ALADU_COUNT_OF_(aladu_shadow_floats_), param)) != nullptr) {
+        if (count >= 0 && count != entry->count) return AL_FALSE;
+        bit = 1U << (entry - aladu_shadow_floats_);
+        if (!aladu_shadow_accepts_(entry, AL_FALSE, floats, ints)) {
+            aladu_shadow_.uncached[slot] |= bit;
+            return AL_FALSE;
+        }
+        for (c = 0; c < entry->count; c++) aladu_shadow_.floats[entry->column + c][slot] = floats != nullptr ? floats[c] : (ALfloat) ints[c];
+        aladu_shadow_.uncached[slot] &= ~bit;
+        return AL_TRUE;
+    }
+    if ((entry = aladu_shadow_param_find_(aladu_shadow_ints_, ALADU_COUNT_OF_(aladu_shadow_ints_), param)) != nullptr) {
+        if (count >= 0 && count != entry->count) return AL_FALSE;
+        bit = 1U << (ALADU_COUNT_OF_(aladu_shadow_floats_) + (size_t) (entry - aladu_shadow_ints_));
+        if (!aladu_shadow_accepts_(entry, AL_TRUE, floats, ints)) {
+            aladu_shadow_.uncached[slot] |= bit;
+            return AL_FALSE;
+        }
+        aladu_shadow_.ints[entry->column][slot] = ints != nullptr ? ints[0] : (ALint) floats[0];
+        aladu_shadow_.uncached[slot] &= ~bit;
+        return AL_TRUE;
+    }
+    return AL_FALSE;
+}
+/* loads count components (-1 for as many as the parameter has) of a float parameter, returns AL_FALSE if the driver has to be asked */
+static ALboolean aladu_shadow_load_ (ALuint source, ALenum param, ALsizei count, ALfloat *values) {
+    const aladu_shadow_param_ *entry = aladu_shadow_param_find_(aladu_shadow_floats_, ALADU_COUNT_OF_(aladu_shadow_floats_), param);
+    ALsizei slot = aladu_shadow_find_(source), c;
+    if (slot < 0 || entry == nullptr || (count >= 0 && count != entry->count)) return AL_FALSE;
+    if ((aladu_shadow_.uncached[slot] & (1U << (entry - aladu_shadow_floats_))) != 0) return AL_FALSE;
+    for (c = 0; c < entry->count; c++) values[c] = aladu_shadow_.floats[entry->column + c][slot];
+    return AL_TRUE;
+}
+static ALboolean aladu_shadow_load_int_ (ALuint source, ALenum param, ALint *value) {
+    const aladu_shadow_param_ *entry = aladu_shadow_param_find_(aladu_shadow_ints_, ALADU_COUNT_OF_(aladu_shadow_ints_), param);
+    ALsizei slot = aladu_shadow_find_(source);
+    if (slot < 0) return AL_FALSE;
+    if (entry == nullptr) return aladu_shadow_driver_value_(slot, param, value);
+    if ((aladu_shadow_.uncached[slot] & (1U << (ALADU_COUNT_OF_(aladu_shadow_floats_) + (size_t) (entry - aladu_shadow_ints_)))) != 0) return AL_FALSE;
+    *value = aladu_shadow_.ints[entry->column][slot];
+    return AL_TRUE;
+}
+static void aladu_shadow_listener_store_ (ALenum param, ALsizei count, const ALfloat *floats, const ALint *ints) {
+    const aladu_shadow_param_ *entry = aladu_shadow_param_find_(aladu_shadow_listener_, ALADU_COUNT_OF_(aladu_shadow_listener_), param);
+    unsigned long bit;
+    ALsizei c;
+    if (!aladu_shadow_current_() || entry == nullptr || (count >= 0 && count != entry->count)) return;
+    bit = 1UL << (entry - aladu_shadow_listener_);
+    if (!aladu_shadow_accepts_(entry, AL_FALSE, floats, ints)) {
+        aladu_shadow_.listenerUncached |= bit;
+        return;
+    }
+    for (c = 0; c < entry->count; c++) aladu_shadow_.listener[entry->column + c] = floats != nullptr ? floats[c] : (ALfloat) ints[c];
+    aladu_shadow_.listenerUncached &= ~bit;
+}
+static ALboolean aladu_shadow_listener_load_ (ALenum param, ALsizei count, ALfloat *values) {
+    const aladu_shadow_param_ *entry = aladu_shadow_param_find_(aladu_shadow_listener_, ALADU_COUNT_OF_(aladu_shadow_listener_), param);
+    ALsizei c;
+    if (!aladu_shadow_current_() || entry == nullptr || (count >= 0 && count != entry->count)) return AL_FALSE;
+    if ((aladu_shadow_.listenerUncached & (1UL << (entry - aladu_shadow_listener_))) != 0) return AL_FALSE;
+    for (c = 0; c < entry->count; c++) values[c] = aladu_shadow_.listener[entry->column + c];
+    return AL_TRUE;
+}
+
+/* the wrappers of the shadow table: setters call the driver and then store, getters only call it if the cache can't answer */
+static void AL_APIENTRY aladu_shadow_gen_sources_ (ALsizei n, ALuint *sources) ALADU_NOEXCEPT_ {
+    ALsizei i;
+    aladu_shadow_driver_.GenSources(n, sources);
+    for (i = 0; i < n; i++) aladu_shadow_insert_(sources[i]);
+}
+static void AL_APIENTRY aladu_shadow_delete_sources_ (ALsizei n, const ALuint *sources) ALADU_NOEXCEPT_ {
+    ALsizei i;
+    aladu_shadow_driver_.DeleteSources(n, sources);
+    for (i = 0; i < n; i++) aladu_shadow_remove_(sources[i]);
+}
+static void AL_APIENTRY aladu_shadow_sourcef_ (ALuint source, ALenum param, ALfloat value) ALADU_NOEXCEPT_ {
+    aladu_shadow_driver_.Sourcef(source, param, value);
+    aladu_shadow_store_(source, param, 1, &value, nullptr);
+}
+static void AL_APIENTRY aladu_shadow_source3f_ (ALuint source, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3) ALADU_NOEXCEPT_ {
+    ALfloat values[3];
+    values[0] = value1; values[1] = value2; values[2] = value3;
+    aladu_shadow_driver_.Source3f(source, param, value1, value2, value3);
+    aladu_shadow_store_(source, param, 3, values, nullptr);
+}
+static void AL_APIENTRY aladu_shadow_sourcefv_ (ALuint source, ALenum param, const ALfloat *values) ALADU_NOEXCEPT_ {
+    aladu_shadow_driver_.Sourcefv(source, param, values);
+    if (values != nullptr) aladu_shadow_store_(source, param, -1, values, nullptr);
+}
+static void AL_APIENTRY aladu_shadow_sourcei_ (ALuint source, ALenum param, ALint value) ALADU_NOEXCEPT_ {
+    aladu_shadow_driver_.Sourcei(source, param, value);
+    aladu_shadow_store_(source, param, 1, nullptr, &value);
+}
+static void AL_APIENTRY aladu_shadow_source3i_ (ALuint source, ALenum param, ALint value1, ALint value2, ALint value3) ALADU_NOEXCEPT_ {
+    ALint values[3];
+    values[0] = value1; values[1] = value2; values[2] = value3;
+    aladu_shadow_driver_.Source3i(source, param, value1, value2, value3);
+    aladu_shadow_store_(source, param, 3, nullptr, values);
+}
+static void AL_APIENTRY aladu_shadow_sourceiv_ (ALuint source, ALenum param, const ALint *values) ALADU_NOEXCEPT_ {
+    aladu_shadow_driver_.Sourceiv(source, param, values);
+    if (values != nullptr) aladu_shadow_store_(source, param, -1, nullptr, values);
+}
+static void AL_APIENTRY aladu_shadow_get_sourcef_ (ALuint source, ALenum param, ALfloat *value) ALADU_NOEXCEPT_ {
+    if (value == nullptr || !aladu_shadow_load_(source, param, 1, value)) aladu_shadow_driver_.GetSourcef(source, param, value);
+}
+static void AL_APIENTRY aladu_shadow_get_source3f_ (ALuint source, ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3) ALADU_NOEXCEPT_ {
+    ALfloat values[3];
+    if (value1 == nullptr || value2 == nullptr || value3 == nullptr || !aladu_shadow_load_(source, param, 3, values)) {
+        aladu_shadow_driver_.GetSource3f(source, param, value1, value2, value3);
+        return;
+    }
+    *value1 = values[0]; *value2 = values[1]; *value3 = values[2];
+}
+static void AL_APIENTRY aladu_shadow_get_sourcefv_ (ALuint source, ALenum param, ALfloat *values) ALADU_NOEXCEPT_ {
+    if (values == nullptr || !aladu_shadow_load_(source, param, -1, values)) aladu_shadow_driver_.GetSourcefv(source, param, values);
+}
+static void AL_APIENTRY aladu_shadow_get_sourcei_ (ALuint source, ALenum param, ALint *value) ALADU_NOEXCEPT_ {
+    if (value == nullptr || !aladu_shadow_load_int_(source, param, value)) aladu_shadow_driver_.GetSourcei(source, param, value);
+}
+static void AL_APIENTRY aladu_shadow_get_sourceiv_ (ALuint source, ALenum param, ALint *values) ALADU_NOEXCEPT_ {
+    if (values == nullptr || !aladu_shadow_load_int_(source, param, values)) aladu_shadow_driver_.GetSourceiv(source, param, values);
+}
+static void AL_APIENTRY aladu_shadow_source_play_ (ALuint source) ALADU_NOEXCEPT_ {
+    aladu_shadow_driver_.SourcePlay(source);
+    aladu_shadow_mark_stale_(source);
+}
+static void AL_APIENTRY aladu_shadow_source_stop_ (ALuint source) ALADU_NOEXCEPT_ {
+    aladu_shadow_driver_.SourceStop(source);
+    aladu_shadow_mark_stale_(source);
+}
+static void AL_APIENTRY aladu_shadow_source_rewind_ (ALuint source) ALADU_NOEXCEPT_ {
+    aladu_shadow_driver_.SourceRewind(source);
+    aladu_shadow_mark_stale_(source);
+}
+static void AL_APIENTRY aladu_shadow_source_pause_ (ALuint source) ALADU_NOEXCEPT_ {
+    aladu_shadow_driver_.SourcePause(source);
+    aladu_shadow_mark_stale_(source);
+}
+static void AL_APIENTRY aladu_shadow_source_playv_ (ALsizei n, const ALuint *sources) ALADU_NOEXCEPT_ {
+    aladu_shadow_driver_.SourcePlayv(n, sources);
+    aladu_shadow_mark_stale_v_(n, sources);
+}
+static void AL_APIENTRY aladu_shadow_source_stopv_ (ALsizei n, const ALuint *sources) ALADU_NOEXCEPT_ {
+    aladu_shadow_driver_.SourceStopv(n, sources);
+    aladu_shadow_mark_stale_v_(n, sources);
+}
+static void AL_APIENTRY aladu_shadow_source_rewindv_ (ALsizei n, const ALuint *sources) ALADU_NOEXCEPT_ {
+    aladu_shadow_driver_.SourceRewindv(n, sources);
+    aladu_shadow_mark_stale_v_(n, sources);
+}
+static void AL_APIENTRY aladu_shadow_source_pausev_ (ALsizei n, const ALuint *sources) ALADU_NOEXCEPT_ {
+    aladu_shadow_driver_.SourcePausev(n, sources);
+    aladu_shadow_mark_stale_v_(n, sources);
+}
+static void AL_APIENTRY aladu_shadow_source_play_at_time_ (ALuint source, ALint64SOFT start_time) ALADU_NOEXCEPT_ {
+    aladu_shadow_driver_.SourcePlayAtTimeSOFT(source, start_time);
+    aladu_shadow_mark_stale_(source);
+}
+static void AL_APIENTRY aladu_shadow_source_play_at_timev_ (ALsizei n, const ALuint *sources, ALint64SOFT start_time) ALADU_NOEXCEPT_ {
+    aladu_shadow_driver_.SourcePlayAtTimevSOFT(n, sources, start_time);
+    aladu_shadow_mark_stale_v_(n, sources);
+}
+static void AL_APIENTRY aladu_shadow_source_queue_buffers_ (ALuint source, ALsizei nb, const ALuint *buffers) ALADU_NOEXCEPT_ {
+    aladu_shadow_driver_.SourceQueueBuffers(source, nb, buffers);
+    aladu_shadow_mark_stale_(source);
+}
+static void AL_APIENTRY aladu_shadow_source_unqueue_buffers_ (ALuint source, ALsizei nb, ALuint *buffers) ALADU_NOEXCEPT_ {
+    aladu_shadow_driver_.SourceUnqueueBuffers(source, nb, buffers);
+    aladu_shadow_mark_stale_(source);
+}
+static void AL_APIENTRY aladu_shadow_listenerf_ (ALenum param, ALfloat value) ALADU_NOEXCEPT_ {
+    aladu_shadow_driver_.Listenerf(param, value);
+    aladu_shadow_listener_store_(param, 1, &value, nullptr);
+}
+static void AL_APIENTRY aladu_shadow_listener3f_ (ALenum param, ALfloat value1, ALfloat value2, ALfloat value3) ALADU_NOEXCEPT_ {
+    ALfloat values[3];
+    values[0] = value1; values[1] = value2; values[2] = value3;
+    aladu_shadow_driver_.Listener3f(param, value1, value2, value3);
+    aladu_shadow_listener_store_(param, 3, values, nullptr);
+}
+static void AL_APIENTRY aladu_shadow_listenerfv_ (ALenum param, const ALfloat *values) ALADU_NOEXCEPT_ {
+    aladu_shadow_driver_.Listenerfv(param, values);
+    if (values != nullptr) aladu_shadow_listener_store_(param, -1, values, nullptr);
+}
+static void AL_APIENTRY aladu_shadow_listener3i_ (ALenum param, ALint value1, ALint value2, ALint value3) ALADU_NOEXCEPT_ {
+    ALint values[3];
+    values[0] = value1; values[1] = value2; values[2] = value3;
+    aladu_shadow_driver_.Listener3i(param, value1, value2, value3);
+    aladu_shadow_listener_store_(param, 3, nullptr, values);
+}
+static void AL_APIENTRY aladu_shadow_listeneriv_ (ALenum param, const ALint *values) ALADU_NOEXCEPT_ {
+    aladu_shadow_driver_.Listeneriv(param, values);
+    if (values != nullptr) aladu_shadow_listener_store_(param, -1, nullptr, values);
+}
+static void AL_APIENTRY aladu_shadow_get_listenerf_ (ALenum param, ALfloat *value) ALADU_NOEXCEPT_ {
+    if (value == nullptr || !aladu_shadow_listener_load_(param, 1, value)) aladu_shadow_driver_.GetListenerf(param, value);
+}
+static void AL_APIENTRY aladu_shadow_get_listener3f_ (ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3) ALADU_NOEXCEPT_ {
+    ALfloat values[3];
+    if (value1 == nullptr || value2 == nullptr || value3 == nullptr || !aladu_shadow_listener_load_(param, 3, values)) {
+        aladu_shadow_driver_.GetListener3f(param, value1, value2, value3);
+        return;
+    }
+    *value1 = values[0]; *value2 = values[1]; *value3 = values[2];
+}
+static void AL_APIENTRY aladu_shadow_get_listenerfv_ (ALenum param, ALfloat *values) ALADU_NOEXCEPT_ {
+    if (values == nullptr || !aladu_shadow_listener_load_(param, -1, values)) aladu_shadow_driver_.GetListenerfv(param, values);
+}
+
+/* only wraps what the active table has, so that missing functions stay NULL; with ALAD_LAZY_LOADING, the wrapped member is resolved in the
+   driver's copy first, so the wrapper doesn't go through a trampoline on every call and a function that turns out to be missing isn't wrapped */
+#define ALADU_WRAP_(table, driver, member, wrapper)                                                                              \
+    do {                                                                                                                          \
+        aladResolveFunction(&(driver), offsetof(aladALFunctions, member));                                                        \
+        if ((driver).member != nullptr) (table).member = wrapper;                                                                 \
+    } while (0)
+
+/* wraps the table aladAL points to, when the shadow is enabled, again when it is enabled after aladAL was pointed elsewhere, and after
+   aladLoadAL and aladUpdateAL */
+static void aladu_shadow_reset_ (ALCcontext *context);
+static void aladu_shadow_wrap_ (void) {
+    ALCcontext *context = aladALC.GetCurrentContext != nullptr ? aladALC.GetCurrentContext() : nullptr;
+    if (context != aladu_shadow_.context) aladu_shadow_reset_(context);
+    aladu_shadow_.previous = aladActiveAL;
+    aladu_shadow_driver_ = aladAL;
+    aladu_shadow_table_ = aladAL;
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, GenSources,               aladu_shadow_gen_sources_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, DeleteSources,            aladu_shadow_delete_sources_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, Sourcef,                  aladu_shadow_sourcef_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, Source3f,                 aladu_shadow_source3f_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, Sourcefv,                 aladu_shadow_sourcefv_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, Sourcei,                  aladu_shadow_sourcei_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, Source3i,                 aladu_shadow_source3i_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, Sourceiv,                 aladu_shadow_sourceiv_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, GetSourcef,               aladu_shadow_get_sourcef_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, GetSource3f,              aladu_shadow_get_source3f_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, GetSourcefv,              aladu_shadow_get_sourcefv_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, GetSourcei,               aladu_shadow_get_sourcei_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, GetSourceiv,              aladu_shadow_get_sourceiv_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, SourcePlay,               aladu_shadow_source_play_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, SourceStop,               aladu_shadow_source_stop_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, SourceRewind,             aladu_shadow_source_rewind_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, SourcePause,              aladu_shadow_source_pause_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, SourcePlayv,              aladu_shadow_source_playv_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, SourceStopv,              aladu_shadow_source_stopv_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, SourceRewindv,            aladu_shadow_source_rewindv_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, SourcePausev,             aladu_shadow_source_pausev_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, SourcePlayAtTimeSOFT,     aladu_shadow_source_play_at_time_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, SourcePlayAtTimevSOFT,    aladu_shadow_source_play_at_timev_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, SourceQueueBuffers,       aladu_shadow_source_queue_buffers_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, SourceUnqueueBuffers,     aladu_shadow_source_unqueue_buffers_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, Listenerf,                aladu_shadow_listenerf_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, Listener3f,               aladu_shadow_listener3f_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, Listenerfv,               aladu_shadow_listenerfv_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, Listener3i,               aladu_shadow_listener3i_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, Listeneriv,               aladu_shadow_listeneriv_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, GetListenerf,             aladu_shadow_get_listenerf_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, GetListener3f,            aladu_shadow_get_listener3f_);
+    ALADU_WRAP_(aladu_shadow_table_, aladu_shadow_driver_, GetListenerfv,            aladu_shadow_get_listenerfv_);
+    aladu_register_layer_(0, &aladu_shadow_table_, &aladu_shadow_.previous, aladu_shadow_wrap_);
+    aladActivateFunctions(&aladu_shadow_table_);
+}
+/* empties the cache for the sources of context, when the shadow is enabled and when it wraps a table on another context than before */
+static void aladu_shadow_reset_ (ALCcontext *context) {
+    ALsizei i;
+    size_t k;
+    memset(aladu_shadow_.keys, 0, (aladu_shadow_.mask + 1) * sizeof(aladu_shadow_key_));
+    for (i = 0; i < aladu_shadow_.capacity; i++) aladu_shadow_.free[i] = aladu_shadow_.capacity - 1 - i;
+    aladu_shadow_.freeCount = aladu_shadow_.capacity;
+    for (k = 0; k < ALADU_COUNT_OF_(aladu_shadow_listener_); k++) {
+        int c;
+        for (c = 0; c < aladu_shadow_listener_[k].count; c++) aladu_shadow_.listener[aladu_shadow_listener_[k].column + c] = aladu_shadow_listener_[k].initial;
+    }
+    aladu_shadow_.listener[9] = -1.0f;  /* AL_ORIENTATION: at (0, 0, -1) */
+    aladu_shadow_.listener[11] = 1.0f;  /*                 up (0, 1, 0)  */
+    aladu_shadow_.listenerUncached = 0;
+    aladu_shadow_.context = context;
+}
+ALboolean aladEnableShadow (ALsizei maxSources) {
+    size_t keys, bytes, k;
+    ALsizei capacity = maxSources > 0 ? maxSources : 1;
+    char *memory;
+    if (aladu_shadow_.keys != nullptr) {
+        if (!aladu_layer_reachable_(&aladu_shadow_table_)) aladu_shadow_wrap_();
+        return AL_TRUE;
+    }
+    keys = aladu_power_of_two_((size_t) capacity * 2);
+    bytes = keys * sizeof(aladu_shadow_key_) + (size_t) capacity * (sizeof(volatile long) + sizeof(ALuint) + sizeof(ALsizei)
+          + ALADU_SHADOW_FLOATS_ * sizeof(ALfloat) + (ALADU_SHADOW_INTS_ + 4) * sizeof(ALint));
+    memory = REINTERPRET_CAST(char*, calloc(1, bytes));
+    if (memory == nullptr) return AL_FALSE;
+    /* the columns go from the widest type down, so every one of them stays aligned */
+    aladu_shadow_.memory = memory;
+    aladu_shadow_.mask = keys - 1;
+    aladu_shadow_.keys = REINTERPRET_CAST(aladu_shadow_key_*, memory);                      memory += keys * sizeof(aladu_shadow_key_);
+    aladu_shadow_.stale = REINTERPRET_CAST(volatile long*, memory);                        memory += (size_t) capacity * sizeof(volatile long);
+    for (k = 0; k < ALADU_SHADOW_FLOATS_; k++) {
+        aladu_shadow_.floats[k] = REINTERPRET_CAST(ALfloat*, memory);                      memory += (size_t) capacity * sizeof(ALfloat);
+    }
+    for (k = 0; k < ALADU_SHADOW_INTS_; k++) {
+        aladu_shadow_.ints[k] = REINTERPRET_CAST(ALint*, memory);                          memory += (size_t) capacity * sizeof(ALint);
+    }
+    aladu_shadow_.state = REINTERPRET_CAST(ALint*, memory);                                memory += (size_t) capacity * sizeof(ALint);
+    aladu_shadow_.queued = REINTERPRET_CAST(ALint*, memory);                               memory += (size_t) capacity * sizeof(ALint);
+    aladu_shadow_.processed = REINTERPRET_CAST(ALint*, memory);                            memory += (size_t) capacity * sizeof(ALint);
+    aladu_shadow_.uncached = REINTERPRET_CAST(ALuint*, memory);                            memory += (size_t) capacity * sizeof(ALuint);
+    aladu_shadow_.ids = REINTERPRET_CAST(ALuint*, memory);                                 memory += (size_t) capacity * sizeof(ALuint);
+    aladu_shadow_.free = REINTERPRET_CAST(ALsizei*, memory);
+    aladu_shadow_.capacity = capacity;
+    aladu_shadow_reset_(aladALC.GetCurrentContext != nullptr ? aladALC.GetCurrentContext() : nullptr);
+
+    aladu_shadow_wrap_();
+    aladu_shadow_.events = aladu_enable_events_(&aladu_shadow_driver_, AL_TRUE);
+    aladu_shadow_.eventContext = aladu_shadow_.context;
+    return AL_TRUE;
+}
+void aladDisableShadow (void) {
+    if (aladu_shadow_.keys == nullptr) return;
+    /* the event thread stops finding keys first; setting the callback again then waits for an event that still has them */
+    aladu_shadow_.keys = nullptr;
+    if (aladu_shadow_.events) aladu_enable_events_(&aladu_shadow_driver_, AL_FALSE);
+    if (aladActiveAL == &aladu_shadow_table_) aladActivateFunctions(aladu_shadow_.previous);
+    /* layers enabled on top of the shadow still call its wrappers, which only call through from now on */
+    aladu_shadow_table_ = aladu_shadow_driver_;
+    aladu_layers_[0].table = nullptr;
+    free(aladu_shadow_.memory);
+    aladu_shadow_.memory = nullptr;
+    aladu_shadow_.events = AL_FALSE;
+}
+
+
+/*
+ * Filter: one record per source and buffer, found by id in an open addressing table (used is 0 for empty, -1 for removed entries), and
+ * one for the listener. A record keeps the last value of every parameter that only changes when it is set, as raw bits together with
+ * whether it was set as an int, so that the comparison is exact and a float write never matches an int one. Offsets, AL_BUFFER and the
+ * like are actions rather than state, so they are never filtered. Setting a parameter through a double or int64 setter, or through one
+ * that isn't filtered, only forgets its value. A value outside of min and max (or a fraction for an integral parameter) is one the
+ * driver rejects, so it only forgets the value as well, like the shadow doesn't cache it.
+ */
+typedef struct aladu_filter_param_ {
+    ALenum  param;
+    int     component;
+    int     count;
+    int     integral;
+    ALfloat min;
+    ALfloat max;
+} aladu_filter_param_;
+static const aladu_filter_param_ aladu_filter_source_params_[] = {
+    { AL_GAIN,                          0, 1, 0, 0.0f,     FLT_MAX },
+    { AL_PITCH,                         1, 1, 0, FLT_MIN,  FLT_MAX },
+    { AL_MIN_GAIN,                      2, 1, 0, 0.0f,     1.0f    },
+    { AL_MAX_GAIN,                      3, 1, 0, 0.0f,     1.0f    },
+    { AL_REFERENCE_DISTANCE,            4, 1, 0, 0.0f,     FLT_MAX },
+    { AL_ROLLOFF_FACTOR,                5, 1, 0, 0.0f,     FLT_MAX },
+    { AL_MAX_DISTANCE,                  6, 1, 0, 0.0f,     FLT_MAX },
+    { AL_CONE_INNER_ANGLE,              7, 1, 0, 0.0f,     360.0f  },
+    { AL_CONE_OUTER_ANGLE,              8, 1, 0, 0.0f,     360.0f  },
+    { AL_CONE_OUTER_GAIN,               9, 1, 0, 0.0f,     1.0f    },
+    { AL_POSITION,                     10, 3, 0, -FLT_MAX, FLT_MAX },
+    { AL_VELOCITY,                     13, 3, 0, -FLT_MAX, FLT_MAX },
+    { AL_DIRECTION,                    16, 3, 0, -FLT_MAX, FLT_MAX },
+    { AL_SOURCE_RELATIVE,              19, 1, 1, 0.0f,     1.0f    },
+    { AL_LOOPING,                      20, 1, 1, 0.0f,     1.0f    }
+};
+static const aladu_filter_param_ aladu_filter_listener_params_[] = {
+    { AL_GAIN,                          0, 1, 0, 0.0f,     FLT_MAX },
+    { AL_POSITION,                      1, 3, 0, -FLT_MAX, FLT_MAX },
+    { AL_VELOCITY,                      4, 3, 0, -FLT_MAX, FLT_MAX },
+    { AL_ORIENTATION,                   7, 6, 0, -FLT_MAX, FLT_MAX }
+};
+static const aladu_filter_param_ aladu_filter_buffer_params_[] = {
+    { AL_UNPACK_BLOCK_ALIGNMENT_SOFT,   0, 1, 1, 0.0f,                  FLT_MAX                },
+    { AL_PACK_BLOCK_ALIGNMENT_SOFT,     1, 1, 1, 0.0f,                  FLT_MAX                },
+    { AL_AMBISONIC_LAYOUT_SOFT,         2, 1, 1, (ALfloat) AL_FUMA_SOFT, (ALfloat) AL_ACN_SOFT  },
+    { AL_AMBISONIC_SCALING_SOFT,        3, 1, 1, (ALfloat) AL_FUMA_SOFT, (ALfloat) AL_N3D_SOFT  },
+    { AL_UNPACK_AMBISONIC_ORDER_SOFT,   4, 1, 1, 1.0f,                  FLT_MAX                }
+};
+#define ALADU_FILTER_COMPONENTS_ 21
+typedef char aladu_filter_value_size_check_[sizeof(ALfloat) == sizeof(ALuint) && sizeof(ALint) == sizeof(ALuint) ? 1 : -1];
+
+typedef struct aladu_filter_record_ {
+    ALuint          id;
+    int             used;
+    unsigned long   valid;
+    unsigned long   ints;
+    ALuint          values[ALADU_FILTER_COMPONENTS_];
+} aladu_filter_record_;
+typedef struct aladu_filter_map_ {
+    aladu_filter_record_   *records;
+    size_t                  mask;
+} aladu_filter_map_;
+typedef struct aladu_filter_t_ {
+    void                   *memory;
+    aladu_filter_map_       sources;
+    aladu_filter_map_       buffers;
+    aladu_filter_record_    listener;
+    aladFilterStatistics    statistics;
+    ALCcontext             *context;
+    aladALFunctions        *previous;
+} aladu_filter_t_;
+static aladu_filter_t_ aladu_filter_;
+static aladALFunctions aladu_filter_driver_;
+static aladALFunctions aladu_filter_table_;
+
+/* returns the live record of id, or with create a new one, or NULL if there is none or the table is full; only the generation of a source
+   or buffer creates one, so the writes to an id that was never generated (or before the filter was enabled) are passed on */
+static aladu_filter_record_* aladu_filter_find_ (aladu_filter_map_ *map, ALuint id, ALboolean create) {
+    aladu_filter_record_ *entry = nullptr;
+    size_t i, index;
+    if (map->records == nullptr) return nullptr;
+    index = aladu_hash_id_(id) & map->mask;
+    for (i = 0; i <= map->mask; i++, index = (index + 1) & map->mask) {
+        aladu_filter_record_ *record = &map->records[index];
+        if (record->used == 1 && record->id == id) return record;
+        if (entry == nullptr && record->used != 1) entry = record;
+        if (record->used == 0) break;
+    }
+    if (!create || entry == nullptr) return nullptr;
+    entry->id = id;
+    entry->used = 1;
+    entry->valid = 0;
+    entry->ints = 0;
+    return entry;
+}
+static void aladu_filter_forget_ (aladu_filter_map_ *map, ALsizei n, const ALuint *ids) {
+    ALsizei i;
+    if (ids == nullptr) return;
+    for (i = 0; i < n; i++) {
+        aladu_filter_record_ *record = aladu_filter_find_(map, ids[i], AL_FALSE);
+        size_t index;
+        if (record == nullptr) continue;
+        index = (size_t) (record - map->records);
+        /* the end of a probe chain doesn't need a tombstone */
+        record->used = map->records[(index + 1) & map->mask].used == 0 ? 0 : -1;
+    }
+}
+/* the driver leaves the array alone on errors, so it is cleared before, and only the ids that aren't 0 afterwards are new; those of another
+   context than the filter's are not its objects */
+static void aladu_filter_track_ (aladu_filter_map_ *map, ALsizei n, const ALuint *ids) {
+    ALsizei i;
+    aladu_filter_forget_(map, n, ids);
+    if (ids == nullptr || (aladALC.GetCurrentContext != nullptr && aladALC.GetCurrentContext() != aladu_filter_.context)) return;
+    for (i = 0; i < n; i++) {
+        if (ids[i] != 0) aladu_filter_find_(map, ids[i], AL_TRUE);
+    }
+}
+static int aladu_filter_param_index_ (const aladu_filter_param_ *params, size_t count, ALenum param) {
+    size_t i;
+    for (i = 0; i < count; i++) {
+        if (params[i].param == param) return (int) i;
+    }
+    return -1;
+}
+static void aladu_filter_invalidate_ (aladu_filter_record_ *record, const aladu_filter_param_ *params, size_t count, ALenum param);
+/* whether the driver accepts all components of a value, like aladu_shadow_accepts_ */
+static ALboolean aladu_filter_accepts_ (const aladu_filter_param_ *entry, ALboolean isInt, const void *values) {
+    int c;
+    for (c = 0; c < entry->count; c++) {
+        ALfloat value = isInt ? (ALfloat) REINTERPRET_CAST(const ALint*, values)[c] : REINTERPRET_CAST(const ALfloat*, values)[c];
+        if (!(value >= entry->min && value <= entry->max)) return AL_FALSE;
+        if (entry->integral && !isInt && (ALfloat) (ALint) value != value) return AL_FALSE;
+    }
+    return AL_TRUE;
+}
+/* n is the number of values the setter takes, -1 for the vector ones; returns AL_FALSE if the write can be dropped */
+static ALboolean aladu_filter_pass_ (aladu_filter_record_ *record, const aladu_filter_param_ *params, size_t count,
+                                     ALenum param, ALboolean isInt, ALsizei n, const void *values) {
+    ALuint bits[ALADU_FILTER_COMPONENTS_];
+    unsigned long bit;
+    int index;
+    if (aladu_filter_.memory == nullptr) return AL_TRUE;
+    /* the records are those of the filter's context; a write to another one (like the listeners of openal-explicit-polyfill.h) goes
+       through, and only forgets the value, since the buffers are shared by the contexts of a device */
+    if (aladALC.GetCurrentContext != nullptr && aladALC.GetCurrentContext() != aladu_filter_.context) {
+        aladu_filter_invalidate_(record, params, count, param);
+        return AL_TRUE;
+    }
+    aladu_filter_.statistics.writes++;
+    if (record == nullptr || values == nullptr) return AL_TRUE;
+    index = aladu_filter_param_index_(params, count, param);
+    if (index < 0) return AL_TRUE;
+    if (n >= 0 && n != params[index].count) {
+        record->valid &= ~(1UL << index);
+        return AL_TRUE;
+    }
+    bit = 1UL << index;
+    if (!aladu_filter_accepts_(&params[index], isInt, values)) {
+        record->valid &= ~bit;
+        return AL_TRUE;
+    }
+    memcpy(bits, values, (size_t) params[index].count * sizeof(ALuint));
+    if ((record->valid & bit) != 0 && ((record->ints & bit) != 0) == (isInt != AL_FALSE)
+     && memcmp(&record->values[params[index].component], bits, (size_t) params[index].count * sizeof(ALuint)) == 0) {
+        aladu_filter_.statistics.dropped++;
+        return AL_FALSE;
+    }
+    memcpy(&record->values[params[index].component], bits, (size_t) params[index].count * sizeof(ALuint));
+    record->valid |= bit;
+    if (isInt) record->ints |= bit;
+    else record->ints &= ~bit;
+    return AL_TRUE;
+}
+static void aladu_filter_invalidate_ (aladu_filter_record_ *record, const aladu_filter_param_ *params, size_t count, ALenum param) {
+    int index;
+    if (record == nullptr) return;
+    index = aladu_filter_param_index_(params, count, param);
+    if (index >= 0) record->valid &= ~(1UL << index);
+}
+static ALboolean aladu_filter_source_ (ALuint source, ALenum param, ALboolean isInt, ALsizei n, const void *values) {
+    return aladu_filter_pass_(aladu_filter_find_(&aladu_filter_.sources, source, AL_FALSE), aladu_filter_source_params_,
+                              ALADU_COUNT_OF_(aladu_filter_source_params_), param, isInt, n, values);
+}
+static ALboolean aladu_filter_listener_ (ALenum param, ALboolean isInt, ALsizei n, const void *values) {
+    return aladu_filter_pass_(aladu_filter_.memory != nullptr ? &aladu_filter_.listener : nullptr, aladu_filter_listener_params_,
+                              ALADU_COUNT_OF_(aladu_filter_listener_params_), param, isInt, n, values);
+}
+static void aladu_filter_source_changed_ (ALuint source, ALenum param) {
+    aladu_filter_invalidate_(aladu_filter_find_(&aladu_filter_.sources, source, AL_FALSE), aladu_filter_source_params_,
+                             ALADU_COUNT_OF_(aladu_filter_source_params_), param);
+}
+
+/* the wrappers of the filter table */
+static void AL_APIENTRY aladu_filter_gen_sources_ (ALsizei n, ALuint *sources) ALADU_NOEXCEPT_ {
+    if (sources != nullptr && n > 0) memset(sources, 0, (size_t) n * sizeof(ALuint));
+    aladu_filter_driver_.GenSources(n, sources);
+    aladu_filter_track_(&aladu_filter_.sources, n, sources);
+}
+static void AL_APIENTRY aladu_filter_delete_sources_ (ALsizei n, const ALuint *sources) ALADU_NOEXCEPT_ {
+    aladu_filter_driver_.DeleteSources(n, sources);
+    aladu_filter_forget_(&aladu_filter_.sources, n, sources);
+}
+static void AL_APIENTRY aladu_filter_gen_buffers_ (ALsizei n, ALuint *buffers) ALADU_NOEXCEPT_ {
+    if (buffers != nullptr && n > 0) memset(buffers, 0, (size_t) n * sizeof(ALuint));
+    aladu_filter_driver_.GenBuffers(n, buffers);
+    aladu_filter_track_(&aladu_filter_.buffers, n, buffers);
+}
+static void AL_APIENTRY aladu_filter_delete_buffers_ (ALsizei n, const ALuint *buffers) ALADU_NOEXCEPT_ {
+    aladu_filter_driver_.DeleteBuffers(n, buffers);
+    aladu_filter_forget_(&aladu_filter_.buffers, n, buffers);
+}
+static void AL_APIENTRY aladu_filter_sourcef_ (ALuint source, ALenum param, ALfloat value) ALADU_NOEXCEPT_ {
+    if (aladu_filter_source_(source, param, AL_FALSE, 1, &value)) aladu_filter_driver_.Sourcef(source, param, value);
+}
+static void AL_APIENTRY aladu_filter_source3f_ (ALuint source, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3) ALADU_NOEXCEPT_ {
+    ALfloat values[3];
+    values[0] = value1; values[1] = value2; values[2] = value3;
+    if (aladu_filter_source_(source, param, AL_FALSE, 3, values)) aladu_filter_driver_.Source3f(source, param, value1, value2, value3);
+}
+static void AL_APIENTRY aladu_filter_sourcefv_ (ALuint source, ALenum param, const ALfloat *values) ALADU_NOEXCEPT_ {
+    if (aladu_filter_source_(source, param, AL_FALSE, -1, values)) aladu_filter_driver_.Sourcefv(source, param, values);
+}
+static void AL_APIENTRY aladu_filter_sourcei_ (ALuint source, ALenum param, ALint value) ALADU_NOEXCEPT_ {
+    if (aladu_filter_source_(source, param, AL_TRUE, 1, &value)) aladu_filter_driver_.Sourcei(source, param, value);
+}
+static void AL_APIENTRY aladu_filter_source3i_ (ALuint source, ALenum param, ALint value1, ALint value2, ALint value3) ALADU_NOEXCEPT_ {
+    ALint values[3];
+    values[0] = value1; values[1] = value2; values[2] = value3;
+    if (aladu_filter_source_(source, param, AL_TRUE, 3, values)) aladu_filter_driver_.Source3i(source, param, value1, value2, value3);
+}
+static void AL_APIENTRY aladu_filter_sourceiv_ (ALuint source, ALenum param, const ALint *values) ALADU_NOEXCEPT_ {
+    if (aladu_filter_source_(source, param, AL_TRUE, -1, values)) aladu_filter_driver_.Sourceiv(source, param, values);
+}
+static void AL_APIENTRY aladu_filter_sourced_ (ALuint source, ALenum param, ALdouble value) ALADU_NOEXCEPT_ {
+    aladu_filter_source_changed_(source, param);
+    aladu_filter_driver_.SourcedSOFT(source, param, value);
+}
+static void AL_APIENTRY aladu_filter_source3d_ (ALuint source, ALenum param, ALdouble value1, ALdouble value2, ALdouble value3) ALADU_NOEXCEPT_ {
+    aladu_filter_source_changed_(source, param);
+    aladu_filter_driver_.Source3dSOFT(source, param, value1, value2, value3);
+}
+static void AL_APIENTRY aladu_filter_sourcedv_ (ALuint source, ALenum param, const ALdouble *values) ALADU_NOEXCEPT_ {
+    aladu_filter_source_changed_(source, param);
+    aladu_filter_driver_.SourcedvSOFT(source, param, values);
+}
+static void AL_APIENTRY aladu_filter_sourcei64_ (ALuint source, ALenum param, ALint64SOFT value) ALADU_NOEXCEPT_ {
+    aladu_filter_source_changed_(source, param);
+    aladu_filter_driver_.Sourcei64SOFT(source, param, value);
+}
+static void AL_APIENTRY aladu_filter_source3i64_ (ALuint source, ALenum param, ALint64SOFT value1, ALint64SOFT value2, ALint64SOFT value3) ALADU_NOEXCEPT_ {
+    aladu_filter_source_changed_(source, param);
+    aladu_filter_driver_.Source3i64SOFT(source, param, value1, value2, value3);
+}
+static void AL_APIENTRY aladu_filter_sourcei64v_ (ALuint source, ALenum param, const ALint64SOFT *values) ALADU_NOEXCEPT_ {
+    aladu_filter_source_changed_(source, param);
+    aladu_filter_driver_.Sourcei64vSOFT(source, param, values);
+}
+static void AL_APIENTRY aladu_filter_listenerf_ (ALenum param, ALfloat value) ALADU_NOEXCEPT_ {
+    if (aladu_filter_listener_(param, AL_FALSE, 1, &value)) aladu_filter_driver_.Listenerf(param, value);
+}
+static void AL_APIENTRY aladu_filter_listener3f_ (ALenum param, ALfloat value1, ALfloat value2, ALfloat value3) ALADU_NOEXCEPT_ {
+    ALfloat values[3];
+    values[0] = value1; values[1] = value2; values[2] = value3;
+    if (aladu_filter_listener_(param, AL_FALSE, 3, values)) aladu_filter_driver_.Listener3f(param, value1, value2, value3);
+}
+static void AL_APIENTRY aladu_filter_listenerfv_ (ALenum param, const ALfloat *values) ALADU_NOEXCEPT_ {
+    if (aladu_filter_listener_(param, AL_FALSE, -1, values)) aladu_filter_driver_.Listenerfv(param, values);
+}
+static void AL_APIENTRY aladu_filter_listeneri_ (ALenum param, ALint value) ALADU_NOEXCEPT_ {
+    if (aladu_filter_listener_(param, AL_TRUE, 1, &value)) aladu_filter_driver_.Listeneri(param, value);
+}
+static void AL_APIENTRY aladu_filter_listener3i_ (ALenum param, ALint value1, ALint value2, ALint value3) ALADU_NOEXCEPT_ {
+    ALint values[3];
+    values[0] = value1; values[1] = value2; values[2] = value3;
+    if (aladu_filter_listener_(param, AL_TRUE, 3, values)) aladu_filter_driver_.Listener3i(param, value1, value2, value3);
+}
+static void AL_APIENTRY aladu_filter_listeneriv_ (ALenum param, const ALint *values) ALADU_NOEXCEPT_ {
+    if (aladu_filter_listener_(param, AL_TRUE, -1, values)) aladu_filter_driver_.Listeneriv(param, values);
+}
+static void AL_APIENTRY aladu_filter_bufferi_ (ALuint buffer, ALenum param, ALint value) ALADU_NOEXCEPT_ {
+    if (aladu_filter_pass_(aladu_filter_find_(&aladu_filter_.buffers, buffer, AL_FALSE), aladu_filter_buffer_params_,
+                           ALADU_COUNT_OF_(aladu_filter_buffer_params_), param, AL_TRUE, 1, &value)) aladu_filter_driver_.Bufferi(buffer, param, value);
+}
+static void AL_APIENTRY aladu_filter_bufferiv_ (ALuint buffer, ALenum param, const ALint *values) ALADU_NOEXCEPT_ {
+    aladu_filter_invalidate_(aladu_filter_find_(&aladu_filter_.buffers, buffer, AL_FALSE), aladu_filter_buffer_params_,
+                             ALADU_COUNT_OF_(aladu_filter_buffer_params_), param);
+    aladu_filter_driver_.Bufferiv(buffer, param, values);
+}
+
+/* wraps the table aladAL points to, like aladu_shadow_wrap_; on another context than before, the records no longer apply */
+static void aladu_filter_wrap_ (void) {
+    ALCcontext *context = aladALC.GetCurrentContext != nullptr ? aladALC.GetCurrentContext() : nullptr;
+    if (context != aladu_filter_.context) {
+        memset(aladu_filter_.sources.records, 0, (aladu_filter_.sources.mask + 1) * sizeof(aladu_filter_record_));
+        memset(aladu_filter_.buffers.records, 0, (aladu_filter_.buffers.mask + 1) * sizeof(aladu_filter_record_));
+        aladu_filter_.listener.valid = 0;
+        aladu_filter_.context = context;
+    }
+    aladu_filter_.previous = aladActiveAL;
+    aladu_filter_driver_ = aladAL;
+    aladu_filter_table_ = aladAL;
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, GenSources,               aladu_filter_gen_sources_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, DeleteSources,            aladu_filter_delete_sources_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, GenBuffers,               aladu_filter_gen_buffers_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, DeleteBuffers,            aladu_filter_delete_buffers_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, Sourcef,                  aladu_filter_sourcef_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, Source3f,                 aladu_filter_source3f_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, Sourcefv,                 aladu_filter_sourcefv_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, Sourcei,                  aladu_filter_sourcei_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, Source3i,                 aladu_filter_source3i_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, Sourceiv,                 aladu_filter_sourceiv_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, SourcedSOFT,              aladu_filter_sourced_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, Source3dSOFT,             aladu_filter_source3d_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, SourcedvSOFT,             aladu_filter_sourcedv_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, Sourcei64SOFT,            aladu_filter_sourcei64_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, Source3i64SOFT,           aladu_filter_source3i64_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, Sourcei64vSOFT,           aladu_filter_sourcei64v_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, Listenerf,                aladu_filter_listenerf_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, Listener3f,               aladu_filter_listener3f_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, Listenerfv,               aladu_filter_listenerfv_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, Listeneri,                aladu_filter_listeneri_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, Listener3i,               aladu_filter_listener3i_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, Listeneriv,               aladu_filter_listeneriv_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, Bufferi,                  aladu_filter_bufferi_);
+    ALADU_WRAP_(aladu_filter_table_, aladu_filter_driver_, Bufferiv,                 aladu_filter_bufferiv_);
+    aladu_register_layer_(1, &aladu_filter_table_, &aladu_filter_.previous, aladu_filter_wrap_);
+    aladActivateFunctions(&aladu_filter_table_);
+}
+ALboolean aladEnableFilter (ALsizei maxSources, ALsizei maxBuffers) {
+    size_t sources, buffers;
+    if (aladu_filter_.memory != nullptr) {
+        if (!aladu_layer_reachable_(&aladu_filter_table_)) aladu_filter_wrap_();
+        return AL_TRUE;
+    }
+    sources = aladu_power_of_two_((size_t) (maxSources > 0 ? maxSources : 1) * 2);
+    buffers = aladu_power_of_two_((size_t) (maxBuffers > 0 ? maxBuffers : 1) * 2);
+    aladu_filter_.memory = calloc(sources + buffers, sizeof(aladu_filter_record_));
+    if (aladu_filter_.memory == nullptr) return AL_FALSE;
+    aladu_filter_.sources.records = REINTERPRET_CAST(aladu_filter_record_*, aladu_filter_.memory);
+    aladu_filter_.sources.mask = sources - 1;
+    aladu_filter_.buffers.records = aladu_filter_.sources.records + sources;
+    aladu_filter_.buffers.mask = buffers - 1;
+    aladu_filter_.listener.valid = 0;
+    aladu_filter_.statistics.writes = 0;
+    aladu_filter_.statistics.dropped = 0;
+    aladu_filter_.context = aladALC.GetCurrentContext != nullptr ? aladALC.GetCurrentContext() : nullptr;
+    aladu_filter_wrap_();
+    return AL_TRUE;
+}
+void aladDisableFilter (void) {
+    if (aladu_filter_.memory == nullptr) return;
+    if (aladActiveAL == &aladu_filter_table_) aladActivateFunctions(aladu_filter_.previous);
+    aladu_filter_table_ = aladu_filter_driver_;
+    aladu_layers_[1].table = nullptr;
+    aladu_filter_.sources.records = nullptr;
+    aladu_filter_.buffers.records = nullptr;
+    free(aladu_filter_.memory);
+    aladu_filter_.memory = nullptr;
+}
+aladFilterStatistics aladGetFilterStatistics (ALboolean reset) {
+    aladFilterStatistics statistics = aladu_filter_.statistics;
+    if (reset) {
+        aladu_filter_.statistics.writes = 0;
+        aladu_filter_.statistics.dropped = 0;
+    }
+    return statistics;
+}
+
+
+/*
+ * Bulk transform updates: a motion keeps, per index, the source that was there in the last update and its position, so that the velocity
+ * is one subtraction and multiplication per coordinate, done on whole vectors where the compiler targets SSE, AVX or NEON. An index whose
+ * source changed gets a velocity of 0, like a teleport. The arrays grow as needed and are never shrunk until the motion is destroyed.
+ */
+#if defined(__AVX__)
+#include <immintrin.h>
+#define ALADU_SIMD_AVX_
+#elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define ALADU_SIMD_SSE_
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define ALADU_SIMD_NEON_
+#endif
+
+struct aladSourceMotion {
+    ALsizei  capacity;
+    ALsizei  count;
+    ALuint  *sources;
+    ALfloat *last[3];
+    ALfloat *velocity[3];
+};
+static aladSourceMotion aladu_default_motion_;
+
+/* velocity = (position - last) * scale and last = position, for one coordinate of n sources */
+static void aladu_derive_velocity_ (ALsizei n, const ALfloat *position, ALfloat *last, ALfloat *velocity, ALfloat scale) {
+    ALsizei i = 0;
+#if defined(ALADU_SIMD_AVX_)
+    __m256 factor = _mm256_set1_ps(scale);
+    for (; i + 8 <= n; i += 8) {
+        __m256 current = _mm256_loadu_ps(position + i);
+        _mm256_storeu_ps(velocity + i, _mm256_mul_ps(_mm256_sub_ps(current, _mm256_loadu_ps(last + i)), factor));
+        _mm256_storeu_ps(last + i, current);
+    }
+#elif defined(ALADU_SIMD_SSE_)
+    __m128 factor = _mm_set1_ps(scale);
+    for (; i + 4 <= n; i += 4) {
+        __m128 current = _mm_loadu_ps(position + i);
+        _mm_storeu_ps(velocity + i, _mm_mul_ps(_mm_sub_ps(current, _mm_loadu_ps(last + i)), factor));
+        _mm_storeu_ps(last + i, current);
+    }
+#elif defined(ALADU_SIMD_NEON_)
+    float32x4_t factor = vdupq_n_f32(scale);
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t current = vld1q_f32(position + i);
+        vst1q_f32(velocity + i, vmulq_f32(vsubq_f32(current, vld1q_f32(last + i)), factor));
+        vst1q_f32(last + i, current);
+    }
+#endif
+    for (; i < n; i++) {
+        velocity[i] = (position[i] - last[i]) * scale;
+        last[i] = position[i];
+    }
+}
+static ALboolean aladu_reserve_motion_ (aladSourceMotion *motion, ALsizei n) {
+    ALuint *sources;
+    int c;
+    if (n <= motion->capacity) return AL_TRUE;
+    sources = REINTERPRET_CAST(ALuint*, realloc(motion->sources, (size_t) n * sizeof(ALuint)));
+    if (sources == nullptr) return AL_FALSE;
+    motion->sources = sources;
+    for (c = 0; c < 3; c++) {
+        ALfloat *last = REINTERPRET_CAST(ALfloat*, realloc(motion->last[c], (size_t) n * sizeof(ALfloat)));
+        ALfloat *velocity;
+        if (last == nullptr) return AL_FALSE;
+        motion->last[c] = last;
+        velocity = REINTERPRET_CAST(ALfloat*, realloc(motion->velocity[c], (size_t) n * sizeof(ALfloat)));
+        if (velocity == nullptr) return AL_FALSE;
+        motion->velocity[c] = velocity;
+    }
+    motion->capacity = n;
+    return AL_TRUE;
+}
+
+aladSourceMotion* aladCreateSourceMotion (void) {
+    return REINTERPRET_CAST(aladSourceMotion*, calloc(1, sizeof(aladSourceMotion)));
+}
+void aladDestroySourceMotion (aladSourceMotion *motion) {
+    int c;
+    aladSourceMotion *target = motion != nullptr ? motion : &aladu_default_motion_;
+    free(target->sources);
+    for (c = 0; c < 3; c++) {
+        free(target->last[c]);
+        free(target->velocity[c]);
+    }
+    if (motion != nullptr) free(motion);
+    else memset(&aladu_default_motion_, 0, sizeof(aladu_default_motion_));
+}
+ALboolean aladUpdateSourcesEx (aladSourceMotion *motion, ALsizei n, const ALuint *sources, const ALfloat *px, const ALfloat *py, const ALfloat *pz, ALfloat dt) {
+    const ALfloat *positions[3];
+    ALboolean derived;
+    ALCcontext *frame;
+    ALsizei i;
+    int c;
+    if (n <= 0 || sources == nullptr || px == nullptr || py == nullptr || pz == nullptr || aladAL.Source3f == nullptr) return AL_FALSE;
+    if (motion == nullptr) motion = &aladu_default_motion_;
+    positions[0] = px; positions[1] = py; positions[2] = pz;
+    derived = aladu_reserve_motion_(motion, n);
+    if (derived) {
+        /* the indices past the last call's count hold whatever an earlier, longer call left there, so they count as new and get a velocity of 0 */
+        if (n > motion->count) memset(motion->sources + motion->count, 0, (size_t) (n - motion->count) * sizeof(ALuint));
+        motion->count = n;
+        for (c = 0; c < 3; c++) aladu_derive_velocity_(n, positions[c], motion->last[c], motion->velocity[c], dt > 0.0f ? 1.0f / dt : 0.0f);
+        for (i = 0; i < n; i++) {
+            if (motion->sources[i] == sources[i]) continue;
+            motion->velocity[0][i] = motion->velocity[1][i] = motion->velocity[2][i] = 0.0f;
+            motion->sources[i] = sources[i];
+        }
+    }
+    frame = aladBeginFrame(nullptr);
+    for (i = 0; i < n; i++) {
+        aladAL.Source3f(sources[i], AL_POSITION, px[i], py[i], pz[i]);
+        if (derived) aladAL.Source3f(sources[i], AL_VELOCITY, motion->velocity[0][i], motion->velocity[1][i], motion->velocity[2][i]);
+    }
+    aladEndFrame(frame);
+    return derived;
+}
+ALboolean aladUpdateSources (ALsizei n, const ALuint *sources, const ALfloat *px, const ALfloat *py, const ALfloat *pz, ALfloat dt) {
+    return aladUpdateSourcesEx(nullptr, n, sources, px, py, pz, dt);
+}
+
+
+/*
+ * Source pool: two Treiber stacks of indices into the sorted source ids, one of reset sources ready to be acquired and one of released
+ * sources waiting for aladRecycleSources. A head holds the index + 1 of the top in its low 32 bits and a tag in the high ones, which
+ * every change increments, so a head that was popped and pushed again in between doesn't compare equal. Reading the next index of a
+ * node another thread popped meanwhile is harmless for the same reason, the exchange fails and the loop starts over.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+static ALint64SOFT aladu_atomic_load64_ (volatile ALint64SOFT *p)    { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+static ALboolean aladu_atomic_cas64_ (volatile ALint64SOFT *p, ALint64SOFT expected, ALint64SOFT desired) {
+    return __atomic_compare_exchange_n(p, &expected, desired, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) ? AL_TRUE : AL_FALSE;
+}
+#elif defined(_MSC_VER)
+static ALint64SOFT aladu_atomic_load64_ (volatile ALint64SOFT *p)    { return _InterlockedCompareExchange64(p, 0, 0); }
+static ALboolean aladu_atomic_cas64_ (volatile ALint64SOFT *p, ALint64SOFT expected, ALint64SOFT desired) {
+    return _InterlockedCompareExchange64(p, desired, expected) == expected ? AL_TRUE : AL_FALSE;
+}
+#else
+static ALint64SOFT aladu_atomic_load64_ (volatile ALint64SOFT *p)    { return *p; }
+static ALboolean aladu_atomic_cas64_ (volatile ALint64SOFT *p, ALint64SOFT expected, ALint64SOFT desired) {
+    if (*p != expected) return AL_FALSE;
+    *p = desired;
+    return AL_TRUE;
+}
+#endif
+#define ALADU_STACK_TOP_(head)        ((long) ((head) & 0xFFFFFFFF))
+#define ALADU_STACK_HEAD_(head, top)  ((ALint64SOFT) ((((ALuint64SOFT) (head) >> 32) + 1) << 32 | (ALuint64SOFT) (top)))
+
+struct aladSourcePool {
+    ALsizei                 count;
+    ALuint                 *sources;
+    volatile long          *next;
+    volatile long          *acquired;
+    ALuint                 *scratch;
+    volatile ALint64SOFT    free;
+    volatile ALint64SOFT    released;
+};
+
+/* pushes the chain first .. last, which are already linked, as one */
+static void aladu_stack_push_ (aladSourcePool *pool, volatile ALint64SOFT *stack, long first, long last) {
+    ALint64SOFT head;
+    do {
+        head = aladu_atomic_load64_(stack);
+        aladu_atomic_store_long_(&pool->next[last - 1], ALADU_STACK_TOP_(head));
+    } while (!aladu_atomic_cas64_(stack, head, ALADU_STACK_HEAD_(head, first)));
+}
+/* pops up to n nodes into indices (index + 1 each), returns how many */
+static ALsizei aladu_stack_pop_ (aladSourcePool *pool, volatile ALint64SOFT *stack, ALsizei n, long *indices) {
+    for (;;) {
+        ALint64SOFT head = aladu_atomic_load64_(stack);
+        long top = ALADU_STACK_TOP_(head);
+        ALsizei popped;
+        for (popped = 0; popped < n && top > 0 && top <= pool->count; popped++) {
+            indices[popped] = top;
+            top = aladu_atomic_load_long_(&pool->next[top - 1]);
+        }
+        if (popped == 0) return 0;
+        if (aladu_atomic_cas64_(stack, head, ALADU_STACK_HEAD_(head, top))) return popped;
+    }
+}
+static int aladu_compare_ids_ (const void *a, const void *b) {
+    ALuint x = *REINTERPRET_CAST(const ALuint*, a), y = *REINTERPRET_CAST(const ALuint*, b);
+    return (x > y) - (x < y);
+}
+/* returns the index + 1 of a pooled source, or 0 */
+static long aladu_pool_index_ (const aladSourcePool *pool, ALuint source) {
+    ALsizei low = 0, high = pool->count;
+    while (low < high) {
+        ALsizei middle = low + (high - low) / 2;
+        if (pool->sources[middle] < source) low = middle + 1;
+        else high = middle;
+    }
+    return low < pool->count && pool->sources[low] == source ? (long) low + 1 : 0;
+}
+
+aladSourcePool* aladCreateSourcePool (ALsizei count) {
+    aladSourcePool *pool;
+    char *memory;
+    ALsizei i;
+    if (count <= 0 || aladAL.GenSources == nullptr || aladAL.GetError == nullptr) return nullptr;
+    pool = REINTERPRET_CAST(aladSourcePool*, calloc(1, sizeof(aladSourcePool) + (size_t) count * (2 * sizeof(volatile long) + 2 * sizeof(ALuint))));
+    if (pool == nullptr) return nullptr;
+    memory = REINTERPRET_CAST(char*, (pool + 1));
+    pool->next = REINTERPRET_CAST(volatile long*, memory);         memory += (size_t) count * sizeof(volatile long);
+    pool->acquired = REINTERPRET_CAST(volatile long*, memory);     memory += (size_t) count * sizeof(volatile long);
+    pool->sources = REINTERPRET_CAST(ALuint*, memory);              memory += (size_t) count * sizeof(ALuint);
+    pool->scratch = REINTERPRET_CAST(ALuint*, memory);
+    pool->count = count;
+    aladAL.GetError();
+    aladAL.GenSources(count, pool->sources);
+    if (aladAL.GetError() != AL_NO_ERROR) {
+        free(pool);
+        return nullptr;
+    }
+    qsort(pool->sources, (size_t) count, sizeof(ALuint), aladu_compare_ids_);
+    for (i = 0; i < count; i++) pool->next[i] = i + 1 < count ? (long) i + 2 : 0;
+    pool->free = 1;
+    pool->released = 0;
+    return pool;
+}
+void aladDestroySourcePool (aladSourcePool *pool) {
+    if (pool == nullptr) return;
+    if (aladAL.DeleteSources != nullptr) aladAL.DeleteSources(pool->count, pool->sources);
+    free(pool);
+}
+ALuint aladAcquireSource (aladSourcePool *pool, aladSourceCache *cache) {
+    long indices[ALAD_SOURCE_CACHE_SIZE];
+    ALsizei i, popped;
+    if (pool == nullptr) return 0;
+    if (cache == nullptr) {
+        popped = aladu_stack_pop_(pool, &pool->free, 1, indices);
+    } else {
+        /* a refill takes half a cache in one exchange, so the shared head is touched less often */
+        if (cache->count == 0) {
+            popped = aladu_stack_pop_(pool, &pool->free, ALAD_SOURCE_CACHE_SIZE / 2 > 0 ? ALAD_SOURCE_CACHE_SIZE / 2 : 1, indices);
+            for (i = 0; i < popped; i++) cache->sources[cache->count++] = pool->sources[indices[i] - 1];
+        }
+        if (cache->count == 0) return 0;
+        popped = 1;
+        indices[0] = aladu_pool_index_(pool, cache->sources[--cache->count]);
+    }
+    if (popped == 0) return 0;
+    aladu_atomic_store_long_(&pool->acquired[indices[0] - 1], 1);
+    return pool->sources[indices[0] - 1];
+}
+void aladReleaseSource (aladSourcePool *pool, ALuint source) {
+    long index;
+    if (pool == nullptr || (index = aladu_pool_index_(pool, source)) == 0) return;
+    /* releasing twice would put the node on the stack twice */
+    if (aladu_atomic_exchange_long_(&pool->acquired[index - 1], 0) == 0) return;
+    aladu_stack_push_(pool, &pool->released, index, index);
+}
+void aladFlushSourceCache (aladSourcePool *pool, aladSourceCache *cache) {
+    long first = 0, last = 0;
+    ALsizei i;
+    if (pool == nullptr || cache == nullptr) return;
+    for (i = 0; i < cache->count; i++) {
+        long index = aladu_pool_index_(pool, cache->sources[i]);
+        if (index == 0) continue;
+        if (last != 0) aladu_atomic_store_long_(&pool->next[last - 1], index);
+        else first = index;
+        last = index;
+    }
+    if (first != 0) aladu_stack_push_(pool, &pool->free, first, last);
+    cache->count = 0;
+}
+ALsizei aladRecycleSources (aladSourcePool *pool) {
+    ALint64SOFT head;
+    ALCcontext *frame;
+    long first, index;
+    ALsizei n = 0, i;
+    size_t k;
+    if (pool == nullptr) return 0;
+    /* takes the whole released stack at once, nobody else walks it */
+    do {
+        head = aladu_atomic_load64_(&pool->released);
+        if (ALADU_STACK_TOP_(head) == 0) return 0;
+    } while (!aladu_atomic_cas64_(&pool->released, head, ALADU_STACK_HEAD_(head, 0)));
+    first = ALADU_STACK_TOP_(head);
+    for (index = first; index != 0 && n < pool->count; index = pool->next[index - 1]) pool->scratch[n++] = pool->sources[index - 1];
+
+    frame = aladBeginFrame(nullptr);
+    /* rewinding leaves them in AL_INITIAL, which is where a new source starts, and only then the buffer can be detached */
+    if (aladAL.SourceStopv != nullptr)   aladAL.SourceStopv(n, pool->scratch);
+    if (aladAL.SourceRewindv != nullptr) aladAL.SourceRewindv(n, pool->scratch);
+    for (i = 0; i < n; i++) {
+        ALuint source = pool->scratch[i];
+        aladAL.Sourcei(source, AL_BUFFER, 0);
+        for (k = 0; k < ALADU_COUNT_OF_(aladu_shadow_floats_); k++) {
+            ALfloat initial = aladu_shadow_floats_[k].initial;
+            if (aladu_shadow_floats_[k].count == 1) aladAL.Sourcef(source, aladu_shadow_floats_[k].param, initial);
+            else aladAL.Source3f(source, aladu_shadow_floats_[k].param, initial, initial, initial);
+        }
+        for (k = 0; k < ALADU_COUNT_OF_(aladu_shadow_ints_); k++) aladAL.Sourcei(source, aladu_shadow_ints_[k].param, (ALint) aladu_shadow_ints_[k].initial);
+        if (aladAL.GenFilters != nullptr) aladAL.Sourcei(source, AL_DIRECT_FILTER, AL_FILTER_NULL);
+    }
+    aladEndFrame(frame);
+
+    /* the chain is still linked as it was released, so it goes back in one push */
+    for (index = first; pool->next[index - 1] != 0; index = pool->next[index - 1]);
+    aladu_stack_push_(pool, &pool->free, first, index);
+    return n;
+}
+
+
+/*
+ * Virtual voices: the voices are a structure of arrays, padded to a multiple of 8 so that the score pass never needs a scalar tail.
+ * A voice has a source index (-1 while it is virtual) and a play offset in samples, which advances with the time passed while the voice
+ * is virtual and is read back from the source when it is demoted. Handles hold the index + 1 in their low ALADU_VOICE_INDEX_BITS_ bits
+ * and a generation above them, so that a handle of a voice that has ended doesn't reach the voice that took over its index.
+ */
+#define ALADU_VOICE_INDEX_BITS_ 20
+#define ALADU_VOICE_INDEX_MASK_ ((1UL << ALADU_VOICE_INDEX_BITS_) - 1)
+
+struct aladVoiceManager {
+    ALsizei     capacity;
+    ALsizei     padded;
+    /* scored together, an inactive voice has a gain of -1 */
+    ALfloat    *x;
+    ALfloat    *y;
+    ALfloat    *z;
+    ALfloat    *gain;
+    ALfloat    *score;
+    ALuint     *buffer;
+    ALboolean  *looping;
+    ALsizei    *source;
+    ALdouble   *offset;
+    ALfloat    *frequency;
+    ALint      *length;
+    ALuint     *generation;
+    ALsizei    *freeVoices;
+    ALsizei     freeVoiceCount;
+    ALsizei     sourceCount;
+    ALuint     *sources;
+    ALsizei    *freeSources;
+    ALsizei     freeSourceCount;
+    ALsizei    *chosen;
+};
+
+/* 1 / sqrt(x) without libm, about as exact as the SIMD estimates: a guess from the bits and two Newton steps */
+static ALfloat aladu_rsqrt_ (ALfloat x) {
+    ALuint bits;
+    ALfloat y;
+    memcpy(&bits, &x, sizeof(bits));
+    bits = 0x5F3759DFu - (bits >> 1);
+    memcpy(&y, &bits, sizeof(y));
+    y = y * (1.5f - 0.5f * x * y * y);
+    return y * (1.5f - 0.5f * x * y * y);
+}
+/* score = gain * the clamped inverse distance attenuation for a reference distance and rolloff factor of 1 */
+static void aladu_score_voices_ (const aladVoiceManager *manager, ALfloat lx, ALfloat ly, ALfloat lz) {
+    ALsizei i = 0, n = manager->padded;
+#if defined(ALADU_SIMD_AVX_)
+    __m256 px = _mm256_set1_ps(lx), py = _mm256_set1_ps(ly), pz = _mm256_set1_ps(lz), one = _mm256_set1_ps(1.0f);
+    for (; i + 8 <= n; i += 8) {
+        __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(manager->x + i), px);
+        __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(manager->y + i), py);
+        __m256 dz = _mm256_sub_ps(_mm256_loadu_ps(manager->z + i), pz);
+        __m256 d2 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), _mm256_mul_ps(dz, dz));
+        _mm256_storeu_ps(manager->score + i, _mm256_mul_ps(_mm256_loadu_ps(manager->gain + i), _mm256_rsqrt_ps(_mm256_max_ps(d2, one))));
+    }
+#elif defined(ALADU_SIMD_SSE_)
+    __m128 px = _mm_set1_ps(lx), py = _mm_set1_ps(ly), pz = _mm_set1_ps(lz), one = _mm_set1_ps(1.0f);
+    for (; i + 4 <= n; i += 4) {
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(manager->x + i), px);
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(manager->y + i), py);
+        __m128 dz = _mm_sub_ps(_mm_loadu_ps(manager->z + i), pz);
+        __m128 d2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+        _mm_storeu_ps(manager->score + i, _mm_mul_ps(_mm_loadu_ps(manager->gain + i), _mm_rsqrt_ps(_mm_max_ps(d2, one))));
+    }
+#elif defined(ALADU_SIMD_NEON_)
+    float32x4_t px = vdupq_n_f32(lx), py = vdupq_n_f32(ly), pz = vdupq_n_f32(lz), one = vdupq_n_f32(1.0f);
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t dx = vsubq_f32(vld1q_f32(manager->x + i), px);
+        float32x4_t dy = vsubq_f32(vld1q_f32(manager->y + i), py);
+        float32x4_t dz = vsubq_f32(vld1q_f32(manager->z + i), pz);
+        float32x4_t d2 = vaddq_f32(vaddq_f32(vmulq_f32(dx, dx), vmulq_f32(dy, dy)), vmulq_f32(dz, dz));
+        vst1q_f32(manager->score + i, vmulq_f32(vld1q_f32(manager->gain + i), vrsqrteq_f32(vmaxq_f32(d2, one))));
+    }
+#endif
+    for (; i < n; i++) {
+        ALfloat dx = manager->x[i] - lx, dy = manager->y[i] - ly, dz = manager->z[i] - lz;
+        ALfloat d2 = dx * dx + dy * dy + dz * dz;
+        manager->score[i] = manager->gain[i] * aladu_rsqrt_(d2 > 1.0f ? d2 : 1.0f);
+    }
+}
+static ALsizei aladu_voice_index_ (const aladVoiceManager *manager, aladVoice voice) {
+    ALsizei index = (ALsizei) (voice & ALADU_VOICE_INDEX_MASK_) - 1;
+    if (manager == nullptr || index < 0 || index >= manager->capacity || manager->gain[index] < 0.0f) return -1;
+    return manager->generation[index] == (ALuint) (voice >> ALADU_VOICE_INDEX_BITS_) ? index : -1;
+}
+static void aladu_voice_free_ (aladVoiceManager *manager, ALsizei index) {
+    ALsizei source = manager->source[index];
+    if (source >= 0) {
+        aladAL.SourceStop(manager->sources[source]);
+        aladAL.Sourcei(manager->sources[source], AL_BUFFER, 0);
+        manager->freeSources[manager->freeSourceCount++] = source;
+        manager->source[index] = -1;
+    }
+    manager->gain[index] = -1.0f;
+    manager->generation[index] = (manager->generation[index] + 1) & (0xFFFFFFFFUL >> ALADU_VOICE_INDEX_BITS_);
+    manager->freeVoices[manager->freeVoiceCount++] = index;
+}
+static void aladu_voice_promote_ (aladVoiceManager *manager, ALsizei index) {
+    ALsizei source;
+    ALuint id;
+    if (manager->freeSourceCount == 0) return;
+    source = manager->freeSources[--manager->freeSourceCount];
+    id = manager->sources[source];
+    manager->source[index] = source;
+    aladAL.Sourcei(id, AL_BUFFER, (ALint) manager->buffer[index]);
+    aladAL.Sourcei(id, AL_LOOPING, manager->looping[index]);
+    aladAL.Sourcef(id, AL_GAIN, manager->gain[index]);
+    aladAL.Source3f(id, AL_POSITION, manager->x[index], manager->y[index], manager->z[index]);
+    /* an offset set before playing is where it starts */
+    if (manager->offset[index] > 0.0) {
+        if (aladAL.SourcedSOFT != nullptr) aladAL.SourcedSOFT(id, AL_SAMPLE_OFFSET, manager->offset[index]);
+        else aladAL.Sourcef(id, AL_SAMPLE_OFFSET, (ALfloat) manager->offset[index]);
+    }
+    aladAL.SourcePlay(id);
+}
+static void aladu_voice_demote_ (aladVoiceManager *manager, ALsizei index) {
+    ALuint id = manager->sources[manager->source[index]];
+    /* AL_SOFT_source_latency has the offset with 32 bits of fraction, so the voice picks up between samples */
+    if (aladAL.GetSourcei64vSOFT != nullptr) {
+        ALint64SOFT values[2] = {0, 0};
+        aladAL.GetSourcei64vSOFT(id, AL_SAMPLE_OFFSET_LATENCY_SOFT, values);
+        manager->offset[index] = (ALdouble) values[0] / 4294967296.0;
+    } else {
+        ALfloat offset = 0.0f;
+        aladAL.GetSourcef(id, AL_SAMPLE_OFFSET, &offset);
+        manager->offset[index] = offset;
+    }
+    aladAL.SourceStop(id);
+    aladAL.Sourcei(id, AL_BUFFER, 0);
+    manager->freeSources[manager->freeSourceCount++] = manager->source[index];
+    manager->source[index] = -1;
+}
+
+aladVoiceManager* aladCreateVoiceManager (ALsizei maxVoices, ALsizei maxSources) {
+    aladVoiceManager *manager;
+    ALsizei padded, i;
+    char *memory;
+    if (maxVoices <= 0 || (unsigned long) maxVoices >= ALADU_VOICE_INDEX_MASK_ || maxSources <= 0) return nullptr;
+    padded = (maxVoices + 7) & ~7;
+    manager = REINTERPRET_CAST(aladVoiceManager*, calloc(1, sizeof(aladVoiceManager) + (size_t) padded * (sizeof(ALdouble) + 6 * sizeof(ALfloat)
+            + sizeof(ALint) + 2 * sizeof(ALuint) + 3 * sizeof(ALsizei) + sizeof(ALboolean)) + (size_t) maxSources * (sizeof(ALuint) + sizeof(ALsizei))));
+    if (manager == nullptr) return nullptr;
+    memory = REINTERPRET_CAST(char*, (manager + 1));
+    manager->offset = REINTERPRET_CAST(ALdouble*, memory);        memory += (size_t) padded * sizeof(ALdouble);
+    manager->x = REINTERPRET_CAST(ALfloat*, memory);              memory += (size_t) padded * sizeof(ALfloat);
+    manager->y = REINTERPRET_CAST(ALfloat*, memory);              memory += (size_t) padded * sizeof(ALfloat);
+    manager->z = REINTERPRET_CAST(ALfloat*, memory);              memory += (size_t) padded * sizeof(ALfloat);
+    manager->gain = REINTERPRET_CAST(ALfloat*, memory);           memory += (size_t) padded * sizeof(ALfloat);
+    manager->score = REINTERPRET_CAST(ALfloat*, memory);          memory += (size_t) padded * sizeof(ALfloat);
+    manager->frequency = REINTERPRET_CAST(ALfloat*, memory);      memory += (size_t) padded * sizeof(ALfloat);
+    manager->length = REINTERPRET_CAST(ALint*, memory);           memory += (size_t) padded * sizeof(ALint);
+    manager->buffer = REINTERPRET_CAST(ALuint*, memory);          memory += (size_t) padded * sizeof(ALuint);
+    manager->generation = REINTERPRET_CAST(ALuint*, memory);      memory += (size_t) padded * sizeof(ALuint);
+    manager->source = REINTERPRET_CAST(ALsizei*, memory);         memory += (size_t) padded * sizeof(ALsizei);
+    manager->freeVoices = REINTERPRET_CAST(ALsizei*, memory);     memory += (size_t) padded * sizeof(ALsizei);
+    manager->chosen = REINTERPRET_CAST(ALsizei*, memory);         memory += (size_t) padded * sizeof(ALsizei);
+    manager->sources = REINTERPRET_CAST(ALuint*, memory);         memory += (size_t) maxSources * sizeof(ALuint);
+    manager->freeSources = REINTERPRET_CAST(ALsizei*, memory);    memory += (size_t) maxSources * sizeof(ALsizei);
+    manager->looping = REINTERPRET_CAST(ALboolean*, memory);
+    manager->capacity = maxVoices;
+    manager->padded = padded;
+    for (i = 0; i < padded; i++) {
+        manager->gain[i] = -1.0f;
+        manager->source[i] = -1;
+    }
+    for (i = 0; i < maxVoices; i++) manager->freeVoices[i] = maxVoices - 1 - i;
+    manager->freeVoiceCount = maxVoices;
+    /* one at a time, so that hitting the driver's limit still leaves the sources it did give out */
+    aladAL.GetError();
+    for (i = 0; i < maxSources; i++) {
+        aladAL.GenSources(1, &manager->sources[i]);
+        if (aladAL.GetError() != AL_NO_ERROR) break;
+    }
+    manager->sourceCount = i;
+    for (i = 0; i < manager->sourceCount; i++) manager->freeSources[i] = manager->sourceCount - 1 - i;
+    manager->freeSourceCount = manager->sourceCount;
+    if (manager->sourceCount == 0) {
+        free(manager);
+        return nullptr;
+    }
+    return manager;
+}
+void aladDestroyVoiceManager (aladVoiceManager *manager) {
+    if (manager == nullptr) return;
+    aladAL.DeleteSources(manager->sourceCount, manager->sources);
+    free(manager);
+}
+aladVoice aladPlayVoice (aladVoiceManager *manager, ALuint buffer, ALboolean looping) {
+    ALint size = 0, channels = 1, bits = 16, frequency = 0;
+    ALsizei index;
+    if (manager == nullptr || manager->freeVoiceCount == 0) return 0;
+    index = manager->freeVoices[--manager->freeVoiceCount];
+    aladAL.GetBufferi(buffer, AL_SIZE, &size);
+    aladAL.GetBufferi(buffer, AL_CHANNELS, &channels);
+    aladAL.GetBufferi(buffer, AL_BITS, &bits);
+    aladAL.GetBufferi(buffer, AL_FREQUENCY, &frequency);
+    manager->length[index] = channels > 0 && bits >= 8 ? size / (channels * (bits / 8)) : 0;
+    manager->frequency[index] = (ALfloat) frequency;
+    manager->buffer[index] = buffer;
+    manager->looping[index] = looping ? AL_TRUE : AL_FALSE;
+    manager->x[index] = manager->y[index] = manager->z[index] = 0.0f;
+    manager->gain[index] = 1.0f;
+    manager->offset[index] = 0.0;
+    /* it starts right away if a source is free, otherwise the next aladUpdateVoices decides */
+    aladu_voice_promote_(manager, index);
+    return (aladVoice) (index + 1) | (aladVoice) manager->generation[index] << ALADU_VOICE_INDEX_BITS_;
+}
+void aladStopVoice (aladVoiceManager *manager, aladVoice voice) {
+    ALsizei index = aladu_voice_index_(manager, voice);
+    if (index >= 0) aladu_voice_free_(manager, index);
+}
+void aladSetVoiceGain (aladVoiceManager *manager, aladVoice voice, ALfloat gain) {
+    ALsizei index = aladu_voice_index_(manager, voice);
+    if (index < 0) return;
+    manager->gain[index] = gain > 0.0f ? gain : 0.0f;
+    if (manager->source[index] >= 0) aladAL.Sourcef(manager->sources[manager->source[index]], AL_GAIN, manager->gain[index]);
+}
+void aladSetVoicePosition (aladVoiceManager *manager, aladVoice voice, ALfloat x, ALfloat y, ALfloat z) {
+    ALsizei index = aladu_voice_index_(manager, voice);
+    if (index < 0) return;
+    manager->x[index] = x; manager->y[index] = y; manager->z[index] = z;
+    if (manager->source[index] >= 0) aladAL.Source3f(manager->sources[manager->source[index]], AL_POSITION, x, y, z);
+}
+ALboolean aladIsVoicePlaying (aladVoiceManager *manager, aladVoice voice) {
+    return aladu_voice_index_(manager, voice) >= 0 ? AL_TRUE : AL_FALSE;
+}
+ALuint aladGetVoiceSource (aladVoiceManager *manager, aladVoice voice) {
+    ALsizei index = aladu_voice_index_(manager, voice);
+    return index >= 0 && manager->source[index] >= 0 ? manager->sources[manager->source[index]] : 0;
+}
+void aladUpdateVoices (aladVoiceManager *manager, ALfloat dt) {
+    ALfloat lx = 0.0f, ly = 0.0f, lz = 0.0f;
+    ALsizei i, chosen = 0, k;
+    ALCcontext *frame;
+    if (manager == nullptr) return;
+    frame = aladBeginFrame(nullptr);
+    /* voices end when their source stops, or when a virtual one runs past the end of its buffer */
+    for (i = 0; i < manager->capacity; i++) {
+        if (manager->gain[i] < 0.0f) continue;
+        if (manager->source[i] >= 0) {
+            ALint state = AL_PLAYING;
+            aladAL.GetSourcei(manager->sources[manager->source[i]], AL_SOURCE_STATE, &state);
+            if (state == AL_STOPPED) aladu_voice_free_(manager, i);
+            continue;
+        }
+        manager->offset[i] += (ALdouble) dt * manager->frequency[i];
+        if (manager->length[i] <= 0) continue;
+        if (manager->looping[i]) manager->offset[i] -= (ALdouble) (ALint64SOFT) (manager->offset[i] / manager->length[i]) * manager->length[i];
+        else if (manager->offset[i] >= (ALdouble) manager->length[i]) aladu_voice_free_(manager, i);
+    }
+    if (aladAL.GetListener3f != nullptr) aladAL.GetListener3f(AL_POSITION, &lx, &ly, &lz);
+    aladu_score_voices_(manager, lx, ly, lz);
+
+    /* the sourceCount loudest voices, as a min-heap by score, so the quietest of them is the one to compare against */
+    for (i = 0; i < manager->capacity; i++) {
+        ALsizei j;
+        if (manager->gain[i] < 0.0f) continue;
+        if (chosen == manager->sourceCount) {
+            if (manager->score[i] <= manager->score[manager->chosen[0]]) continue;
+            j = 0;
+            for (;;) {
+                ALsizei child = 2 * j + 1;
+                if (child >= chosen) break;
+                if (child + 1 < chosen && manager->score[manager->chosen[child + 1]] < manager->score[manager->chosen[child]]) child++;
+                if (manager->score[manager->chosen[child]] >= manager->score[i]) break;
+                manager->chosen[j] = manager->chosen[child];
+                j = child;
+            }
+        } else {
+            for (j = chosen++; j > 0 && manager->score[manager->chosen[(j - 1) / 2]] > manager->score[i]; j = (j - 1) / 2) {
+                manager->chosen[j] = manager->chosen[(j - 1) / 2];
+            }
+        }
+        manager->chosen[j] = i;
+    }
+    /* demotions first, so that their sources are free for the promotions; score is reused as the mark of the chosen ones */
+    for (k = 0; k < chosen; k++) manager->score[manager->chosen[k]] = FLT_MAX;
+    for (i = 0; i < manager->capacity; i++) {
+        if (manager->gain[i] >= 0.0f && manager->source[i] >= 0 && manager->score[i] != FLT_MAX) aladu_voice_demote_(manager, i);
+    }
+    for (k = 0; k < chosen; k++) {
+        if (manager->source[manager->chosen[k]] < 0) aladu_voice_promote_(manager, manager->chosen[k]);
+    }
+    aladEndFrame(frame);
+}
+
+
+/*
+ * Streams: a single-producer/single-consumer ring of a power of two bytes, with monotonic write and read counts, each stored only by its
+ * own side. Differences of the counts are taken as unsigned long, so they stay right when the counts wrap around. The consumer is the
+ * mixer thread in the callback of AL_SOFT_callback_buffer, and aladUpdateStream without it, which then queues ALADU_STREAM_BUFFERS_
+ * buffers of half a ring each, filled from a scratch block allocated once.
+ */
+#define ALADU_STREAM_BUFFERS_ 2
+
+struct aladStream {
+    ALuint              source;
+    ALenum              format;
+    ALsizei             frequency;
+    ALsizei             frameSize;
+    int                 silence;
+    unsigned char      *ring;
+    unsigned long       mask;
+    volatile long       written;
+    volatile long       read;
+    volatile long       ended;
+    volatile long       underruns;
+    volatile long       silentBytes;
+    ALboolean           callback;
+    ALboolean           started;
+    ALuint              buffers[ALADU_STREAM_BUFFERS_];
+    ALboolean           queued[ALADU_STREAM_BUFFERS_];
+    ALsizei             chunk;
+    unsigned char      *scratch;
+};
+
+/* 0 for the formats whose frames the stream doesn't know, so it can't split the ring into whole frames for them */
+static ALsizei aladu_frame_size_ (ALenum format) {
+    switch (format) {
+        case AL_FORMAT_MONO8:           return 1;
+        case AL_FORMAT_MONO16:          return 2;
+        case AL_FORMAT_STEREO8:         return 2;
+        case AL_FORMAT_STEREO16:        return 4;
+        case AL_FORMAT_MONO_FLOAT32:    return 4;
+        case AL_FORMAT_STEREO_FLOAT32:  return 8;
+        default:                        return 0;
+    }
+}
+static ALsizei aladu_stream_available_ (aladStream *stream) {
+    unsigned long written = (unsigned long) aladu_atomic_load_long_(&stream->written);
+    return (ALsizei) (written - (unsigned long) stream->read);
+}
+/* consumer side: copies up to bytes whole frames out of the ring */
+static ALsizei aladu_stream_read_ (aladStream *stream, unsigned char *destination, ALsizei bytes) {
+    unsigned long read = (unsigned long) stream->read, offset = read & stream->mask;
+    ALsizei available = aladu_stream_available_(stream), first;
+    if (bytes > available) bytes = available;
+    bytes -= bytes % stream->frameSize;
+    first = (ALsizei) (stream->mask + 1 - offset) < bytes ? (ALsizei) (stream->mask + 1 - offset) : bytes;
+    memcpy(destination, stream->ring + offset, (size_t) first);
+    memcpy(destination + first, stream->ring, (size_t) (bytes - first));
+    aladu_atomic_store_long_(&stream->read, (long) (read + (unsigned long) bytes));
+    return bytes;
+}
+static void aladu_stream_count_ (volatile long *counter, long amount) {
+    aladu_atomic_store_long_(counter, (long) ((unsigned long) aladu_atomic_load_long_(counter) + (unsigned long) amount));
+}
+static ALsizei AL_APIENTRY aladu_stream_callback_ (ALvoid *userptr, ALvoid *sampledata, ALsizei numbytes) ALADU_NOEXCEPT_ {
+    aladStream *stream = REINTERPRET_CAST(aladStream*, userptr);
+    /* read before the ring, so all data written before the end was marked is already visible */
+    long ended = aladu_atomic_load_long_(&stream->ended);
+    ALsizei bytes = aladu_stream_read_(stream, REINTERPRET_CAST(unsigned char*, sampledata), numbytes);
+    if (bytes == numbytes || ended) return bytes;
+    /* returning less would end the source, so an underrun is padded with silence */
+    memset(REINTERPRET_CAST(unsigned char*, sampledata) + bytes, stream->silence, (size_t) (numbytes - bytes));
+    aladu_stream_count_(&stream->underruns, 1);
+    aladu_stream_count_(&stream->silentBytes, (long) (numbytes - bytes));
+    return numbytes;
+}
+
+aladStream* aladCreateStream (ALuint source, ALenum format, ALsizei frequency, ALsizei ringBytes) {
+    aladStream *stream;
+    size_t size;
+    ALsizei frameSize = aladu_frame_size_(format);
+    if (frameSize == 0 || ringBytes < 2 * frameSize || frequency <= 0) return nullptr;
+    size = aladu_power_of_two_((size_t) ringBytes);
+    stream = REINTERPRET_CAST(aladStream*, calloc(1, sizeof(aladStream) + size));
+    if (stream == nullptr) return nullptr;
+    stream->source = source;
+    stream->format = format;
+    stream->frequency = frequency;
+    stream->frameSize = frameSize;
+    stream->silence = format == AL_FORMAT_MONO8 || format == AL_FORMAT_STEREO8 ? 0x80 : 0;
+    stream->ring = REINTERPRET_CAST(unsigned char*, (stream + 1));
+    stream->mask = (unsigned long) size - 1;
+    stream->callback = aladAL.BufferCallbackSOFT != nullptr ? AL_TRUE : AL_FALSE;
+    aladAL.GetError();
+    aladAL.GenBuffers(stream->callback ? 1 : ALADU_STREAM_BUFFERS_, stream->buffers);
+    if (stream->callback) {
+        aladAL.BufferCallbackSOFT(stream->buffers[0], format, frequency, aladu_stream_callback_, stream);
+        aladAL.Sourcei(source, AL_BUFFER, (ALint) stream->buffers[0]);
+    } else {
+        stream->chunk = (ALsizei) (size / 2) - (ALsizei) (size / 2) % frameSize;
+        stream->scratch = REINTERPRET_CAST(unsigned char*, malloc((size_t) stream->chunk));
+    }
+    if (aladAL.GetError() != AL_NO_ERROR || (!stream->callback && stream->scratch == nullptr)) {
+        aladDestroyStream(stream);
+        return nullptr;
+    }
+    return stream;
+}
+void aladDestroyStream (aladStream *stream) {
+    if (stream == nullptr) return;
+    aladAL.SourceStop(stream->source);
+    aladAL.Sourcei(stream->source, AL_BUFFER, 0);
+    aladAL.DeleteBuffers(stream->callback ? 1 : ALADU_STREAM_BUFFERS_, stream->buffers);
+    free(stream->scratch);
+    free(stream);
+}
+void* aladBeginStreamWrite (aladStream *stream, ALsizei *bytes) {
+    unsigned long written, offset, space;
+    if (stream == nullptr || bytes == nullptr) return nullptr;
+    written = (unsigned long) stream->written;
+    offset = written & stream->mask;
+    space = stream->mask + 1 - (written - (unsigned long) aladu_atomic_load_long_(&stream->read));
+    *bytes = (ALsizei) (space < stream->mask + 1 - offset ? space : stream->mask + 1 - offset);
+    return stream->ring + offset;
+}
+void aladEndStreamWrite (aladStream *stream, ALsizei bytes) {
+    if (stream == nullptr || bytes <= 0) return;
+    aladu_atomic_store_long_(&stream->written, (long) ((unsigned long) stream->written + (unsigned long) bytes));
+}
+ALsizei aladWriteStream (aladStream *stream, const void *data, ALsizei bytes) {
+    ALsizei total = 0;
+    /* at most two pieces, the one up to the end of the ring and the one from its start */
+    while (total < bytes) {
+        ALsizei space;
+        void *destination = aladBeginStreamWrite(stream, &space);
+        if (destination == nullptr || space == 0) break;
+        if (space > bytes - total) space = bytes - total;
+        memcpy(destination, REINTERPRET_CAST(const unsigned char*, data) + total, (size_t) space);
+        aladEndStreamWrite(stream, space);
+        total += space;
+    }
+    return total;
+}
+void aladEndStream (aladStream *stream) {
+    if (stream != nullptr) aladu_atomic_store_long_(&stream->ended, 1);
+}
+void aladUpdateStream (aladStream *stream) {
+    ALint processed = 0, state = AL_PLAYING;
+    ALsizei i, queued = 0;
+    if (stream == nullptr || stream->callback) return;
+    aladAL.GetSourcei(stream->source, AL_BUFFERS_PROCESSED, &processed);
+    while (processed-- > 0) {
+        ALuint buffer = 0;
+        aladAL.SourceUnqueueBuffers(stream->source, 1, &buffer);
+        for (i = 0; i < ALADU_STREAM_BUFFERS_; i++) {
+            if (stream->buffers[i] == buffer) stream->queued[i] = AL_FALSE;
+        }
+    }
+    for (i = 0; i < ALADU_STREAM_BUFFERS_; i++) {
+        long ended = aladu_atomic_load_long_(&stream->ended);
+        ALsizei available = aladu_stream_available_(stream), bytes;
+        if (!stream->queued[i] && (available >= stream->chunk || (ended && available >= stream->frameSize))) {
+            bytes = aladu_stream_read_(stream, stream->scratch, stream->chunk);
+            aladAL.BufferData(stream->buffers[i], stream->format, stream->scratch, bytes, stream->frequency);
+            aladAL.SourceQueueBuffers(stream->source, 1, &stream->buffers[i]);
+            stream->queued[i] = AL_TRUE;
+        }
+        if (stream->queued[i]) queued++;
+    }
+    if (!stream->started || queued == 0) return;
+    /* a source that ran dry stopped by itself, unless the stream has ended that is an underrun */
+    aladAL.GetSourcei(stream->source, AL_SOURCE_STATE, &state);
+    if (state == AL_PLAYING) return;
+    if (!aladu_atomic_load_long_(&stream->ended)) aladu_stream_count_(&stream->underruns, 1);
+    aladAL.SourcePlay(stream->source);
+}
+void aladPlayStream (aladStream *stream) {
+    if (stream == nullptr) return;
+    stream->started = AL_TRUE;
+    aladUpdateStream(stream);
+    aladAL.SourcePlay(stream->source);
+}
+void aladStopStream (aladStream *stream) {
+    if (stream == nullptr) return;
+    stream->started = AL_FALSE;
+    aladAL.SourceStop(stream->source);
+}
+aladStreamStatistics aladGetStreamStatistics (aladStream *stream) {
+    aladStreamStatistics statistics = {0, 0};
+    if (stream == nullptr) return statistics;
+    statistics.underruns = (unsigned long) aladu_atomic_load_long_(&stream->underruns);
+    statistics.silentBytes = (unsigned long) aladu_atomic_load_long_(&stream->silentBytes);
+    return statistics;
+}
+
+
+/*
+ * Event queue: a bounded multi-producer/single-consumer queue after Dmitry Vyukov, in which every cell carries a sequence number. A
+ * producer claims a cell by advancing the tail when the cell's sequence equals the position, then fills it and publishes it by setting
+ * the sequence to position + 1; the consumer takes it when it finds that, and frees it for the next round by setting position + size.
+ * The wakeup is only signaled when the flag was clear, so a burst of events costs one write. Both sides exchange that same flag, which
+ * orders them: either the consumer's exchange sees the producer's, and with it the event, or the producer's sees the cleared flag and
+ * signals again.
+ */
+#if defined(_WIN32) || defined(__WIN32__) || defined(WIN32) || defined(__MINGW32__)
+#include <windows.h>
+#else
+#include <poll.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#else
+#include <fcntl.h>
+#endif
+#endif
+
+typedef struct aladu_event_cell_ {
+    volatile long   sequence;
+    aladEvent       event;
+} aladu_event_cell_;
+typedef struct aladu_events_t_ {
+    aladu_event_cell_  *cells;
+    unsigned long       mask;
+    volatile long       tail;
+    unsigned long       head;
+    volatile long       enabled;
+    volatile long       signaled;
+    volatile long       dropped;
+    ALboolean           registered;
+#if defined(_WIN32) || defined(__WIN32__) || defined(WIN32) || defined(__MINGW32__)
+    HANDLE              handle;
+#else
+    int                 fds[2];
+#endif
+} aladu_events_t_;
+static aladu_events_t_ aladu_events_;
+static aladALFunctions aladu_events_driver_;
+
+/* the wakeup: an auto-reset event on Windows, an eventfd on Linux and a non-blocking pipe elsewhere */
+#if defined(_WIN32) || defined(__WIN32__) || defined(WIN32) || defined(__MINGW32__)
+static ALboolean aladu_events_open_ (void)   { return (aladu_events_.handle = CreateEventA(nullptr, FALSE, FALSE, nullptr)) != nullptr ? AL_TRUE : AL_FALSE; }
+static void aladu_events_close_ (void)       { CloseHandle(aladu_events_.handle); }
+static void aladu_events_signal_ (void)      { SetEvent(aladu_events_.handle); }
+static void aladu_events_drain_ (void)       { }
+static ALboolean aladu_events_block_ (long milliseconds) {
+    return WaitForSingleObject(aladu_events_.handle, milliseconds < 0 ? INFINITE : (DWORD) milliseconds) == WAIT_OBJECT_0 ? AL_TRUE : AL_FALSE;
+}
+#else
+#if defined(__linux__)
+static ALboolean aladu_events_open_ (void) {
+    aladu_events_.fds[0] = aladu_events_.fds[1] = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    return aladu_events_.fds[0] >= 0 ? AL_TRUE : AL_FALSE;
+}
+static void aladu_events_close_ (void)       { close(aladu_events_.fds[0]); }
+static void aladu_events_signal_ (void) {
+    ALuint64SOFT one = 1;
+    ssize_t result = write(aladu_events_.fds[1], &one, sizeof(one));
+    (void) result;
+}
+#else
+static ALboolean aladu_events_open_ (void) {
+    if (pipe(aladu_events_.fds) != 0) return AL_FALSE;
+    fcntl(aladu_events_.fds[0], F_SETFL, fcntl(aladu_events_.fds[0], F_GETFL) | O_NONBLOCK);
+    fcntl(aladu_events_.fds[1], F_SETFL, fcntl(aladu_events_.fds[1], F_GETFL) | O_NONBLOCK);
+    return AL_TRUE;
+}
+static void aladu_events_close_ (void)       { close(aladu_events_.fds[0]); close(aladu_events_.fds[1]); }
+static void aladu_events_signal_ (void) {
+    char one = 1;
+    ssize_t result = write(aladu_events_.fds[1], &one, sizeof(one));
+    (void) result;
+}
+#endif
+static void aladu_events_drain_ (void) {
+    ALuint64SOFT data[8];
+    while (read(aladu_events_.fds[0], data, sizeof(data)) > 0) continue;
+}
+/* returns whether the wakeup is readable */
+static ALboolean aladu_events_block_ (long milliseconds) {
+    struct pollfd descriptor;
+    descriptor.fd = aladu_events_.fds[0];
+    descriptor.events = POLLIN;
+    descriptor.revents = 0;
+    return poll(&descriptor, 1, milliseconds < 0 ? -1 : (int) milliseconds) > 0 && (descriptor.revents & POLLIN) != 0 ? AL_TRUE : AL_FALSE;
+}
+#endif
+
+static void aladu_queue_event_ (ALenum eventType, ALuint object, ALuint param) {
+    aladu_event_cell_ *cell;
+    unsigned long position;
+    long dropped;
+    if (!aladu_atomic_load_long_(&aladu_events_.enabled)) return;
+    position = (unsigned long) aladu_atomic_load_long_(&aladu_events_.tail);
+    for (;;) {
+        long difference;
+        cell = &aladu_events_.cells[position & aladu_events_.mask];
+        difference = (long) ((unsigned long) aladu_atomic_load_long_(&cell->sequence) - position);
+        if (difference == 0 && aladu_atomic_cas_long_(&aladu_events_.tail, (long) position, (long) (position + 1))) break;
+        if (difference < 0) {
+            do dropped = aladu_atomic_load_long_(&aladu_events_.dropped);
+            while (!aladu_atomic_cas_long_(&aladu_events_.dropped, dropped, (long) ((unsigned long) dropped + 1)));
+            return;
+        }
+        position = (unsigned long) aladu_atomic_load_long_(&aladu_events_.tail);
+    }
+    cell->event.type = eventType;
+    cell->event.object = object;
+    cell->event.param = param;
+    aladu_atomic_store_long_(&cell->sequence, (long) (position + 1));
+    if (!aladu_atomic_exchange_long_(&aladu_events_.signaled, 1)) aladu_events_signal_();
+}
+static ALboolean aladu_events_pending_ (void) {
+    aladu_event_cell_ *cell = &aladu_events_.cells[aladu_events_.head & aladu_events_.mask];
+    return (unsigned long) aladu_atomic_load_long_(&cell->sequence) == aladu_events_.head + 1 ? AL_TRUE : AL_FALSE;
+}
+
+ALboolean aladEnableEventQueue (ALsizei capacity) {
+    unsigned long i, size;
+    if (aladu_events_.cells != nullptr) return AL_TRUE;
+    if (capacity <= 0 || aladAL.EventCallbackSOFT == nullptr || aladAL.EventControlSOFT == nullptr) return AL_FALSE;
+    size = (unsigned long) aladu_power_of_two_((size_t) capacity);
+    aladu_events_.cells = REINTERPRET_CAST(aladu_event_cell_*, malloc(size * sizeof(aladu_event_cell_)));
+    if (aladu_events_.cells == nullptr) return AL_FALSE;
+    if (!aladu_events_open_()) {
+        free(aladu_events_.cells);
+        aladu_events_.cells = nullptr;
+        return AL_FALSE;
+    }
+    for (i = 0; i < size; i++) aladu_events_.cells[i].sequence = (long) i;
+    aladu_events_.mask = size - 1;
+    aladu_events_.tail = 0;
+    aladu_events_.head = 0;
+    aladu_events_.signaled = 0;
+    aladu_events_.dropped = 0;
+    aladu_atomic_store_long_(&aladu_events_.enabled, 1);
+    aladu_events_driver_ = aladAL;
+    aladu_events_.registered = aladu_enable_events_(&aladu_events_driver_, AL_TRUE);
+    return AL_TRUE;
+}
+void aladDisableEventQueue (void) {
+    if (aladu_events_.cells == nullptr) return;
+    aladu_atomic_store_long_(&aladu_events_.enabled, 0);
+    if (aladu_events_.registered) aladu_enable_events_(&aladu_events_driver_, AL_FALSE);
+    aladu_events_.registered = AL_FALSE;
+    aladu_events_close_();
+    free(aladu_events_.cells);
+    aladu_events_.cells = nullptr;
+}
+ALsizei aladPollEvents (aladEvent *events, ALsizei max) {
+    ALsizei n = 0;
+    if (aladu_events_.cells == nullptr || events == nullptr) return 0;
+    while (n < max && aladu_events_pending_()) {
+        aladu_event_cell_ *cell = &aladu_events_.cells[aladu_events_.head & aladu_events_.mask];
+        events[n++] = cell->event;
+        aladu_atomic_store_long_(&cell->sequence, (long) (aladu_events_.head + aladu_events_.mask + 1));
+        aladu_events_.head++;
+    }
+    return n;
+}
+ALboolean aladWaitEvents (long milliseconds) {
+    if (aladu_events_.cells == nullptr) return AL_FALSE;
+    for (;;) {
+        if (aladu_atomic_exchange_long_(&aladu_events_.signaled, 0)) aladu_events_drain_();
+        if (aladu_events_pending_()) return AL_TRUE;
+        /* a producer that set the flag just before the exchange above writes after it, so the wakeup can be readable with the flag clear;
+           it is drained whenever it is readable, or the next wait would return right away again */
+        if (aladu_events_block_(milliseconds)) aladu_events_drain_();
+        /* a wakeup left over from events polled before can end a wait early, which only matters with a timeout */
+        if (milliseconds >= 0) return aladu_events_pending_();
+    }
+}
+aladEventHandle aladGetEventHandle (void) {
+#if defined(_WIN32) || defined(__WIN32__) || defined(WIN32) || defined(__MINGW32__)
+    return aladu_events_.cells != nullptr ? aladu_events_.handle : nullptr;
+#else
+    return aladu_events_.cells != nullptr ? aladu_events_.fds[0] : -1;
+#endif
+}
+unsigned long aladGetDroppedEvents (ALboolean reset) {
+    if (reset) return (unsigned long) aladu_atomic_exchange_long_(&aladu_events_.dropped, 0);
+    return (unsigned long) aladu_atomic_load_long_(&aladu_events_.dropped);
+}
+
+
+/*
+ * Scheduler: a binary min-heap of start and stop events, ordered by time and, for equal times, by the order they were scheduled in.
+ * An update pops everything due within the window and sends it in heap order, starts of the same time as one vectored call, stops as one
+ * alSourceStopv. Stops that are in the window but not yet due go back into the heap afterwards, and so do the later events of their
+ * sources, or a start sent ahead would be cancelled by the stop before it on the next update.
+ */
+#include <time.h>
+#if !defined(_WIN32) && !defined(__WIN32__) && !defined(WIN32) && !defined(__MINGW32__) && !defined(CLOCK_MONOTONIC) && (defined(__unix__) || defined(__APPLE__))
+#include <sys/time.h>
+#endif
+
+typedef struct aladu_schedule_entry_ {
+    ALint64SOFT     time;
+    unsigned long   order;
+    ALuint          source;
+    ALenum          action;
+} aladu_schedule_entry_;
+struct aladScheduler {
+    ALCdevice              *device;
+    ALboolean               timed;
+    aladu_schedule_entry_  *heap;
+    aladu_schedule_entry_  *later;
+    ALuint                 *batch;
+    ALsizei                 count;
+    ALsizei                 capacity;
+    unsigned long           order;
+};
+
+/* the clock without ALC_SOFT_device_clock; <time.h> only has CLOCK_MONOTONIC with a POSIX feature macro (which has to be defined before
+   any system header, so it can't be done here), gettimeofday is there without one but follows changes of the wall clock, and with
+   neither, there is no clock fine enough to emulate the starts with, so ALADU_HOST_CLOCK_ is 0 */
+#if defined(_WIN32) || defined(__WIN32__) || defined(WIN32) || defined(__MINGW32__) || defined(CLOCK_MONOTONIC) || defined(__unix__) || defined(__APPLE__)
+#define ALADU_HOST_CLOCK_ 1
+#else
+#define ALADU_HOST_CLOCK_ 0
+#endif
+static ALint64SOFT aladu_host_clock_ (void) {
+#if defined(_WIN32) || defined(__WIN32__) || defined(WIN32) || defined(__MINGW32__)
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (ALint64SOFT) (counter.QuadPart / frequency.QuadPart * 1000000000 + counter.QuadPart % frequency.QuadPart * 1000000000 / frequency.QuadPart);
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (ALint64SOFT) now.tv_sec * 1000000000 + (ALint64SOFT) now.tv_nsec;
+#elif ALADU_HOST_CLOCK_
+    struct timeval now;
+    gettimeofday(&now, nullptr);
+    return (ALint64SOFT) now.tv_sec * 1000000000 + (ALint64SOFT) now.tv_usec * 1000;
+#else
+    return 0;
+#endif
+}
+static ALboolean aladu_schedule_before_ (const aladu_schedule_entry_ *a, const aladu_schedule_entry_ *b) {
+    if (a->time != b->time) return a->time < b->time ? AL_TRUE : AL_FALSE;
+    return a->order - b->order > ~0UL / 2 ? AL_TRUE : AL_FALSE;
+}
+static void aladu_schedule_sift_down_ (aladScheduler *scheduler, ALsizei i) {
+    aladu_schedule_entry_ entry = scheduler->heap[i];
+    for (;;) {
+        ALsizei child = 2 * i + 1;
+        if (child >= scheduler->count) break;
+        if (child + 1 < scheduler->count && aladu_schedule_before_(&scheduler->heap[child + 1], &scheduler->heap[child])) child++;
+        if (!aladu_schedule_before_(&scheduler->heap[child], &entry)) break;
+        scheduler->heap[i] = scheduler->heap[child];
+        i = child;
+    }
+    scheduler->heap[i] = entry;
+}
+static void aladu_schedule_push_ (aladScheduler *scheduler, const aladu_schedule_entry_ *entry) {
+    ALsizei i = scheduler->count++;
+    while (i > 0 && aladu_schedule_before_(entry, &scheduler->heap[(i - 1) / 2])) {
+        scheduler->heap[i] = scheduler->heap[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    scheduler->heap[i] = *entry;
+}
+static aladu_schedule_entry_ aladu_schedule_pop_ (aladScheduler *scheduler) {
+    aladu_schedule_entry_ top = scheduler->heap[0];
+    scheduler->heap[0] = scheduler->heap[--scheduler->count];
+    if (scheduler->count > 0) aladu_schedule_sift_down_(scheduler, 0);
+    return top;
+}
+/* whether an event of the source was set aside in this update */
+static ALboolean aladu_schedule_held_ (const aladScheduler *scheduler, ALsizei later, ALuint source) {
+    ALsizei i;
+    for (i = 0; i < later; i++) if (scheduler->later[i].source == source) return AL_TRUE;
+    return AL_FALSE;
+}
+/* the heap, the events put back and the batch of sources share one block */
+static ALboolean aladu_schedule_reserve_ (aladScheduler *scheduler, ALsizei capacity) {
+    char *memory;
+    if (capacity <= scheduler->capacity) return AL_TRUE;
+    memory = REINTERPRET_CAST(char*, malloc((size_t) capacity * (2 * sizeof(aladu_schedule_entry_) + sizeof(ALuint))));
+    if (memory == nullptr) return AL_FALSE;
+    if (scheduler->count > 0) memcpy(memory, scheduler->heap, (size_t) scheduler->count * sizeof(aladu_schedule_entry_));
+    free(scheduler->heap);
+    scheduler->heap = REINTERPRET_CAST(aladu_schedule_entry_*, memory);
+    scheduler->later = scheduler->heap + capacity;
+    scheduler->batch = REINTERPRET_CAST(ALuint*, (scheduler->later + capacity));
+    scheduler->capacity = capacity;
+    return AL_TRUE;
+}
+static ALboolean aladu_schedule_ (aladScheduler *scheduler, ALuint source, ALint64SOFT time, ALenum action) {
+    aladu_schedule_entry_ entry;
+    if (scheduler == nullptr || source == 0) return AL_FALSE;
+    if (scheduler->count == scheduler->capacity && !aladu_schedule_reserve_(scheduler, 2 * scheduler->capacity)) return AL_FALSE;
+    entry.time = time;
+    entry.order = scheduler->order++;
+    entry.source = source;
+    entry.action = action;
+    aladu_schedule_push_(scheduler, &entry);
+    return AL_TRUE;
+}
+static void aladu_schedule_flush_ (aladScheduler *scheduler, ALenum action, ALint64SOFT time, ALsizei n) {
+    if (n == 0) return;
+    if (action == AL_STOPPED) aladAL.SourceStopv(n, scheduler->batch);
+    else if (scheduler->timed) aladAL.SourcePlayAtTimevSOFT(n, scheduler->batch, time);
+    else aladAL.SourcePlayv(n, scheduler->batch);
+}
+
+aladScheduler* aladCreateScheduler (ALCdevice *device, ALsizei capacity) {
+    aladScheduler *scheduler;
+    if (capacity < 1) capacity = 1;
+    scheduler = REINTERPRET_CAST(aladScheduler*, calloc(1, sizeof(aladScheduler)));
+    if (scheduler == nullptr) return nullptr;
+    if (!aladu_schedule_reserve_(scheduler, capacity)) {
+        free(scheduler);
+        return nullptr;
+    }
+    scheduler->device = device;
+    scheduler->timed = device != nullptr && aladALC.GetInteger64vSOFT != nullptr && aladAL.SourcePlayAtTimevSOFT != nullptr
+                    && aladALC.IsExtensionPresent != nullptr && aladALC.IsExtensionPresent(device, "ALC_SOFT_device_clock") ? AL_TRUE : AL_FALSE;
+    if (!scheduler->timed && !ALADU_HOST_CLOCK_) {
+        aladDestroyScheduler(scheduler);
+        return nullptr;
+    }
+    return scheduler;
+}
+void aladDestroyScheduler (aladScheduler *scheduler) {
+    if (scheduler == nullptr) return;
+    free(scheduler->heap);
+    free(scheduler);
+}
+ALint64SOFT aladGetSchedulerTime (aladScheduler *scheduler) {
+    ALCint64SOFT clock = 0;
+    if (scheduler == nullptr) return 0;
+    if (!scheduler->timed) return aladu_host_clock_();
+    aladALC.GetInteger64vSOFT(scheduler->device, ALC_DEVICE_CLOCK_SOFT, 1, &clock);
+    return (ALint64SOFT) clock;
+}
+ALboolean aladSchedulePlay (aladScheduler *scheduler, ALuint source, ALint64SOFT time) {
+    return aladu_schedule_(scheduler, source, time, AL_PLAYING);
+}
+ALboolean aladScheduleStop (aladScheduler *scheduler, ALuint source, ALint64SOFT time) {
+    return aladu_schedule_(scheduler, source, time, AL_STOPPED);
+}
+ALsizei aladCancelScheduled (aladScheduler *scheduler, ALuint source) {
+    ALsizei i, kept = 0, removed;
+    if (scheduler == nullptr) return 0;
+    for (i = 0; i < scheduler->count; i++) {
+        if (scheduler->heap[i].source != source) scheduler->heap[kept++] = scheduler->heap[i];
+    }
+    removed = scheduler->count - kept;
+    scheduler->count = kept;
+    for (i = kept / 2; i-- > 0;) aladu_schedule_sift_down_(scheduler, i);
+    return removed;
+}
+ALsizei aladUpdateScheduler (aladScheduler *scheduler, ALint64SOFT window) {
+    aladu_schedule_entry_ entry;
+    ALCcontext *frame;
+    ALint64SOFT now, limit, time = 0;
+    ALenum action = AL_NONE;
+    ALsizei n = 0, later = 0, sent = 0, i;
+    if (scheduler == nullptr || scheduler->count == 0) return 0;
+    now = aladGetSchedulerTime(scheduler);
+    /* without a start time, a start can't be sent ahead, so it waits until it is due like a stop */
+    limit = scheduler->timed && window > 0 ? now + window : now;
+    if (scheduler->heap[0].time > limit) return 0;
+    frame = aladBeginFrame(nullptr);
+    while (scheduler->count > 0 && scheduler->heap[0].time <= limit) {
+        entry = aladu_schedule_pop_(scheduler);
+        if (entry.time > now && (entry.action == AL_STOPPED || aladu_schedule_held_(scheduler, later, entry.source))) {
+            scheduler->later[later++] = entry;
+            continue;
+        }
+        if (entry.action != action || (action == AL_PLAYING && scheduler->timed && entry.time != time)) {
+            aladu_schedule_flush_(scheduler, action, time, n);
+            n = 0;
+            action = entry.action;
+            time = entry.time;
+        }
+        scheduler->batch[n++] = entry.source;
+        sent++;
+    }
+    aladu_schedule_flush_(scheduler, action, time, n);
+    aladEndFrame(frame);
+    for (i = 0; i < later; i++) aladu_schedule_push_(scheduler, &scheduler->later[i]);
+    return sent;
+}
+
+#endif        /* ALAD_UTILS_IMPLEMENTATION */
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif
+
+#endif        /* ALAD_UTILS_H */
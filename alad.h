@@ -35,15 +35,98 @@
  *          aladUpdateAL();
  *
  *  which will load all extensions, except AL_EXT_direct_context, with the current context and its device. If an extension is not present, its functions will be NULL, check for that.
+ *  To find out which ones are present, aladUpdateAL(); reads AL_EXTENSIONS and ALC_EXTENSIONS once and only asks the driver for the functions of those
+ *  it lists. The result is kept as a bitmask over the aladExtension enum (see the manual interface), which you can test with
+ *
+ *          if (aladGetExtensions() & ALAD_EXTENSION_BIT(ALAD_AL_SOFT_source_latency)) ...
+ *
+ *  or, equivalently and without asking the driver, with aladHasALExtension(ALAD_AL_SOFT_source_latency). aladHasALCExtension(device, extension) does
+ *  the same for ALC extensions; for a device other than the current one at the time of aladUpdateAL();, it reads the mask that aladRegisterDevice
+ *  (see below) keeps in the registry, and parses the device's extension string every time if the device isn't registered.
+ *  If you only have the name of an extension, aladFindExtension(name) returns its aladExtension (or ALAD_EXTENSION_COUNT if alad doesn't know it).
+ *
  *  The ALC functions are only valid for the current context's device (and technically the AL functions also for the context). If you change the device,
  *  call aladUpdateAL(); again. (If you make another context current, you can also do that, but most implementations of OpenAL will not differentiate
  *  between contexts on the same device for functionality, although it is allowed by the specification.)
  *
+ *  If you switch between several contexts, you can instead keep one table per context. aladFetchContextFunctions(context) takes the core
+ *  functions over from the table of the simplified interface and resolves only the AL extensions the context has, once, with the context
+ *  current on the calling thread (with alcSetThreadContext if the driver has ALC_EXT_thread_local_context, globally otherwise, switching back
+ *  afterwards). It keeps them in a small cache of ALAD_CONTEXT_CACHE_SIZE entries (8 by default, define it together with ALAD_IMPLEMENTATION
+ *  to change that), and returns NULL if that is full. aladActivateContextFunctions(context) then points aladActiveAL, and with it aladAL and
+ *  all the short names, at that table (it copies the table into aladAL, unless ALAD_THREAD_SAFE makes aladAL a macro, see below). It returns
+ *  ALC_FALSE if the cache is full, and NULL switches back to the table of aladLoadAL();. Making the context current is still up to you.
+ *  aladActivateFunctions(table) does the same for any table of yours (NULL again being the table of aladLoadAL();).
+ *  The table you get is never written again, and stays valid until the context is destroyed with alcDestroyContext (or with
+ *  aladInvalidateContextFunctions(context) if you destroy it some other way), or aladTerminate();. aladLoadAL(); and aladUpdateAL(); leave it
+ *  alone as well: since they replace the tables it was derived from, the next fetch gives the context a new table, and the old one is kept
+ *  until the context goes away. If a context's table is active, the new one is resolved right away and stays active, any other table that
+ *  is active then (like a layer of alad-utils.h) is replaced by the new table of the simplified interface.
+ *
+ *  The same goes for the ALC functions of several open devices: aladRegisterDevice(device) resolves an aladALCFunctions table with alcGetProcAddress
+ *  for that device once and returns it, aladGetDeviceFunctions(device) looks it up again (or returns NULL) without taking a lock, so it can be
+ *  used from any thread. The registry holds ALAD_DEVICE_REGISTRY_SIZE devices (16 by default, has to be a power of two), registering more returns NULL.
+ *  Devices are removed when they are closed successfully with alcCloseDevice or alcCaptureCloseDevice, or with aladUnregisterDevice(device); don't
+ *  remove a device while another thread still uses its table. A removed device's table stays where it is until aladTerminate();, so a device
+ *  registered later doesn't overwrite it, but it isn't updated either. If you need to clean up after a device yourself, aladSetCloseDeviceCallback(callback)
+ *  has alcCloseDevice call you first; it returns the callback set before, which you should call in turn. aladSetUpdateCallback(callback) works
+ *  the same way for aladLoadAL(); and aladUpdateAL();, which call you after they have published their new tables (and released their lock),
+ *  so that whatever copied the old ones (like the layers of alad-utils.h) can copy the new ones.
+ *
+ *  To apply many parameter changes at once, put them between aladBeginFrame(context) and aladEndFrame(context). The driver then holds back
+ *  the updates of that context (NULL for the current one) and applies them together at the outermost aladEndFrame, so you only sync with the
+ *  mixer once. Frames nest and can be open on several contexts at once. aladBeginFrame returns the context to pass to aladEndFrame, or NULL
+ *  if there is none or ALAD_FRAME_CONTEXTS contexts (8 by default) are already in a frame. The current context uses alDeferUpdatesSOFT,
+ *  other contexts and drivers without AL_SOFT_deferred_updates use alcSuspendContext. In C++, aladFrame frame; does the same for a scope.
+ *
  *  Once you're done using OpenAL, terminate the library with
  *
  *          aladTerminate();
  *  
  *  this will unload the shared library.
+ *
+ *  If you define
+ *
+ *          #define ALAD_LAZY_LOADING
+ *
+ *  together with ALAD_IMPLEMENTATION, aladLoadAL(); and aladUpdateAL(); won't resolve anything except alGetProcAddress and alcGetProcAddress.
+ *  Instead, every function pointer starts out pointing at a trampoline, which resolves the real function the first time it is called, replaces
+ *  itself in aladAL or aladALC and then calls through, so the startup cost only scales with the functions you actually use. The functions of
+ *  extensions that aren't listed are still set to NULL by aladUpdateAL();, but the core functions are never NULL before their first call.
+ *  A function that turns out to be missing is set to NULL on its first call, which returns 0. The ALC extensions are resolved for the device
+ *  they are called with: calls for the device of aladUpdateAL(); replace the trampoline, calls for a device registered with aladRegisterDevice
+ *  (see below) go through its table, and calls for any other device look the function up every time. A copy of aladAL or aladALC made before
+ *  the first call still holds the trampolines, which work, but cost a look into the table they came from on every call, and resolve the
+ *  function again as long as that hasn't been called; aladResolveAll(); resolves all of them at once, and
+ *
+ *          aladResolveFunction(&copy, offsetof(aladALFunctions, Sourcef));
+ *
+ *  only the given member of the copy (and of the table it came from), for a copy that only calls a few of them. Without ALAD_LAZY_LOADING,
+ *  both do nothing.
+ *
+ *  On Linux, you can also define
+ *
+ *          #define ALAD_GNU_HASH_RESOLVER
+ *
+ *  together with ALAD_IMPLEMENTATION, to have the functions loaded directly from the shared library (the core functions in aladLoadAL(); and
+ *  aladLoadALContextFree) resolved in one batch by reading its .dynsym and .gnu.hash sections, instead of calling dlsym for every name.
+ *  Anything that can't be found that way is still looked up with dlsym. This needs dlinfo, so _GNU_SOURCE has to be defined before any system header
+ *  is included, for example with -D_GNU_SOURCE.
+ *
+ *  aladLoadAL(); and aladUpdateAL(); can be called from any thread: the shared library is only opened once, and two calls at the same time
+ *  wait for each other. They still write into the tables other threads may be calling through, unless you also define
+ *
+ *          #define ALAD_THREAD_SAFE
+ *
+ *  wherever you include alad.h (not only together with ALAD_IMPLEMENTATION). Then aladAL and aladALC are macros for (*aladActiveAL) and
+ *  (*aladActiveALC) instead of objects, and the updates fill a copy of them and only switch aladActiveAL and aladActiveALC over to it once
+ *  it's complete, so other threads either see the old or the new table. Without ALAD_THREAD_SAFE, aladAL and aladALC stay objects, so you
+ *  can take their address or declare them yourself as before; aladAL then holds a copy of the table aladActiveAL points to.
+ *  A copy that comes out the same as the table it was taken from is dropped again, the others are kept around until aladTerminate();, which
+ *  mustn't run while other threads still use alad. If there's no memory for the copies, the old tables stay, and aladLoadAL(); and
+ *  aladUpdateAL(); return AL_FALSE (they return AL_TRUE otherwise, also without ALAD_THREAD_SAFE). The manual interfaces write into the
+ *  tables you give them, as before.
+ *
  *  The library should be named
  *      - OpenAL32.dll / soft_oal.dll on Windows
  *      - libopenal.so.1 / libopenal.so on Linux/BSD
@@ -64,15 +147,42 @@
  *         void aladLoadALCoreRest(aladALFunctions* functions, aladLoader loader);
  *         void aladLoadEFX(aladALFunctions* functions, aladLoader loader);
  *         void aladLoadALExtensions(aladALFunctions* functions, aladLoader loader);
- *         void aladLoadALCCore(aladALFunctions* functions, aladLoader loader);
- *         void aladLoadALCExtensions(aladALFunctions* functions, aladLoader loader);
+ *         void aladLoadALCCore(aladALCFunctions* functions, aladLoader loader);
+ *         void aladLoadALCExtensions(aladALCFunctions* functions, aladLoader loader);
  *         void aladLoadDirectExtension(aladDirectFunctions* functions, aladLoader loader);
  * 
  *  which together load all function pointers except alGetProcAddress and alcGetProcAddress (as the GetProcAddress member of aladALFunctions and aladALCFunctions respectively).
  *  These functions, unlike those of the legacy interface, can be intermixed with those loaded by the simplified interface. This means that one option is to first use the 
  *  simplified interface to load the function pointers from the DLL, and then use these functions to optain explicit function pointers by functions like alcGetProcAddress2.
- *  The wrapping to get those functions to fir the aladLoader type, such as currying the device handle, is something that you will have to do yourself.
+ *  Loaders that need more than the name, like alcGetProcAddress and alcGetProcAddress2 with their device, can be passed to the Ex variant of each
+ *  of these functions instead, which takes a loader with a user pointer and passes that pointer through on every call:
+ *
+ *         typedef aladFunction (*aladLoaderEx) (void *user, const char *name);
+ *         void aladLoadALCoreMinimalEx(aladALFunctions* functions, aladLoaderEx loader, void *user);
+ *         ... (likewise for the others)
+ *
+ *  alad brings two of those loaders along, aladALCDeviceLoader and aladDirectDeviceLoader, which call alcGetProcAddress and alcGetProcAddress2
+ *  with the ALCdevice* given as the user pointer (after aladLoadAL();), for example
+ *
+ *         aladLoadDirectExtensionEx(&directFunctions, aladDirectDeviceLoader, device);
+ *
+ *  Since no global state is involved, tables for different devices can be loaded in parallel from several threads this way.
  * 
+ *  All of these are views over three static tables, aladALTable, aladALCTable and aladDirectTable (of sizes aladALTableSize etc.), which list
+ *  every function name together with the offset of its member in the struct and the aladExtension it belongs to, sorted by that extension.
+ *  If you want to resolve a whole batch of functions in one go, for example with your own loader, walk them with
+ *
+ *         void aladResolveTable(const aladTableEntry *table, size_t count, aladLoader loader, void *dest);
+ *
+ *  (or aladResolveTableEx with an aladLoaderEx and user pointer), or, to only resolve the extensions that are actually present and set the others to NULL, with
+ *
+ *         aladExtensionMask aladParseExtensionString(const char *extensions);
+ *         void aladResolveExtensions(const aladTableEntry *table, size_t count, aladExtensionMask mask, aladLoader loader, void *dest);
+ *         void aladResolveExtensionsEx(const aladTableEntry *table, size_t count, aladExtensionMask mask, aladLoaderEx loader, void *user, void *dest);
+ *
+ *  where the mask is built from ALAD_EXTENSION_BIT(extension) for each aladExtension, e.g. by parsing the strings from alGetString(AL_EXTENSIONS) and
+ *  alcGetString(device, ALC_EXTENSIONS); include ALAD_CORE_EXTENSIONS if the table range you pass contains core functions.
+ *
  *  You might also want to consider defining the macro ALAD_NO_SHORT_NAMES, this will then not define names such as alGetInteger. Instead, after the default intialization aladLoadAL();,
  *  you will have to call aladAL.GetInteger. However, this also means you can define these names yourself without the use of #undef.
  *  
@@ -175,6 +285,9 @@ extern "C" {
 #endif
 
 
+#include <stddef.h>
+#include <string.h>
+
 #define AL_NO_PROTOTYPES
 #define ALC_NO_PROTOTYPES
 #include <AL/alext.h>
@@ -399,9 +512,10 @@ extern "C" {
 /* Public Interface: */
 
 /* simplified Interface */
-extern void                             aladLoadAL();
-extern void                             aladUpdateAL();
+extern ALboolean                        aladLoadAL();
+extern ALboolean                        aladUpdateAL();
 extern void                             aladTerminate();
+extern void                             aladResolveAll();
 
 /* old manual interface */
 extern void                             aladLoadALContextFree (ALboolean loadAll);
@@ -677,12 +791,12 @@ typedef struct aladDirectFunctions {
     LPALGETSOURCEIDIRECT                    alGetSourceiDirect;
     LPALGETSOURCE3IDIRECT                   alGetSource3iDirect;
     LPALGETSOURCEIVDIRECT                   alGetSourceivDirect;
-    LPALSOURCEPLAYVDIRECT                   alSourcePlayDirect;
-    LPALSOURCESTOPVDIRECT                   alSourceStopDirect;
+    LPALSOURCEPLAYDIRECT                    alSourcePlayDirect;
+    LPALSOURCESTOPDIRECT                    alSourceStopDirect;
     LPALSOURCEREWINDVDIRECT                 alSourceRewindvDirect;
     LPALSOURCEPAUSEVDIRECT                  alSourcePausevDirect;
-    LPALSOURCEPLAYDIRECT                    alSourcePlayvDirect;
-    LPALSOURCESTOPDIRECT                    alSourceStopvDirect;
+    LPALSOURCEPLAYVDIRECT                   alSourcePlayvDirect;
+    LPALSOURCESTOPVDIRECT                   alSourceStopvDirect;
     LPALSOURCEREWINDDIRECT                  alSourceRewindDirect;
     LPALSOURCEPAUSEDIRECT                   alSourcePauseDirect;
     LPALSOURCEQUEUEBUFFERSDIRECT            alSourceQueueBuffersDirect;
@@ -797,398 +911,755 @@ extern void aladLoadALCoreMinimal(aladALFunctions* functions, aladLoader loader)
 extern void aladLoadALCoreRest(aladALFunctions* functions, aladLoader loader);
 extern void aladLoadEFX(aladALFunctions* functions, aladLoader loader);
 extern void aladLoadALExtensions(aladALFunctions* functions, aladLoader loader);
-extern void aladLoadALCCore(aladALFunctions* functions, aladLoader loader);
-extern void aladLoadALCExtensions(aladALFunctions* functions, aladLoader loader);
+extern void aladLoadALCCore(aladALCFunctions* functions, aladLoader loader);
+extern void aladLoadALCExtensions(aladALCFunctions* functions, aladLoader loader);
 extern void aladLoadDirectExtension(aladDirectFunctions* functions, aladLoader loader);
 
-/* global function pointers used by the other interfaces */
+/* the same with a loader that gets a user pointer passed through, e.g. the device for alcGetProcAddress, so that no global state is involved */
+typedef aladFunction (*aladLoaderEx) (void *user, const char *name);
+extern void aladLoadALCoreMinimalEx(aladALFunctions* functions, aladLoaderEx loader, void *user);
+extern void aladLoadALCoreRestEx(aladALFunctions* functions, aladLoaderEx loader, void *user);
+extern void aladLoadEFXEx(aladALFunctions* functions, aladLoaderEx loader, void *user);
+extern void aladLoadALExtensionsEx(aladALFunctions* functions, aladLoaderEx loader, void *user);
+extern void aladLoadALCCoreEx(aladALCFunctions* functions, aladLoaderEx loader, void *user);
+extern void aladLoadALCExtensionsEx(aladALCFunctions* functions, aladLoaderEx loader, void *user);
+extern void aladLoadDirectExtensionEx(aladDirectFunctions* functions, aladLoaderEx loader, void *user);
+/* built-in aladLoaderEx adapters, user is the ALCdevice*: alcGetProcAddress(device, name) and alcGetProcAddress2(device, name);
+   both need aladLoadAL() (or at least aladALC.GetProcAddress) first */
+extern aladFunction aladALCDeviceLoader(void *device, const char *name);
+extern aladFunction aladDirectDeviceLoader(void *device, const char *name);
+
+/* the loaders above are views over these tables, which list every function name with the offset of its member and the extension it belongs to */
+typedef enum aladExtension {
+    /* core function groups */
+    ALAD_AL_CORE_MINIMAL,
+    ALAD_AL_CORE_REST,
+    ALAD_ALC_CORE,
+    /* ALC extensions */
+    ALAD_ALC_EXT_EFX,
+    ALAD_ALC_EXT_thread_local_context,
+    ALAD_ALC_SOFT_loopback,
+    ALAD_ALC_SOFT_pause_device,
+    ALAD_ALC_SOFT_HRTF,
+    ALAD_ALC_SOFT_device_clock,
+    ALAD_ALC_SOFT_reopen_device,
+    ALAD_ALC_SOFT_system_events,
+    ALAD_ALC_EXT_direct_context,
+    /* AL extensions */
+    ALAD_AL_EXT_STATIC_BUFFER,
+    ALAD_AL_SOFT_buffer_sub_data,
+    ALAD_AL_EXT_FOLDBACK,
+    ALAD_AL_SOFT_buffer_samples,
+    ALAD_AL_SOFT_source_latency,
+    ALAD_AL_SOFT_deferred_updates,
+    ALAD_AL_SOFT_source_resampler,
+    ALAD_AL_SOFT_events,
+    ALAD_AL_SOFT_callback_buffer,
+    ALAD_AL_SOFT_source_start_delay,
+    ALAD_AL_EXT_debug,
+    ALAD_EXTENSION_COUNT
+} aladExtension;
+typedef struct aladTableEntry {
+    const char     *name;
+    size_t          offset;
+    unsigned short  extension;
+} aladTableEntry;
+extern const aladTableEntry aladALTable[];
+extern const aladTableEntry aladALCTable[];
+extern const aladTableEntry aladDirectTable[];
+extern const size_t aladALTableSize;
+extern const size_t aladALCTableSize;
+extern const size_t aladDirectTableSize;
+/* resolves every entry of the table with the loader and stores it at its offset into dest, which has to be the matching aladXFunctions struct */
+extern void aladResolveTable(const aladTableEntry *table, size_t count, aladLoader loader, void *dest);
+extern void aladResolveTableEx(const aladTableEntry *table, size_t count, aladLoaderEx loader, void *user, void *dest);
+
+/* a set of aladExtensions, with the core groups counting as always present */
+typedef unsigned long aladExtensionMask;
+#define ALAD_EXTENSION_BIT(extension) (1UL << (extension))
+#define ALAD_CORE_EXTENSIONS          (ALAD_EXTENSION_BIT(ALAD_AL_CORE_MINIMAL) | ALAD_EXTENSION_BIT(ALAD_AL_CORE_REST) | ALAD_EXTENSION_BIT(ALAD_ALC_CORE))
+/* returns the known extensions in a space separated extension string, like the one from alGetString(AL_EXTENSIONS) */
+extern aladExtensionMask aladParseExtensionString(const char *extensions);
+/* like aladResolveTable, but only resolves the entries whose extension is in the mask, and sets the others to NULL */
+extern void aladResolveExtensions(const aladTableEntry *table, size_t count, aladExtensionMask mask, aladLoader loader, void *dest);
+extern void aladResolveExtensionsEx(const aladTableEntry *table, size_t count, aladExtensionMask mask, aladLoaderEx loader, void *user, void *dest);
+/* the extensions found by the last aladUpdateAL */
+extern aladExtensionMask aladGetExtensions(void);
+/* single bit tests against that; other devices are looked up in the device registry, and asked every time if they aren't registered */
+extern ALboolean aladHasALExtension(aladExtension extension);
+extern ALCboolean aladHasALCExtension(ALCdevice *device, aladExtension extension);
+/* returns the aladExtension with the given name, or ALAD_EXTENSION_COUNT if alad doesn't know it */
+extern aladExtension aladFindExtension(const char *name);
+
+/* global function pointers used by the other interfaces; with ALAD_THREAD_SAFE, aladAL and aladALC are whichever tables aladActiveAL and
+   aladActiveALC point to, otherwise they are objects, aladAL holding a copy of the table aladActiveAL points to */
+#ifdef ALAD_THREAD_SAFE
+extern aladALFunctions *aladActiveAL;
+#define aladAL (*aladActiveAL)
+extern aladALCFunctions *aladActiveALC;
+#define aladALC (*aladActiveALC)
+#else
 extern aladALFunctions aladAL;
 extern aladALCFunctions aladALC;
+extern aladALFunctions *aladActiveAL;
+extern aladALCFunctions *aladActiveALC;
+#endif
+/* makes the given table the one aladAL calls through, NULL for the table of the simplified interface */
+extern void aladActivateFunctions(aladALFunctions *functions);
+/* resolves the member at the offset in the table, if it still holds its trampoline (see ALAD_LAZY_LOADING) */
+extern void aladResolveFunction(aladALFunctions *functions, size_t offset);
+
+/* per-context cache of AL function tables, each resolved once with its context current on this thread; a table stays valid and unchanged
+   until its context is invalidated or aladTerminate, aladLoadAL and aladUpdateAL only have the next fetch derive a new one (right away
+   for an active context table, which stays active) and activate their own table in place of any other */
+extern aladALFunctions* aladFetchContextFunctions(ALCcontext *context);
+extern ALCboolean aladActivateContextFunctions(ALCcontext *context);
+extern void aladInvalidateContextFunctions(ALCcontext *context);
+
+/* per-device registry of ALC function tables, each resolved once with alcGetProcAddress for its device; lookups don't take a lock */
+extern aladALCFunctions* aladRegisterDevice(ALCdevice *device);
+extern aladALCFunctions* aladGetDeviceFunctions(ALCdevice *device);
+extern void aladUnregisterDevice(ALCdevice *device);
+
+/* called by alcCloseDevice (as installed by aladLoadAL) before the device is closed; returns the previous callback, so they can be chained */
+typedef void (*aladCloseDeviceCallback) (ALCdevice *device);
+extern aladCloseDeviceCallback aladSetCloseDeviceCallback(aladCloseDeviceCallback callback);
+
+/* called by aladLoadAL and aladUpdateAL after they published their tables, without their lock held; returns the previous callback, so they
+   can be chained */
+typedef void (*aladUpdateCallback) (void);
+extern aladUpdateCallback aladSetUpdateCallback(aladUpdateCallback callback);
+
+/* frame scopes, which defer the updates of a context (NULL for the current one) until the outermost aladEndFrame; aladBeginFrame returns
+   the context the frame was started for, to be passed to aladEndFrame, or NULL if there was none or ALAD_FRAME_CONTEXTS are already in a frame */
+extern ALCcontext* aladBeginFrame(ALCcontext *context);
+extern void aladEndFrame(ALCcontext *context);
 
 
 
 #ifdef ALAD_IMPLEMENTATION
 
-aladALFunctions aladAL = {0};
-aladALCFunctions aladALC = {0};
+/* without ALAD_THREAD_SAFE, the tables are written in place, so aladALC can be the ALC table of the simplified interface itself */
+#ifdef ALAD_THREAD_SAFE
+static aladALFunctions alad_default_al_;
+static aladALCFunctions alad_default_alc_;
+#else
+aladALFunctions aladAL;
+aladALCFunctions aladALC;
+static aladALFunctions alad_default_al_;
+#define alad_default_alc_ aladALC
+#endif
+aladALFunctions *aladActiveAL = &alad_default_al_;
+aladALCFunctions *aladActiveALC = &alad_default_alc_;
+/* the AL table of the simplified interface, which aladActiveAL points to unless a context's table is activated */
+static aladALFunctions *alad_main_al_ = &alad_default_al_;
+
+#include <stdlib.h>
+
+#ifdef AL_API_NOEXCEPT17
+#define ALAD_NOEXCEPT_ AL_API_NOEXCEPT17
+#else
+#define ALAD_NOEXCEPT_
+#endif
+
+/* atomics for the lock-free read paths and the initialization, the loads acquire and the stores release */
+#if defined(__GNUC__) || defined(__clang__)
+static void* alad_atomic_load_ptr_ (void * volatile *p)              { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+static void  alad_atomic_store_ptr_ (void * volatile *p, void *v)    { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+static long  alad_atomic_load_long_ (volatile long *p)               { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+static void  alad_atomic_store_long_ (volatile long *p, long v)      { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+static long  alad_atomic_exchange_long_ (volatile long *p, long v)   { return __atomic_exchange_n(p, v, __ATOMIC_ACQ_REL); }
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#if defined(_M_IX86) || defined(_M_X64)
+/* plain loads already have acquire semantics on x86, they only must not be reordered by the compiler */
+static void* alad_atomic_load_ptr_ (void * volatile *p)              { void *v = *p; _ReadWriteBarrier(); return v; }
+static long  alad_atomic_load_long_ (volatile long *p)               { long v = *p; _ReadWriteBarrier(); return v; }
+#else
+static void* alad_atomic_load_ptr_ (void * volatile *p)              { return _InterlockedCompareExchangePointer(p, nullptr, nullptr); }
+static long  alad_atomic_load_long_ (volatile long *p)               { return _InterlockedCompareExchange(p, 0, 0); }
+#endif
+static void  alad_atomic_store_ptr_ (void * volatile *p, void *v)    { _InterlockedExchangePointer(p, v); }
+static void  alad_atomic_store_long_ (volatile long *p, long v)      { _InterlockedExchange(p, v); }
+static long  alad_atomic_exchange_long_ (volatile long *p, long v)   { return _InterlockedExchange(p, v); }
+#else
+/* no known atomics, so this is only safe as long as a single thread uses alad */
+static void* alad_atomic_load_ptr_ (void * volatile *p)              { return *p; }
+static void  alad_atomic_store_ptr_ (void * volatile *p, void *v)    { *p = v; }
+static long  alad_atomic_load_long_ (volatile long *p)               { return *p; }
+static void  alad_atomic_store_long_ (volatile long *p, long v)      { *p = v; }
+static long  alad_atomic_exchange_long_ (volatile long *p, long v)   { long old = *p; *p = v; return old; }
+#endif
+static void alad_spin_lock_ (volatile long *lock) {
+    while (alad_atomic_exchange_long_(lock, 1) != 0) {
+        while (alad_atomic_load_long_(lock) != 0);
+    }
+}
+static void alad_spin_unlock_ (volatile long *lock) {
+    alad_atomic_store_long_(lock, 0);
+}
+/* without ALAD_THREAD_SAFE, aladAL isn't switched over to the table but gets a copy of it */
+static void alad_activate_ (aladALFunctions *functions) {
+#ifdef ALAD_THREAD_SAFE
+    alad_atomic_store_ptr_(REINTERPRET_CAST(void * volatile *, &aladActiveAL), functions);
+#else
+    aladActiveAL = functions;
+    aladAL = *functions;
+#endif
+}
 
 /* new manual interface */
 
-void aladLoadALCoreMinimal(aladALFunctions* functions, aladLoader loader) {
-    functions[0].Enable             = REINTERPRET_CAST(LPALENABLE,              loader("alEnable"));
-    functions[0].Disable            = REINTERPRET_CAST(LPALDISABLE,             loader("alDisable"));
-    functions[0].IsEnabled          = REINTERPRET_CAST(LPALISENABLED,           loader("alIsEnabled"));
-    functions[0].GetString          = REINTERPRET_CAST(LPALGETSTRING,           loader("alGetString"));
-    functions[0].GetBooleanv        = REINTERPRET_CAST(LPALGETBOOLEANV,         loader("alGetBooleanv"));
-    functions[0].GetIntegerv        = REINTERPRET_CAST(LPALGETINTEGERV,         loader("alGetIntegerv"));
-    functions[0].GetFloatv          = REINTERPRET_CAST(LPALGETFLOATV,           loader("alGetFloatv"));
-    functions[0].GetDoublev         = REINTERPRET_CAST(LPALGETDOUBLEV,          loader("alGetDoublev"));
-    functions[0].GetBoolean         = REINTERPRET_CAST(LPALGETBOOLEAN,          loader("alGetBoolean"));
-    functions[0].GetInteger         = REINTERPRET_CAST(LPALGETINTEGER,          loader("alGetInteger"));
-    functions[0].GetFloat           = REINTERPRET_CAST(LPALGETFLOAT,            loader("alGetFloat"));
-    functions[0].GetDouble          = REINTERPRET_CAST(LPALGETDOUBLE,           loader("alGetDouble"));
-    functions[0].GetError           = REINTERPRET_CAST(LPALGETERROR,            loader("alGetError"));
-    functions[0].IsExtensionPresent = REINTERPRET_CAST(LPALISEXTENSIONPRESENT,  loader("alIsExtensionPresent"));
-    functions[0].GetEnumValue       = REINTERPRET_CAST(LPALGETENUMVALUE,        loader("alGetEnumValue"));        
-}
-void aladLoadALCoreRest(aladALFunctions* functions, aladLoader loader) {
-    functions[0].DopplerFactor        = REINTERPRET_CAST(LPALDOPPLERFACTOR,         loader("alDopplerFactor"));
-    functions[0].DopplerVelocity      = REINTERPRET_CAST(LPALDOPPLERVELOCITY,       loader("alDopplerVelocity"));
-    functions[0].SpeedOfSound         = REINTERPRET_CAST(LPALSPEEDOFSOUND,          loader("alSpeedOfSound"));
-    functions[0].DistanceModel        = REINTERPRET_CAST(LPALDISTANCEMODEL,         loader("alDistanceModel"));
-    functions[0].Listenerf            = REINTERPRET_CAST(LPALLISTENERF,             loader("alListenerf"));
-    functions[0].Listener3f           = REINTERPRET_CAST(LPALLISTENER3F,            loader("alListener3f"));
-    functions[0].Listenerfv           = REINTERPRET_CAST(LPALLISTENERFV,            loader("alListenerfv"));
-    functions[0].Listeneri            = REINTERPRET_CAST(LPALLISTENERI,             loader("alListeneri"));
-    functions[0].Listener3i           = REINTERPRET_CAST(LPALLISTENER3I,            loader("alListener3i"));
-    functions[0].Listeneriv           = REINTERPRET_CAST(LPALLISTENERIV,            loader("alListeneriv"));
-    functions[0].GetListenerf         = REINTERPRET_CAST(LPALGETLISTENERF,          loader("alGetListenerf"));
-    functions[0].GetListener3f        = REINTERPRET_CAST(LPALGETLISTENER3F,         loader("alGetListener3f"));
-    functions[0].GetListenerfv        = REINTERPRET_CAST(LPALGETLISTENERFV,         loader("alGetListenerfv"));
-    functions[0].GetListeneri         = REINTERPRET_CAST(LPALGETLISTENERI,          loader("alGetListeneri"));
-    functions[0].GetListener3i        = REINTERPRET_CAST(LPALGETLISTENER3I,         loader("alGetListener3i"));
-    functions[0].GetListeneriv        = REINTERPRET_CAST(LPALGETLISTENERIV,         loader("alGetListeneriv"));
-    functions[0].GenSources           = REINTERPRET_CAST(LPALGENSOURCES,            loader("alGenSources"));
-    functions[0].DeleteSources        = REINTERPRET_CAST(LPALDELETESOURCES,         loader("alDeleteSources"));
-    functions[0].IsSource             = REINTERPRET_CAST(LPALISSOURCE,              loader("alIsSource"));
-    functions[0].Sourcef              = REINTERPRET_CAST(LPALSOURCEF,               loader("alSourcef"));
-    functions[0].Source3f             = REINTERPRET_CAST(LPALSOURCE3F,              loader("alSource3f"));
-    functions[0].Sourcefv             = REINTERPRET_CAST(LPALSOURCEFV,              loader("alSourcefv"));
-    functions[0].Sourcei              = REINTERPRET_CAST(LPALSOURCEI,               loader("alSourcei"));
-    functions[0].Source3i             = REINTERPRET_CAST(LPALSOURCE3I,              loader("alSource3i"));
-    functions[0].Sourceiv             = REINTERPRET_CAST(LPALSOURCEIV,              loader("alSourceiv"));
-    functions[0].GetSourcef           = REINTERPRET_CAST(LPALGETSOURCEF,            loader("alGetSourcef"));
-    functions[0].GetSource3f          = REINTERPRET_CAST(LPALGETSOURCE3F,           loader("alGetSource3f"));
-    functions[0].GetSourcefv          = REINTERPRET_CAST(LPALGETSOURCEFV,           loader("alGetSourcefv"));
-    functions[0].GetSourcei           = REINTERPRET_CAST(LPALGETSOURCEI,            loader("alGetSourcei"));
-    functions[0].GetSource3i          = REINTERPRET_CAST(LPALGETSOURCE3I,           loader("alGetSource3i"));
-    functions[0].GetSourceiv          = REINTERPRET_CAST(LPALGETSOURCEIV,           loader("alGetSourceiv"));
-    functions[0].SourcePlayv          = REINTERPRET_CAST(LPALSOURCEPLAYV,           loader("alSourcePlayv"));
-    functions[0].SourceStopv          = REINTERPRET_CAST(LPALSOURCESTOPV,           loader("alSourceStopv"));
-    functions[0].SourceRewindv        = REINTERPRET_CAST(LPALSOURCEREWINDV,         loader("alSourceRewindv"));
-    functions[0].SourcePausev         = REINTERPRET_CAST(LPALSOURCEPAUSEV,          loader("alSourcePausev"));
-    functions[0].SourcePlay           = REINTERPRET_CAST(LPALSOURCEPLAY,            loader("alSourcePlay"));
-    functions[0].SourceStop           = REINTERPRET_CAST(LPALSOURCESTOP,            loader("alSourceStop"));
-    functions[0].SourceRewind         = REINTERPRET_CAST(LPALSOURCEREWIND,          loader("alSourceRewind"));
-    functions[0].SourcePause          = REINTERPRET_CAST(LPALSOURCEPAUSE,           loader("alSourcePause"));
-    functions[0].SourceQueueBuffers   = REINTERPRET_CAST(LPALSOURCEQUEUEBUFFERS,    loader("alSourceQueueBuffers"));
-    functions[0].SourceUnqueueBuffers = REINTERPRET_CAST(LPALSOURCEUNQUEUEBUFFERS,  loader("alSourceUnqueueBuffers"));
-    functions[0].GenBuffers           = REINTERPRET_CAST(LPALGENBUFFERS,            loader("alGenBuffers"));
-    functions[0].DeleteBuffers        = REINTERPRET_CAST(LPALDELETEBUFFERS,         loader("alDeleteBuffers"));
-    functions[0].IsBuffer             = REINTERPRET_CAST(LPALISBUFFER,              loader("alIsBuffer"));
-    functions[0].BufferData           = REINTERPRET_CAST(LPALBUFFERDATA,            loader("alBufferData"));
-    functions[0].Bufferf              = REINTERPRET_CAST(LPALBUFFERF,               loader("alBufferf"));
-    functions[0].Buffer3f             = REINTERPRET_CAST(LPALBUFFER3F,              loader("alBuffer3f"));
-    functions[0].Bufferfv             = REINTERPRET_CAST(LPALBUFFERFV,              loader("alBufferfv"));
-    functions[0].Bufferi              = REINTERPRET_CAST(LPALBUFFERI,               loader("alBufferi"));
-    functions[0].Buffer3i             = REINTERPRET_CAST(LPALBUFFER3I,              loader("alBuffer3i"));
-    functions[0].Bufferiv             = REINTERPRET_CAST(LPALBUFFERIV,              loader("alBufferiv"));
-    functions[0].GetBufferf           = REINTERPRET_CAST(LPALGETBUFFERF,            loader("alGetBufferf"));
-    functions[0].GetBuffer3f          = REINTERPRET_CAST(LPALGETBUFFER3F,           loader("alGetBuffer3f"));
-    functions[0].GetBufferfv          = REINTERPRET_CAST(LPALGETBUFFERFV,           loader("alGetBufferfv"));
-    functions[0].GetBufferi           = REINTERPRET_CAST(LPALGETBUFFERI,            loader("alGetBufferi"));
-    functions[0].GetBuffer3i          = REINTERPRET_CAST(LPALGETBUFFER3I,           loader("alGetBuffer3i"));
-    functions[0].GetBufferiv          = REINTERPRET_CAST(LPALGETBUFFERIV,           loader("alGetBufferiv"));
-}
-void aladLoadEFX(aladALFunctions* functions, aladLoader loader) {
-    functions[0].GenEffects                  = REINTERPRET_CAST(LPALGENEFFECTS,                     loader("alGenEffects"));
-    functions[0].DeleteEffects               = REINTERPRET_CAST(LPALDELETEEFFECTS,                  loader("alDeleteEffects"));
-    functions[0].IsEffect                    = REINTERPRET_CAST(LPALISEFFECT,                       loader("alIsEffect"));
-    functions[0].Effecti                     = REINTERPRET_CAST(LPALEFFECTI,                        loader("alEffecti"));
-    functions[0].Effectiv                    = REINTERPRET_CAST(LPALEFFECTIV,                       loader("alEffectiv"));
-    functions[0].Effectf                     = REINTERPRET_CAST(LPALEFFECTF,                        loader("alEffectf"));
-    functions[0].Effectfv                    = REINTERPRET_CAST(LPALEFFECTFV,                       loader("alEffectfv"));
-    functions[0].GetEffecti                  = REINTERPRET_CAST(LPALGETEFFECTI,                     loader("alGetEffecti"));
-    functions[0].GetEffectiv                 = REINTERPRET_CAST(LPALGETEFFECTIV,                    loader("alGetEffectiv"));
-    functions[0].GetEffectf                  = REINTERPRET_CAST(LPALGETEFFECTF,                     loader("alGetEffectf"));
-    functions[0].GetEffectfv                 = REINTERPRET_CAST(LPALGETEFFECTFV,                    loader("alGetEffectfv"));
-    functions[0].GenFilters                  = REINTERPRET_CAST(LPALGENFILTERS,                     loader("alGenFilters"));
-    functions[0].DeleteFilters               = REINTERPRET_CAST(LPALDELETEFILTERS,                  loader("alDeleteFilters"));
-    functions[0].IsFilter                    = REINTERPRET_CAST(LPALISFILTER,                       loader("alIsFilter"));
-    functions[0].Filteri                     = REINTERPRET_CAST(LPALFILTERI,                        loader("alFilteri"));
-    functions[0].Filteriv                    = REINTERPRET_CAST(LPALFILTERIV,                       loader("alFilteriv"));
-    functions[0].Filterf                     = REINTERPRET_CAST(LPALFILTERF,                        loader("alFilterf"));
-    functions[0].Filterfv                    = REINTERPRET_CAST(LPALFILTERFV,                       loader("alFilterfv"));
-    functions[0].GetFilteri                  = REINTERPRET_CAST(LPALGETFILTERI,                     loader("alGetFilteri"));
-    functions[0].GetFilteriv                 = REINTERPRET_CAST(LPALGETFILTERIV,                    loader("alGetFilteriv"));
-    functions[0].GetFilterf                  = REINTERPRET_CAST(LPALGETFILTERF,                     loader("alGetFilterf"));
-    functions[0].GetFilterfv                 = REINTERPRET_CAST(LPALGETFILTERFV,                    loader("alGetFilterfv"));
-    functions[0].GenAuxiliaryEffectSlots     = REINTERPRET_CAST(LPALGENAUXILIARYEFFECTSLOTS,        loader("alGenAuxiliaryEffectSlots"));
-    functions[0].DeleteAuxiliaryEffectSlots  = REINTERPRET_CAST(LPALDELETEAUXILIARYEFFECTSLOTS,     loader("alDeleteAuxiliaryEffectSlots"));
-    functions[0].IsAuxiliaryEffectSlot       = REINTERPRET_CAST(LPALISAUXILIARYEFFECTSLOT,          loader("alIsAuxiliaryEffectSlot"));
-    functions[0].AuxiliaryEffectSloti        = REINTERPRET_CAST(LPALAUXILIARYEFFECTSLOTI,           loader("alAuxiliaryEffectSloti"));
-    functions[0].AuxiliaryEffectSlotiv       = REINTERPRET_CAST(LPALAUXILIARYEFFECTSLOTIV,          loader("alAuxiliaryEffectSlotiv"));
-    functions[0].AuxiliaryEffectSlotf        = REINTERPRET_CAST(LPALAUXILIARYEFFECTSLOTF,           loader("alAuxiliaryEffectSlotf"));
-    functions[0].AuxiliaryEffectSlotfv       = REINTERPRET_CAST(LPALAUXILIARYEFFECTSLOTFV,          loader("alAuxiliaryEffectSlotfv"));
-    functions[0].GetAuxiliaryEffectSloti     = REINTERPRET_CAST(LPALGETAUXILIARYEFFECTSLOTI,        loader("alGetAuxiliaryEffectSloti"));
-    functions[0].GetAuxiliaryEffectSlotiv    = REINTERPRET_CAST(LPALGETAUXILIARYEFFECTSLOTIV,       loader("alGetAuxiliaryEffectSlotiv"));
-    functions[0].GetAuxiliaryEffectSlotf     = REINTERPRET_CAST(LPALGETAUXILIARYEFFECTSLOTF,        loader("alGetAuxiliaryEffectSlotf"));
-    functions[0].GetAuxiliaryEffectSlotfv    = REINTERPRET_CAST(LPALGETAUXILIARYEFFECTSLOTFV,       loader("alGetAuxiliaryEffectSlotfv"));
-}
-void aladLoadALExtensions(aladALFunctions* functions, aladLoader loader) {
-    /* AL_EXT_STATIC_BUFFER */
-    functions[0].BufferDataStatic            = REINTERPRET_CAST(PFNALBUFFERDATASTATICPROC,          loader("alBufferDataStatic"));
-    /* AL_SOFT_buffer_sub_data */
-    functions[0].BufferSubDataSOFT           = REINTERPRET_CAST(PFNALBUFFERSUBDATASOFTPROC,         loader("alBufferSubDataSOFT"));
+#define ALAD_AL_ENTRY_(member, name, extension)     { name, offsetof(aladALFunctions, member), extension }
+#define ALAD_ALC_ENTRY_(member, name, extension)    { name, offsetof(aladALCFunctions, member), extension }
+#define ALAD_DIRECT_ENTRY_(member, name, extension) { name, offsetof(aladDirectFunctions, member), extension }
+
+/* every function of aladALFunctions and aladALCFunctions (except GetProcAddress) with its signature, sorted by extension; the tables below
+   and the trampolines of ALAD_LAZY_LOADING are both generated from these lists. X takes the return type first, XV is for functions without
+   one. The ALC list also names the parameter that holds the device the function is for, or nullptr if it doesn't take one. */
+#define ALAD_AL_FUNCTIONS_(X, XV) \
+    /* Minimal Core AL */                                                                                                                                           \
+    XV(               Enable,             LPALENABLE,             "alEnable",             ALAD_AL_CORE_MINIMAL, (ALenum capability),               (capability))    \
+    XV(               Disable,            LPALDISABLE,            "alDisable",            ALAD_AL_CORE_MINIMAL, (ALenum capability),               (capability))    \
+    X (ALboolean,     IsEnabled,          LPALISENABLED,          "alIsEnabled",          ALAD_AL_CORE_MINIMAL, (ALenum capability),               (capability))    \
+    X (const ALchar*, GetString,          LPALGETSTRING,          "alGetString",          ALAD_AL_CORE_MINIMAL, (ALenum param),                    (param))         \
+    XV(               GetBooleanv,        LPALGETBOOLEANV,        "alGetBooleanv",        ALAD_AL_CORE_MINIMAL, (ALenum param, ALboolean *values), (param, values)) \
+    XV(               GetIntegerv,        LPALGETINTEGERV,        "alGetIntegerv",        ALAD_AL_CORE_MINIMAL, (ALenum param, ALint *values),     (param, values)) \
+    XV(               GetFloatv,          LPALGETFLOATV,          "alGetFloatv",          ALAD_AL_CORE_MINIMAL, (ALenum param, ALfloat *values),   (param, values)) \
+    XV(               GetDoublev,         LPALGETDOUBLEV,         "alGetDoublev",         ALAD_AL_CORE_MINIMAL, (ALenum param, ALdouble *values),  (param, values)) \
+    X (ALboolean,     GetBoolean,         LPALGETBOOLEAN,         "alGetBoolean",         ALAD_AL_CORE_MINIMAL, (ALenum param),                    (param))         \
+    X (ALint,         GetInteger,         LPALGETINTEGER,         "alGetInteger",         ALAD_AL_CORE_MINIMAL, (ALenum param),                    (param))         \
+    X (ALfloat,       GetFloat,           LPALGETFLOAT,           "alGetFloat",           ALAD_AL_CORE_MINIMAL, (ALenum param),                    (param))         \
+    X (ALdouble,      GetDouble,          LPALGETDOUBLE,          "alGetDouble",          ALAD_AL_CORE_MINIMAL, (ALenum param),                    (param))         \
+    X (ALenum,        GetError,           LPALGETERROR,           "alGetError",           ALAD_AL_CORE_MINIMAL, (void),                            ())              \
+    X (ALboolean,     IsExtensionPresent, LPALISEXTENSIONPRESENT, "alIsExtensionPresent", ALAD_AL_CORE_MINIMAL, (const ALchar *extname),           (extname))       \
+    X (ALenum,        GetEnumValue,       LPALGETENUMVALUE,       "alGetEnumValue",       ALAD_AL_CORE_MINIMAL, (const ALchar *ename),             (ename))         \
+    /* Rest of Core AL */                                                                                                                                                                                                                      \
+    XV(           DopplerFactor,        LPALDOPPLERFACTOR,        "alDopplerFactor",        ALAD_AL_CORE_REST, (ALfloat value),                                                                      (value))                                  \
+    XV(           DopplerVelocity,      LPALDOPPLERVELOCITY,      "alDopplerVelocity",      ALAD_AL_CORE_REST, (ALfloat value),                                                                      (value))                                  \
+    XV(           SpeedOfSound,         LPALSPEEDOFSOUND,         "alSpeedOfSound",         ALAD_AL_CORE_REST, (ALfloat value),                                                                      (value))                                  \
+    XV(           DistanceModel,        LPALDISTANCEMODEL,        "alDistanceModel",        ALAD_AL_CORE_REST, (ALenum distanceModel),                                                               (distanceModel))                          \
+    XV(           Listenerf,            LPALLISTENERF,            "alListenerf",            ALAD_AL_CORE_REST, (ALenum param, ALfloat value),                                                        (param, value))                           \
+    XV(           Listener3f,           LPALLISTENER3F,           "alListener3f",           ALAD_AL_CORE_REST, (ALenum param, ALfloat value1, ALfloat value2, ALfloat value3),                       (param, value1, value2, value3))          \
+    XV(           Listenerfv,           LPALLISTENERFV,           "alListenerfv",           ALAD_AL_CORE_REST, (ALenum param, const ALfloat *values),                                                (param, values))                          \
+    XV(           Listeneri,            LPALLISTENERI,            "alListeneri",            ALAD_AL_CORE_REST, (ALenum param, ALint value),                                                          (param, value))                           \
+    XV(           Listener3i,           LPALLISTENER3I,           "alListener3i",           ALAD_AL_CORE_REST, (ALenum param, ALint value1, ALint value2, ALint value3),                             (param, value1, value2, value3))          \
+    XV(           Listeneriv,           LPALLISTENERIV,           "alListeneriv",           ALAD_AL_CORE_REST, (ALenum param, const ALint *values),                                                  (param, values))                          \
+    XV(           GetListenerf,         LPALGETLISTENERF,         "alGetListenerf",         ALAD_AL_CORE_REST, (ALenum param, ALfloat *value),                                                       (param, value))                           \
+    XV(           GetListener3f,        LPALGETLISTENER3F,        "alGetListener3f",        ALAD_AL_CORE_REST, (ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3),                    (param, value1, value2, value3))          \
+    XV(           GetListenerfv,        LPALGETLISTENERFV,        "alGetListenerfv",        ALAD_AL_CORE_REST, (ALenum param, ALfloat *values),                                                      (param, values))                          \
+    XV(           GetListeneri,         LPALGETLISTENERI,         "alGetListeneri",         ALAD_AL_CORE_REST, (ALenum param, ALint *value),                                                         (param, value))                           \
+    XV(           GetListener3i,        LPALGETLISTENER3I,        "alGetListener3i",        ALAD_AL_CORE_REST, (ALenum param, ALint *value1, ALint *value2, ALint *value3),                          (param, value1, value2, value3))          \
+    XV(           GetListeneriv,        LPALGETLISTENERIV,        "alGetListeneriv",        ALAD_AL_CORE_REST, (ALenum param, ALint *values),                                                        (param, values))                          \
+    XV(           GenSources,           LPALGENSOURCES,           "alGenSources",           ALAD_AL_CORE_REST, (ALsizei n, ALuint *sources),                                                         (n, sources))                             \
+    XV(           DeleteSources,        LPALDELETESOURCES,        "alDeleteSources",        ALAD_AL_CORE_REST, (ALsizei n, const ALuint *sources),                                                   (n, sources))                             \
+    X (ALboolean, IsSource,             LPALISSOURCE,             "alIsSource",             ALAD_AL_CORE_REST, (ALuint source),                                                                      (source))                                 \
+    XV(           Sourcef,              LPALSOURCEF,              "alSourcef",              ALAD_AL_CORE_REST, (ALuint source, ALenum param, ALfloat value),                                         (source, param, value))                   \
+    XV(           Source3f,             LPALSOURCE3F,             "alSource3f",             ALAD_AL_CORE_REST, (ALuint source, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3),        (source, param, value1, value2, value3))  \
+    XV(           Sourcefv,             LPALSOURCEFV,             "alSourcefv",             ALAD_AL_CORE_REST, (ALuint source, ALenum param, const ALfloat *values),                                 (source, param, values))                  \
+    XV(           Sourcei,              LPALSOURCEI,              "alSourcei",              ALAD_AL_CORE_REST, (ALuint source, ALenum param, ALint value),                                           (source, param, value))                   \
+    XV(           Source3i,             LPALSOURCE3I,             "alSource3i",             ALAD_AL_CORE_REST, (ALuint source, ALenum param, ALint value1, ALint value2, ALint value3),              (source, param, value1, value2, value3))  \
+    XV(           Sourceiv,             LPALSOURCEIV,             "alSourceiv",             ALAD_AL_CORE_REST, (ALuint source, ALenum param, const ALint *values),                                   (source, param, values))                  \
+    XV(           GetSourcef,           LPALGETSOURCEF,           "alGetSourcef",           ALAD_AL_CORE_REST, (ALuint source, ALenum param, ALfloat *value),                                        (source, param, value))                   \
+    XV(           GetSource3f,          LPALGETSOURCE3F,          "alGetSource3f",          ALAD_AL_CORE_REST, (ALuint source, ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3),     (source, param, value1, value2, value3))  \
+    XV(           GetSourcefv,          LPALGETSOURCEFV,          "alGetSourcefv",          ALAD_AL_CORE_REST, (ALuint source, ALenum param, ALfloat *values),                                       (source, param, values))                  \
+    XV(           GetSourcei,           LPALGETSOURCEI,           "alGetSourcei",           ALAD_AL_CORE_REST, (ALuint source, ALenum param, ALint *value),                                          (source, param, value))                   \
+    XV(           GetSource3i,          LPALGETSOURCE3I,          "alGetSource3i",          ALAD_AL_CORE_REST, (ALuint source, ALenum param, ALint *value1, ALint *value2, ALint *value3),           (source, param, value1, value2, value3))  \
+    XV(           GetSourceiv,          LPALGETSOURCEIV,          "alGetSourceiv",          ALAD_AL_CORE_REST, (ALuint source, ALenum param, ALint *values),                                         (source, param, values))                  \
+    XV(           SourcePlayv,          LPALSOURCEPLAYV,          "alSourcePlayv",          ALAD_AL_CORE_REST, (ALsizei n, const ALuint *sources),                                                   (n, sources))                             \
+    XV(           SourceStopv,          LPALSOURCESTOPV,          "alSourceStopv",          ALAD_AL_CORE_REST, (ALsizei n, const ALuint *sources),                                                   (n, sources))                             \
+    XV(           SourceRewindv,        LPALSOURCEREWINDV,        "alSourceRewindv",        ALAD_AL_CORE_REST, (ALsizei n, const ALuint *sources),                                                   (n, sources))                             \
+    XV(           SourcePausev,         LPALSOURCEPAUSEV,         "alSourcePausev",         ALAD_AL_CORE_REST, (ALsizei n, const ALuint *sources),                                                   (n, sources))                             \
+    XV(           SourcePlay,           LPALSOURCEPLAY,           "alSourcePlay",           ALAD_AL_CORE_REST, (ALuint source),                                                                      (source))                                 \
+    XV(           SourceStop,           LPALSOURCESTOP,           "alSourceStop",           ALAD_AL_CORE_REST, (ALuint source),                                                                      (source))                                 \
+    XV(           SourceRewind,         LPALSOURCEREWIND,         "alSourceRewind",         ALAD_AL_CORE_REST, (ALuint source),                                                                      (source))                                 \
+    XV(           SourcePause,          LPALSOURCEPAUSE,          "alSourcePause",          ALAD_AL_CORE_REST, (ALuint source),                                                                      (source))                                 \
+    XV(           SourceQueueBuffers,   LPALSOURCEQUEUEBUFFERS,   "alSourceQueueBuffers",   ALAD_AL_CORE_REST, (ALuint source, ALsizei nb, const ALuint *buffers),                                   (source, nb, buffers))                    \
+    XV(           SourceUnqueueBuffers, LPALSOURCEUNQUEUEBUFFERS, "alSourceUnqueueBuffers", ALAD_AL_CORE_REST, (ALuint source, ALsizei nb, ALuint *buffers),                                         (source, nb, buffers))                    \
+    XV(           GenBuffers,           LPALGENBUFFERS,           "alGenBuffers",           ALAD_AL_CORE_REST, (ALsizei n, ALuint *buffers),                                                         (n, buffers))                             \
+    XV(           DeleteBuffers,        LPALDELETEBUFFERS,        "alDeleteBuffers",        ALAD_AL_CORE_REST, (ALsizei n, const ALuint *buffers),                                                   (n, buffers))                             \
+    X (ALboolean, IsBuffer,             LPALISBUFFER,             "alIsBuffer",             ALAD_AL_CORE_REST, (ALuint buffer),                                                                      (buffer))                                 \
+    XV(           BufferData,           LPALBUFFERDATA,           "alBufferData",           ALAD_AL_CORE_REST, (ALuint buffer, ALenum format, const ALvoid *data, ALsizei size, ALsizei samplerate), (buffer, format, data, size, samplerate)) \
+    XV(           Bufferf,              LPALBUFFERF,              "alBufferf",              ALAD_AL_CORE_REST, (ALuint buffer, ALenum param, ALfloat value),                                         (buffer, param, value))                   \
+    XV(           Buffer3f,             LPALBUFFER3F,             "alBuffer3f",             ALAD_AL_CORE_REST, (ALuint buffer, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3),        (buffer, param, value1, value2, value3))  \
+    XV(           Bufferfv,             LPALBUFFERFV,             "alBufferfv",             ALAD_AL_CORE_REST, (ALuint buffer, ALenum param, const ALfloat *values),                                 (buffer, param, values))                  \
+    XV(           Bufferi,              LPALBUFFERI,              "alBufferi",              ALAD_AL_CORE_REST, (ALuint buffer, ALenum param, ALint value),                                           (buffer, param, value))                   \
+    XV(           Buffer3i,             LPALBUFFER3I,             "alBuffer3i",             ALAD_AL_CORE_REST, (ALuint buffer, ALenum param, ALint value1, ALint value2, ALint value3),              (buffer, param, value1, value2, value3))  \
+    XV(           Bufferiv,             LPALBUFFERIV,             "alBufferiv",             ALAD_AL_CORE_REST, (ALuint buffer, ALenum param, const ALint *values),                                   (buffer, param, values))                  \
+    XV(           GetBufferf,           LPALGETBUFFERF,           "alGetBufferf",           ALAD_AL_CORE_REST, (ALuint buffer, ALenum param, ALfloat *value),                                        (buffer, param, value))                   \
+    XV(           GetBuffer3f,          LPALGETBUFFER3F,          "alGetBuffer3f",          ALAD_AL_CORE_REST, (ALuint buffer, ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3),     (buffer, param, value1, value2, value3))  \
+    XV(           GetBufferfv,          LPALGETBUFFERFV,          "alGetBufferfv",          ALAD_AL_CORE_REST, (ALuint buffer, ALenum param, ALfloat *values),                                       (buffer, param, values))                  \
+    XV(           GetBufferi,           LPALGETBUFFERI,           "alGetBufferi",           ALAD_AL_CORE_REST, (ALuint buffer, ALenum param, ALint *value),                                          (buffer, param, value))                   \
+    XV(           GetBuffer3i,          LPALGETBUFFER3I,          "alGetBuffer3i",          ALAD_AL_CORE_REST, (ALuint buffer, ALenum param, ALint *value1, ALint *value2, ALint *value3),           (buffer, param, value1, value2, value3))  \
+    XV(           GetBufferiv,          LPALGETBUFFERIV,          "alGetBufferiv",          ALAD_AL_CORE_REST, (ALuint buffer, ALenum param, ALint *values),                                         (buffer, param, values))                  \
+    /* EFX */                                                                                                                                                                                                          \
+    XV(           GenEffects,                 LPALGENEFFECTS,                 "alGenEffects",                 ALAD_ALC_EXT_EFX, (ALsizei n, ALuint *effects),                             (n, effects))                \
+    XV(           DeleteEffects,              LPALDELETEEFFECTS,              "alDeleteEffects",              ALAD_ALC_EXT_EFX, (ALsizei n, const ALuint *effects),                       (n, effects))                \
+    X (ALboolean, IsEffect,                   LPALISEFFECT,                   "alIsEffect",                   ALAD_ALC_EXT_EFX, (ALuint effect),                                          (effect))                    \
+    XV(           Effecti,                    LPALEFFECTI,                    "alEffecti",                    ALAD_ALC_EXT_EFX, (ALuint effect, ALenum param, ALint value),               (effect, param, value))      \
+    XV(           Effectiv,                   LPALEFFECTIV,                   "alEffectiv",                   ALAD_ALC_EXT_EFX, (ALuint effect, ALenum param, const ALint *values),       (effect, param, values))     \
+    XV(           Effectf,                    LPALEFFECTF,                    "alEffectf",                    ALAD_ALC_EXT_EFX, (ALuint effect, ALenum param, ALfloat value),             (effect, param, value))      \
+    XV(           Effectfv,                   LPALEFFECTFV,                   "alEffectfv",                   ALAD_ALC_EXT_EFX, (ALuint effect, ALenum param, const ALfloat *values),     (effect, param, values))     \
+    XV(           GetEffecti,                 LPALGETEFFECTI,                 "alGetEffecti",                 ALAD_ALC_EXT_EFX, (ALuint effect, ALenum param, ALint *value),              (effect, param, value))      \
+    XV(           GetEffectiv,                LPALGETEFFECTIV,                "alGetEffectiv",                ALAD_ALC_EXT_EFX, (ALuint effect, ALenum param, ALint *values),             (effect, param, values))     \
+    XV(           GetEffectf,                 LPALGETEFFECTF,                 "alGetEffectf",                 ALAD_ALC_EXT_EFX, (ALuint effect, ALenum param, ALfloat *value),            (effect, param, value))      \
+    XV(           GetEffectfv,                LPALGETEFFECTFV,                "alGetEffectfv",                ALAD_ALC_EXT_EFX, (ALuint effect, ALenum param, ALfloat *values),           (effect, param, values))     \
+    XV(           GenFilters,                 LPALGENFILTERS,                 "alGenFilters",                 ALAD_ALC_EXT_EFX, (ALsizei n, ALuint *filters),                             (n, filters))                \
+    XV(           DeleteFilters,              LPALDELETEFILTERS,              "alDeleteFilters",              ALAD_ALC_EXT_EFX, (ALsizei n, const ALuint *filters),                       (n, filters))                \
+    X (ALboolean, IsFilter,                   LPALISFILTER,                   "alIsFilter",                   ALAD_ALC_EXT_EFX, (ALuint filter),                                          (filter))                    \
+    XV(           Filteri,                    LPALFILTERI,                    "alFilteri",                    ALAD_ALC_EXT_EFX, (ALuint filter, ALenum param, ALint value),               (filter, param, value))      \
+    XV(           Filteriv,                   LPALFILTERIV,                   "alFilteriv",                   ALAD_ALC_EXT_EFX, (ALuint filter, ALenum param, const ALint *values),       (filter, param, values))     \
+    XV(           Filterf,                    LPALFILTERF,                    "alFilterf",                    ALAD_ALC_EXT_EFX, (ALuint filter, ALenum param, ALfloat value),             (filter, param, value))      \
+    XV(           Filterfv,                   LPALFILTERFV,                   "alFilterfv",                   ALAD_ALC_EXT_EFX, (ALuint filter, ALenum param, const ALfloat *values),     (filter, param, values))     \
+    XV(           GetFilteri,                 LPALGETFILTERI,                 "alGetFilteri",                 ALAD_ALC_EXT_EFX, (ALuint filter, ALenum param, ALint *value),              (filter, param, value))      \
+    XV(           GetFilteriv,                LPALGETFILTERIV,                "alGetFilteriv",                ALAD_ALC_EXT_EFX, (ALuint filter, ALenum param, ALint *values),             (filter, param, values))     \
+    XV(           GetFilterf,                 LPALGETFILTERF,                 "alGetFilterf",                 ALAD_ALC_EXT_EFX, (ALuint filter, ALenum param, ALfloat *value),            (filter, param, value))      \
+    XV(           GetFilterfv,                LPALGETFILTERFV,                "alGetFilterfv",                ALAD_ALC_EXT_EFX, (ALuint filter, ALenum param, ALfloat *values),           (filter, param, values))     \
+    XV(           GenAuxiliaryEffectSlots,    LPALGENAUXILIARYEFFECTSLOTS,    "alGenAuxiliaryEffectSlots",    ALAD_ALC_EXT_EFX, (ALsizei n, ALuint *effectslots),                         (n, effectslots))            \
+    XV(           DeleteAuxiliaryEffectSlots, LPALDELETEAUXILIARYEFFECTSLOTS, "alDeleteAuxiliaryEffectSlots", ALAD_ALC_EXT_EFX, (ALsizei n, const ALuint *effectslots),                   (n, effectslots))            \
+    X (ALboolean, IsAuxiliaryEffectSlot,      LPALISAUXILIARYEFFECTSLOT,      "alIsAuxiliaryEffectSlot",      ALAD_ALC_EXT_EFX, (ALuint effectslot),                                      (effectslot))                \
+    XV(           AuxiliaryEffectSloti,       LPALAUXILIARYEFFECTSLOTI,       "alAuxiliaryEffectSloti",       ALAD_ALC_EXT_EFX, (ALuint effectslot, ALenum param, ALint value),           (effectslot, param, value))  \
+    XV(           AuxiliaryEffectSlotiv,      LPALAUXILIARYEFFECTSLOTIV,      "alAuxiliaryEffectSlotiv",      ALAD_ALC_EXT_EFX, (ALuint effectslot, ALenum param, const ALint *values),   (effectslot, param, values)) \
+    XV(           AuxiliaryEffectSlotf,       LPALAUXILIARYEFFECTSLOTF,       "alAuxiliaryEffectSlotf",       ALAD_ALC_EXT_EFX, (ALuint effectslot, ALenum param, ALfloat value),         (effectslot, param, value))  \
+    XV(           AuxiliaryEffectSlotfv,      LPALAUXILIARYEFFECTSLOTFV,      "alAuxiliaryEffectSlotfv",      ALAD_ALC_EXT_EFX, (ALuint effectslot, ALenum param, const ALfloat *values), (effectslot, param, values)) \
+    XV(           GetAuxiliaryEffectSloti,    LPALGETAUXILIARYEFFECTSLOTI,    "alGetAuxiliaryEffectSloti",    ALAD_ALC_EXT_EFX, (ALuint effectslot, ALenum param, ALint *value),          (effectslot, param, value))  \
+    XV(           GetAuxiliaryEffectSlotiv,   LPALGETAUXILIARYEFFECTSLOTIV,   "alGetAuxiliaryEffectSlotiv",   ALAD_ALC_EXT_EFX, (ALuint effectslot, ALenum param, ALint *values),         (effectslot, param, values)) \
+    XV(           GetAuxiliaryEffectSlotf,    LPALGETAUXILIARYEFFECTSLOTF,    "alGetAuxiliaryEffectSlotf",    ALAD_ALC_EXT_EFX, (ALuint effectslot, ALenum param, ALfloat *value),        (effectslot, param, value))  \
+    XV(           GetAuxiliaryEffectSlotfv,   LPALGETAUXILIARYEFFECTSLOTFV,   "alGetAuxiliaryEffectSlotfv",   ALAD_ALC_EXT_EFX, (ALuint effectslot, ALenum param, ALfloat *values),       (effectslot, param, values)) \
+    /* AL extensions */                                                                                                                                                                                                   \
+    /* AL_EXT_STATIC_BUFFER */                                                                                                                                                                                            \
+    XV( BufferDataStatic, PFNALBUFFERDATASTATICPROC, "alBufferDataStatic", ALAD_AL_EXT_STATIC_BUFFER, (const ALuint buffer, ALenum format, ALvoid *data, ALsizei size, ALsizei freq), (buffer, format, data, size, freq)) \
+    /* AL_SOFT_buffer_sub_data */                                                                                                                                                                                                       \
+    XV( BufferSubDataSOFT, PFNALBUFFERSUBDATASOFTPROC, "alBufferSubDataSOFT", ALAD_AL_SOFT_buffer_sub_data, (ALuint buffer, ALenum format, const ALvoid *data, ALsizei offset, ALsizei length), (buffer, format, data, offset, length)) \
+    /* AL_EXT_FOLDBACK */                                                                                                                                                                                                                \
+    XV( RequestFoldbackStart, LPALREQUESTFOLDBACKSTART, "alRequestFoldbackStart", ALAD_AL_EXT_FOLDBACK, (ALenum mode, ALsizei count, ALsizei length, ALfloat *mem, LPALFOLDBACKCALLBACK callback), (mode, count, length, mem, callback)) \
+    XV( RequestFoldbackStop,  LPALREQUESTFOLDBACKSTOP,  "alRequestFoldbackStop",  ALAD_AL_EXT_FOLDBACK, (void),                                                                                    ())                                   \
+    /* AL_SOFT_buffer_samples */                                                                                                                                                                                                                                                                                                                 \
+    XV(           BufferSamplesSOFT,           LPALBUFFERSAMPLESSOFT,           "alBufferSamplesSOFT",           ALAD_AL_SOFT_buffer_samples, (ALuint buffer, ALuint samplerate, ALenum internalformat, ALsizei samples, ALenum channels, ALenum type, const ALvoid *data), (buffer, samplerate, internalformat, samples, channels, type, data)) \
+    XV(           BufferSubSamplesSOFT,        LPALBUFFERSUBSAMPLESSOFT,        "alBufferSubSamplesSOFT",        ALAD_AL_SOFT_buffer_samples, (ALuint buffer, ALsizei offset, ALsizei samples, ALenum channels, ALenum type, const ALvoid *data),                           (buffer, offset, samples, channels, type, data))                     \
+    XV(           GetBufferSamplesSOFT,        LPALGETBUFFERSAMPLESSOFT,        "alGetBufferSamplesSOFT",        ALAD_AL_SOFT_buffer_samples, (ALuint buffer, ALsizei offset, ALsizei samples, ALenum channels, ALenum type, ALvoid *data),                                 (buffer, offset, samples, channels, type, data))                     \
+    X (ALboolean, IsBufferFormatSupportedSOFT, LPALISBUFFERFORMATSUPPORTEDSOFT, "alIsBufferFormatSupportedSOFT", ALAD_AL_SOFT_buffer_samples, (ALenum format),                                                                                                              (format))                                                            \
+    /* AL_SOFT_source_latency */                                                                                                                                                                                                             \
+    XV( SourcedSOFT,       LPALSOURCEDSOFT,       "alSourcedSOFT",       ALAD_AL_SOFT_source_latency, (ALuint source, ALenum param, ALdouble value),                                                (source, param, value))                  \
+    XV( Source3dSOFT,      LPALSOURCE3DSOFT,      "alSource3dSOFT",      ALAD_AL_SOFT_source_latency, (ALuint source, ALenum param, ALdouble value1, ALdouble value2, ALdouble value3),             (source, param, value1, value2, value3)) \
+    XV( SourcedvSOFT,      LPALSOURCEDVSOFT,      "alSourcedvSOFT",      ALAD_AL_SOFT_source_latency, (ALuint source, ALenum param, const ALdouble *values),                                        (source, param, values))                 \
+    XV( GetSourcedSOFT,    LPALGETSOURCEDSOFT,    "alGetSourcedSOFT",    ALAD_AL_SOFT_source_latency, (ALuint source, ALenum param, ALdouble *value),                                               (source, param, value))                  \
+    XV( GetSource3dSOFT,   LPALGETSOURCE3DSOFT,   "alGetSource3dSOFT",   ALAD_AL_SOFT_source_latency, (ALuint source, ALenum param, ALdouble *value1, ALdouble *value2, ALdouble *value3),          (source, param, value1, value2, value3)) \
+    XV( GetSourcedvSOFT,   LPALGETSOURCEDVSOFT,   "alGetSourcedvSOFT",   ALAD_AL_SOFT_source_latency, (ALuint source, ALenum param, ALdouble *values),                                              (source, param, values))                 \
+    XV( Sourcei64SOFT,     LPALSOURCEI64SOFT,     "alSourcei64SOFT",     ALAD_AL_SOFT_source_latency, (ALuint source, ALenum param, ALint64SOFT value),                                             (source, param, value))                  \
+    XV( Source3i64SOFT,    LPALSOURCE3I64SOFT,    "alSource3i64SOFT",    ALAD_AL_SOFT_source_latency, (ALuint source, ALenum param, ALint64SOFT value1, ALint64SOFT value2, ALint64SOFT value3),    (source, param, value1, value2, value3)) \
+    XV( Sourcei64vSOFT,    LPALSOURCEI64VSOFT,    "alSourcei64vSOFT",    ALAD_AL_SOFT_source_latency, (ALuint source, ALenum param, const ALint64SOFT *values),                                     (source, param, values))                 \
+    XV( GetSourcei64SOFT,  LPALGETSOURCEI64SOFT,  "alGetSourcei64SOFT",  ALAD_AL_SOFT_source_latency, (ALuint source, ALenum param, ALint64SOFT *value),                                            (source, param, value))                  \
+    XV( GetSource3i64SOFT, LPALGETSOURCE3I64SOFT, "alGetSource3i64SOFT", ALAD_AL_SOFT_source_latency, (ALuint source, ALenum param, ALint64SOFT *value1, ALint64SOFT *value2, ALint64SOFT *value3), (source, param, value1, value2, value3)) \
+    XV( GetSourcei64vSOFT, LPALGETSOURCEI64VSOFT, "alGetSourcei64vSOFT", ALAD_AL_SOFT_source_latency, (ALuint source, ALenum param, ALint64SOFT *values),                                           (source, param, values))                 \
+    /* AL_SOFT_deferred_updates */                                                                                     \
+    XV( DeferUpdatesSOFT,   LPALDEFERUPDATESSOFT,   "alDeferUpdatesSOFT",   ALAD_AL_SOFT_deferred_updates, (void), ()) \
+    XV( ProcessUpdatesSOFT, LPALPROCESSUPDATESSOFT, "alProcessUpdatesSOFT", ALAD_AL_SOFT_deferred_updates, (void), ()) \
+    /* AL_SOFT_source_resampler */                                                                                                                          \
+    X (const ALchar*, GetStringiSOFT, LPALGETSTRINGISOFT, "alGetStringiSOFT", ALAD_AL_SOFT_source_resampler, (ALenum pname, ALsizei index), (pname, index)) \
+    /* AL_SOFT_events */                                                                                                                                                            \
+    XV(       EventControlSOFT,  LPALEVENTCONTROLSOFT,  "alEventControlSOFT",  ALAD_AL_SOFT_events, (ALsizei count, const ALenum *types, ALboolean enable), (count, types, enable)) \
+    XV(       EventCallbackSOFT, LPALEVENTCALLBACKSOFT, "alEventCallbackSOFT", ALAD_AL_SOFT_events, (ALEVENTPROCSOFT callback, void *userParam),            (callback, userParam))  \
+    X (void*, GetPointerSOFT,    LPALGETPOINTERSOFT,    "alGetPointerSOFT",    ALAD_AL_SOFT_events, (ALenum pname),                                         (pname))                \
+    XV(       GetPointervSOFT,   LPALGETPOINTERVSOFT,   "alGetPointervSOFT",   ALAD_AL_SOFT_events, (ALenum pname, void **values),                          (pname, values))        \
+    /* AL_SOFT_callback_buffer */                                                                                                                                                                                                                      \
+    XV( BufferCallbackSOFT, LPALBUFFERCALLBACKSOFT, "alBufferCallbackSOFT", ALAD_AL_SOFT_callback_buffer, (ALuint buffer, ALenum format, ALsizei freq, ALBUFFERCALLBACKTYPESOFT callback, ALvoid *userptr), (buffer, format, freq, callback, userptr)) \
+    XV( GetBufferPtrSOFT,   LPALGETBUFFERPTRSOFT,   "alGetBufferPtrSOFT",   ALAD_AL_SOFT_callback_buffer, (ALuint buffer, ALenum param, ALvoid **value),                                                    (buffer, param, value))                    \
+    XV( GetBuffer3PtrSOFT,  LPALGETBUFFER3PTRSOFT,  "alGetBuffer3PtrSOFT",  ALAD_AL_SOFT_callback_buffer, (ALuint buffer, ALenum param, ALvoid **value1, ALvoid **value2, ALvoid **value3),                 (buffer, param, value1, value2, value3))   \
+    XV( GetBufferPtrvSOFT,  LPALGETBUFFERPTRVSOFT,  "alGetBufferPtrvSOFT",  ALAD_AL_SOFT_callback_buffer, (ALuint buffer, ALenum param, ALvoid **values),                                                   (buffer, param, values))                   \
+    /* AL_SOFT_source_start_delay */                                                                                                                                                                        \
+    XV( SourcePlayAtTimeSOFT,  LPALSOURCEPLAYATTIMESOFT,  "alSourcePlayAtTimeSOFT",  ALAD_AL_SOFT_source_start_delay, (ALuint source, ALint64SOFT start_time),                    (source, start_time))     \
+    XV( SourcePlayAtTimevSOFT, LPALSOURCEPLAYATTIMEVSOFT, "alSourcePlayAtTimevSOFT", ALAD_AL_SOFT_source_start_delay, (ALsizei n, const ALuint *sources, ALint64SOFT start_time), (n, sources, start_time)) \
+    /* AL_EXT_debug */                                                                                                                                                                                                                                                                                                             \
+    XV(        DebugMessageCallbackEXT, LPALDEBUGMESSAGECALLBACKEXT, "alDebugMessageCallbackEXT", ALAD_AL_EXT_debug, (ALDEBUGPROCEXT callback, void *userParam),                                                                                            (callback, userParam))                                                 \
+    XV(        DebugMessageInsertEXT,   LPALDEBUGMESSAGEINSERTEXT,   "alDebugMessageInsertEXT",   ALAD_AL_EXT_debug, (ALenum source, ALenum type, ALuint id, ALenum severity, ALsizei length, const ALchar *message),                                       (source, type, id, severity, length, message))                         \
+    XV(        DebugMessageControlEXT,  LPALDEBUGMESSAGECONTROLEXT,  "alDebugMessageControlEXT",  ALAD_AL_EXT_debug, (ALenum source, ALenum type, ALenum severity, ALsizei count, const ALuint *ids, ALboolean enable),                                     (source, type, severity, count, ids, enable))                          \
+    XV(        PushDebugGroupEXT,       LPALPUSHDEBUGGROUPEXT,       "alPushDebugGroupEXT",       ALAD_AL_EXT_debug, (ALenum source, ALuint id, ALsizei length, const ALchar *message),                                                                     (source, id, length, message))                                         \
+    XV(        PopDebugGroupEXT,        LPALPOPDEBUGGROUPEXT,        "alPopDebugGroupEXT",        ALAD_AL_EXT_debug, (void),                                                                                                                                ())                                                                    \
+    X (ALuint, GetDebugMessageLogEXT,   LPALGETDEBUGMESSAGELOGEXT,   "alGetDebugMessageLogEXT",   ALAD_AL_EXT_debug, (ALuint count, ALsizei logBufSize, ALenum *sources, ALenum *types, ALuint *ids, ALenum *severities, ALsizei *lengths, ALchar *logBuf), (count, logBufSize, sources, types, ids, severities, lengths, logBuf)) \
+    XV(        ObjectLabelEXT,          LPALOBJECTLABELEXT,          "alObjectLabelEXT",          ALAD_AL_EXT_debug, (ALenum identifier, ALuint name, ALsizei length, const ALchar *label),                                                                 (identifier, name, length, label))                                     \
+    XV(        GetObjectLabelEXT,       LPALGETOBJECTLABELEXT,       "alGetObjectLabelEXT",       ALAD_AL_EXT_debug, (ALenum identifier, ALuint name, ALsizei bufSize, ALsizei *length, ALchar *label),                                                     (identifier, name, bufSize, length, label))                            \
+    X (void*,  GetPointerEXT,           LPALGETPOINTEREXT,           "alGetPointerEXT",           ALAD_AL_EXT_debug, (ALenum pname),                                                                                                                        (pname))                                                               \
+    XV(        GetPointervEXT,          LPALGETPOINTERVEXT,          "alGetPointervEXT",          ALAD_AL_EXT_debug, (ALenum pname, void **values),                                                                                                         (pname, values))
+#define ALAD_ALC_FUNCTIONS_(X, XV) \
+    /* Core ALC */                                                                                                                                                                                                                                     \
+    X (ALCcontext*,    CreateContext,      LPALCCREATECONTEXT,      "alcCreateContext",      ALAD_ALC_CORE, device,  (ALCdevice *device, const ALCint *attrlist),                                         (device, attrlist))                          \
+    X (ALCboolean,     MakeContextCurrent, LPALCMAKECONTEXTCURRENT, "alcMakeContextCurrent", ALAD_ALC_CORE, nullptr, (ALCcontext *context),                                                               (context))                                   \
+    XV(                ProcessContext,     LPALCPROCESSCONTEXT,     "alcProcessContext",     ALAD_ALC_CORE, nullptr, (ALCcontext *context),                                                               (context))                                   \
+    XV(                SuspendContext,     LPALCSUSPENDCONTEXT,     "alcSuspendContext",     ALAD_ALC_CORE, nullptr, (ALCcontext *context),                                                               (context))                                   \
+    XV(                DestroyContext,     LPALCDESTROYCONTEXT,     "alcDestroyContext",     ALAD_ALC_CORE, nullptr, (ALCcontext *context),                                                               (context))                                   \
+    X (ALCcontext*,    GetCurrentContext,  LPALCGETCURRENTCONTEXT,  "alcGetCurrentContext",  ALAD_ALC_CORE, nullptr, (void),                                                                              ())                                          \
+    X (ALCdevice*,     GetContextsDevice,  LPALCGETCONTEXTSDEVICE,  "alcGetContextsDevice",  ALAD_ALC_CORE, nullptr, (ALCcontext *context),                                                               (context))                                   \
+    X (ALCdevice*,     OpenDevice,         LPALCOPENDEVICE,         "alcOpenDevice",         ALAD_ALC_CORE, nullptr, (const ALCchar *devicename),                                                         (devicename))                                \
+    X (ALCboolean,     CloseDevice,        LPALCCLOSEDEVICE,        "alcCloseDevice",        ALAD_ALC_CORE, device,  (ALCdevice *device),                                                                 (device))                                    \
+    X (ALCenum,        GetError,           LPALCGETERROR,           "alcGetError",           ALAD_ALC_CORE, device,  (ALCdevice *device),                                                                 (device))                                    \
+    X (ALCboolean,     IsExtensionPresent, LPALCISEXTENSIONPRESENT, "alcIsExtensionPresent", ALAD_ALC_CORE, device,  (ALCdevice *device, const ALCchar *extname),                                         (device, extname))                           \
+    X (ALCenum,        GetEnumValue,       LPALCGETENUMVALUE,       "alcGetEnumValue",       ALAD_ALC_CORE, device,  (ALCdevice *device, const ALCchar *enumname),                                        (device, enumname))                          \
+    X (const ALCchar*, GetString,          LPALCGETSTRING,          "alcGetString",          ALAD_ALC_CORE, device,  (ALCdevice *device, ALCenum param),                                                  (device, param))                             \
+    XV(                GetIntegerv,        LPALCGETINTEGERV,        "alcGetIntegerv",        ALAD_ALC_CORE, device,  (ALCdevice *device, ALCenum param, ALCsizei size, ALCint *values),                   (device, param, size, values))               \
+    X (ALCdevice*,     CaptureOpenDevice,  LPALCCAPTUREOPENDEVICE,  "alcCaptureOpenDevice",  ALAD_ALC_CORE, nullptr, (const ALCchar *devicename, ALCuint frequency, ALCenum format, ALCsizei buffersize), (devicename, frequency, format, buffersize)) \
+    X (ALCboolean,     CaptureCloseDevice, LPALCCAPTURECLOSEDEVICE, "alcCaptureCloseDevice", ALAD_ALC_CORE, device,  (ALCdevice *device),                                                                 (device))                                    \
+    XV(                CaptureStart,       LPALCCAPTURESTART,       "alcCaptureStart",       ALAD_ALC_CORE, device,  (ALCdevice *device),                                                                 (device))                                    \
+    XV(                CaptureStop,        LPALCCAPTURESTOP,        "alcCaptureStop",        ALAD_ALC_CORE, device,  (ALCdevice *device),                                                                 (device))                                    \
+    XV(                CaptureSamples,     LPALCCAPTURESAMPLES,     "alcCaptureSamples",     ALAD_ALC_CORE, device,  (ALCdevice *device, ALCvoid *buffer, ALCsizei samples),                              (device, buffer, samples))                   \
+    /* ALC extensions */                                                                                                                                               \
+    /* ALC_EXT_thread_local_context */                                                                                                                                 \
+    X (ALCboolean,  SetThreadContext, PFNALCSETTHREADCONTEXTPROC, "alcSetThreadContext", ALAD_ALC_EXT_thread_local_context, nullptr, (ALCcontext *context), (context)) \
+    X (ALCcontext*, GetThreadContext, PFNALCGETTHREADCONTEXTPROC, "alcGetThreadContext", ALAD_ALC_EXT_thread_local_context, nullptr, (void),                ())        \
+    /* ALC_SOFT_loopback */                                                                                                                                                                                                                              \
+    X (ALCdevice*, LoopbackOpenDeviceSOFT,      LPALCLOOPBACKOPENDEVICESOFT,      "alcLoopbackOpenDeviceSOFT",      ALAD_ALC_SOFT_loopback, nullptr, (const ALCchar *deviceName),                                        (deviceName))                   \
+    X (ALCboolean, IsRenderFormatSupportedSOFT, LPALCISRENDERFORMATSUPPORTEDSOFT, "alcIsRenderFormatSupportedSOFT", ALAD_ALC_SOFT_loopback, device,  (ALCdevice *device, ALCsizei freq, ALCenum channels, ALCenum type), (device, freq, channels, type)) \
+    XV(            RenderSamplesSOFT,           LPALCRENDERSAMPLESSOFT,           "alcRenderSamplesSOFT",           ALAD_ALC_SOFT_loopback, device,  (ALCdevice *device, ALCvoid *buffer, ALCsizei samples),             (device, buffer, samples))      \
+    /* ALC_SOFT_pause_device */                                                                                                            \
+    XV( DevicePauseSOFT,  LPALCDEVICEPAUSESOFT,  "alcDevicePauseSOFT",  ALAD_ALC_SOFT_pause_device, device, (ALCdevice *device), (device)) \
+    XV( DeviceResumeSOFT, LPALCDEVICERESUMESOFT, "alcDeviceResumeSOFT", ALAD_ALC_SOFT_pause_device, device, (ALCdevice *device), (device)) \
+    /* ALC_SOFT_HRTF */                                                                                                                                                                             \
+    X (const ALCchar*, GetStringiSOFT,  LPALCGETSTRINGISOFT,  "alcGetStringiSOFT",  ALAD_ALC_SOFT_HRTF, device, (ALCdevice *device, ALCenum paramName, ALCsizei index), (device, paramName, index)) \
+    X (ALCboolean,     ResetDeviceSOFT, LPALCRESETDEVICESOFT, "alcResetDeviceSOFT", ALAD_ALC_SOFT_HRTF, device, (ALCdevice *device, const ALCint *attribs),             (device, attribs))          \
+    /* ALC_SOFT_device_clock */                                                                                                                                                                                       \
+    XV( GetInteger64vSOFT, LPALCGETINTEGER64VSOFT, "alcGetInteger64vSOFT", ALAD_ALC_SOFT_device_clock, device, (ALCdevice *device, ALCenum pname, ALsizei size, ALCint64SOFT *values), (device, pname, size, values)) \
+    /* ALC_SOFT_reopen_device */                                                                                                                                                                                              \
+    X (ALCboolean, ReopenDeviceSOFT, LPALCREOPENDEVICESOFT, "alcReopenDeviceSOFT", ALAD_ALC_SOFT_reopen_device, device, (ALCdevice *device, const ALCchar *deviceName, const ALCint *attribs), (device, deviceName, attribs)) \
+    /* ALC_SOFT_system_events */                                                                                                                                                                                          \
+    X (ALCenum,    EventIsSupportedSOFT, LPALCEVENTISSUPPORTEDSOFT, "alcEventIsSupportedSOFT", ALAD_ALC_SOFT_system_events, nullptr, (ALCenum eventType, ALCenum deviceType),                    (eventType, deviceType)) \
+    X (ALCboolean, EventControlSOFT,     LPALCEVENTCONTROLSOFT,     "alcEventControlSOFT",     ALAD_ALC_SOFT_system_events, nullptr, (ALCsizei count, const ALCenum *events, ALCboolean enable), (count, events, enable)) \
+    XV(            EventCallbackSOFT,    LPALCEVENTCALLBACKSOFT,    "alcEventCallbackSOFT",    ALAD_ALC_SOFT_system_events, nullptr, (ALCEVENTPROCTYPESOFT callback, void *userParam),           (callback, userParam))
+
+#define ALAD_AL_TABLE_ENTRY_(ret, member, type, name, extension, params, args)               ALAD_AL_ENTRY_(member, name, extension),
+#define ALAD_AL_TABLE_ENTRY_VOID_(member, type, name, extension, params, args)               ALAD_AL_ENTRY_(member, name, extension),
+#define ALAD_ALC_TABLE_ENTRY_(ret, member, type, name, extension, device, params, args)      ALAD_ALC_ENTRY_(member, name, extension),
+#define ALAD_ALC_TABLE_ENTRY_VOID_(member, type, name, extension, device, params, args)      ALAD_ALC_ENTRY_(member, name, extension),
+const aladTableEntry aladALTable[] = {
+    ALAD_AL_FUNCTIONS_(ALAD_AL_TABLE_ENTRY_, ALAD_AL_TABLE_ENTRY_VOID_)
+};
+const aladTableEntry aladALCTable[] = {
+    ALAD_ALC_FUNCTIONS_(ALAD_ALC_TABLE_ENTRY_, ALAD_ALC_TABLE_ENTRY_VOID_)
+};
+const aladTableEntry aladDirectTable[] = {
+    /* AL_EXT_direct_context */
+    ALAD_DIRECT_ENTRY_(alcGetProcAddress2,                 "alcGetProcAddress2",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alEnableDirect,                     "alEnableDirect",                     ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alDisableDirect,                    "alDisableDirect",                    ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alIsEnabledDirect,                  "alIsEnabledDirect",                  ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alDopplerFactorDirect,              "alDopplerFactorDirect",              ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSpeedOfSoundDirect,               "alSpeedOfSoundDirect",               ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alDistanceModelDirect,              "alDistanceModelDirect",              ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetStringDirect,                  "alGetStringDirect",                  ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetBooleanvDirect,                "alGetBooleanvDirect",                ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetIntegervDirect,                "alGetIntegervDirect",                ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetFloatvDirect,                  "alGetFloatvDirect",                  ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetDoublevDirect,                 "alGetDoublevDirect",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetBooleanDirect,                 "alGetBooleanDirect",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetIntegerDirect,                 "alGetIntegerDirect",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetFloatDirect,                   "alGetFloatDirect",                   ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetDoubleDirect,                  "alGetDoubleDirect",                  ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetErrorDirect,                   "alGetErrorDirect",                   ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alIsExtensionPresentDirect,         "alIsExtensionPresentDirect",         ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetProcAddressDirect,             "alGetProcAddressDirect",             ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetEnumValueDirect,               "alGetEnumValueDirect",               ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alListenerfDirect,                  "alListenerfDirect",                  ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alListener3fDirect,                 "alListener3fDirect",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alListenerfvDirect,                 "alListenerfvDirect",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alListeneriDirect,                  "alListeneriDirect",                  ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alListener3iDirect,                 "alListener3iDirect",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alListenerivDirect,                 "alListenerivDirect",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetListenerfDirect,               "alGetListenerfDirect",               ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetListener3fDirect,              "alGetListener3fDirect",              ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetListenerfvDirect,              "alGetListenerfvDirect",              ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetListeneriDirect,               "alGetListeneriDirect",               ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetListener3iDirect,              "alGetListener3iDirect",              ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetListenerivDirect,              "alGetListenerivDirect",              ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGenSourcesDirect,                 "alGenSourcesDirect",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alDeleteSourcesDirect,              "alDeleteSourcesDirect",              ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alIsSourceDirect,                   "alIsSourceDirect",                   ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSourcefDirect,                    "alSourcefDirect",                    ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSource3fDirect,                   "alSource3fDirect",                   ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSourcefvDirect,                   "alSourcefvDirect",                   ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSourceiDirect,                    "alSourceiDirect",                    ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSource3iDirect,                   "alSource3iDirect",                   ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSourceivDirect,                   "alSourceivDirect",                   ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSourceivDirect,                   "alSourceivDirect",                   ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetSourcefDirect,                 "alGetSourcefDirect",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetSource3fDirect,                "alGetSource3fDirect",                ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetSourcefvDirect,                "alGetSourcefvDirect",                ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetSourceiDirect,                 "alGetSourceiDirect",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetSource3iDirect,                "alGetSource3iDirect",                ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetSourceivDirect,                "alGetSourceivDirect",                ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSourcePlayDirect,                 "alSourcePlayDirect",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSourceStopDirect,                 "alSourceStopDirect",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSourceRewindvDirect,              "alSourceRewindvDirect",              ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSourcePausevDirect,               "alSourcePausevDirect",               ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSourcePlayvDirect,                "alSourcePlayvDirect",                ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSourceStopvDirect,                "alSourceStopvDirect",                ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSourceRewindDirect,               "alSourceRewindDirect",               ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSourcePauseDirect,                "alSourcePauseDirect",                ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSourceQueueBuffersDirect,         "alSourceQueueBuffersDirect",         ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSourceUnqueueBuffersDirect,       "alSourceUnqueueBuffersDirect",       ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGenBuffersDirect,                 "alGenBuffersDirect",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alDeleteBuffersDirect,              "alDeleteBuffersDirect",              ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alIsBufferDirect,                   "alIsBufferDirect",                   ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alBufferDataDirect,                 "alBufferDataDirect",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alBufferfDirect,                    "alBufferfDirect",                    ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alBuffer3fDirect,                   "alBuffer3fDirect",                   ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alBufferfvDirect,                   "alBufferfvDirect",                   ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alBufferiDirect,                    "alBufferiDirect",                    ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alBuffer3iDirect,                   "alBuffer3iDirect",                   ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alBufferivDirect,                   "alBufferivDirect",                   ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetBufferfDirect,                 "alGetBufferfDirect",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetBuffer3fDirect,                "alGetBuffer3fDirect",                ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetBufferfvDirect,                "alGetBufferfvDirect",                ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetBufferiDirect,                 "alGetBufferiDirect",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetBuffer3iDirect,                "alGetBuffer3iDirect",                ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetBufferivDirect,                "alGetBufferivDirect",                ALAD_ALC_EXT_direct_context),
+    /* ALC_EXT_EFX */
+    ALAD_DIRECT_ENTRY_(alGenEffectsDirect,                 "alGenEffectsDirect",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alDeleteEffectsDirect,              "alDeleteEffectsDirect",              ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alIsEffectDirect,                   "alIsEffectDirect",                   ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alEffectiDirect,                    "alEffectiDirect",                    ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alEffectivDirect,                   "alEffectivDirect",                   ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alEffectfDirect,                    "alEffectfDirect",                    ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alEffectfvDirect,                   "alEffectfvDirect",                   ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetEffectiDirect,                 "alGetEffectiDirect",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetEffectivDirect,                "alGetEffectivDirect",                ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetEffectfDirect,                 "alGetEffectfDirect",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetEffectfvDirect,                "alGetEffectfvDirect",                ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGenFiltersDirect,                 "alGenFiltersDirect",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alDeleteFiltersDirect,              "alDeleteFiltersDirect",              ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alIsFilterDirect,                   "alIsFilterDirect",                   ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alFilteriDirect,                    "alFilteriDirect",                    ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alFilterivDirect,                   "alFilterivDirect",                   ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alFilterfDirect,                    "alFilterfDirect",                    ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alFilterfvDirect,                   "alFilterfvDirect",                   ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetFilteriDirect,                 "alGetFilteriDirect",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetFilterivDirect,                "alGetFilterivDirect",                ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetFilterfDirect,                 "alGetFilterfDirect",                 ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetFilterfvDirect,                "alGetFilterfvDirect",                ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGenAuxiliaryEffectSlotsDirect,    "alGenAuxiliaryEffectSlotsDirect",    ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alDeleteAuxiliaryEffectSlotsDirect, "alDeleteAuxiliaryEffectSlotsDirect", ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alIsAuxiliaryEffectSlotDirect,      "alIsAuxiliaryEffectSlotDirect",      ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alAuxiliaryEffectSlotiDirect,       "alAuxiliaryEffectSlotiDirect",       ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alAuxiliaryEffectSlotivDirect,      "alAuxiliaryEffectSlotivDirect",      ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alAuxiliaryEffectSlotfDirect,       "alAuxiliaryEffectSlotfDirect",       ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alAuxiliaryEffectSlotfvDirect,      "alAuxiliaryEffectSlotfvDirect",      ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetAuxiliaryEffectSlotiDirect,    "alGetAuxiliaryEffectSlotiDirect",    ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetAuxiliaryEffectSlotivDirect,   "alGetAuxiliaryEffectSlotivDirect",   ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetAuxiliaryEffectSlotfDirect,    "alGetAuxiliaryEffectSlotfDirect",    ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetAuxiliaryEffectSlotfvDirect,   "alGetAuxiliaryEffectSlotfvDirect",   ALAD_ALC_EXT_direct_context),
+    /* AL_EXT_BUFFER_DATA_STATIC */
+    ALAD_DIRECT_ENTRY_(alBufferDataStaticDirect,           "alBufferDataStaticDirect",           ALAD_ALC_EXT_direct_context),
+    /* AL_EXT_debug */
+    ALAD_DIRECT_ENTRY_(alDebugMessageCallbackDirectEXT,    "alDebugMessageCallbackDirectEXT",    ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alDebugMessageInsertDirectEXT,      "alDebugMessageInsertDirectEXT",      ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alDebugMessageControlDirectEXT,     "alDebugMessageControlDirectEXT",     ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alPushDebugGroupDirectEXT,          "alPushDebugGroupDirectEXT",          ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alPopDebugGroupDirectEXT,           "alPopDebugGroupDirectEXT",           ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetDebugMessageLogDirectEXT,      "alGetDebugMessageLogDirectEXT",      ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alObjectLabelDirectEXT,             "alObjectLabelDirectEXT",             ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetObjectLabelDirectEXT,          "alGetObjectLabelDirectEXT",          ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetPointerDirectEXT,              "alGetPointerDirectEXT",              ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetPointervDirectEXT,             "alGetPointervDirectEXT",             ALAD_ALC_EXT_direct_context),
     /* AL_EXT_FOLDBACK */
-    functions[0].RequestFoldbackStart        = REINTERPRET_CAST(LPALREQUESTFOLDBACKSTART,           loader("alRequestFoldbackStart"));
-    functions[0].RequestFoldbackStop         = REINTERPRET_CAST(LPALREQUESTFOLDBACKSTOP,            loader("alRequestFoldbackStop"));
-    /* AL_SOFT_buffer_samples */
-    functions[0].BufferSamplesSOFT           = REINTERPRET_CAST(LPALBUFFERSAMPLESSOFT,              loader("alBufferSamplesSOFT"));
-    functions[0].BufferSubSamplesSOFT        = REINTERPRET_CAST(LPALBUFFERSUBSAMPLESSOFT,           loader("alBufferSubSamplesSOFT"));
-    functions[0].GetBufferSamplesSOFT        = REINTERPRET_CAST(LPALGETBUFFERSAMPLESSOFT,           loader("alGetBufferSamplesSOFT"));
-    functions[0].IsBufferFormatSupportedSOFT = REINTERPRET_CAST(LPALISBUFFERFORMATSUPPORTEDSOFT,    loader("alIsBufferFormatSupportedSOFT"));
+    ALAD_DIRECT_ENTRY_(alRequestFoldbackStartDirect,       "alRequestFoldbackStartDirect",       ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alRequestFoldbackStopDirect,        "alRequestFoldbackStopDirect",        ALAD_ALC_EXT_direct_context),
+    /* AL_SOFT_buffer_sub_data */
+    ALAD_DIRECT_ENTRY_(alBufferSubDataDirectSOFT,          "alBufferSubDataDirectSOFT",          ALAD_ALC_EXT_direct_context),
     /* AL_SOFT_source_latency */
-    functions[0].SourcedSOFT                 = REINTERPRET_CAST(LPALSOURCEDSOFT,                    loader("alSourcedSOFT"));
-    functions[0].Source3dSOFT                = REINTERPRET_CAST(LPALSOURCE3DSOFT,                   loader("alSource3dSOFT"));
-    functions[0].SourcedvSOFT                = REINTERPRET_CAST(LPALSOURCEDVSOFT,                   loader("alSourcedvSOFT"));
-    functions[0].GetSourcedSOFT              = REINTERPRET_CAST(LPALGETSOURCEDSOFT,                 loader("alGetSourcedSOFT"));
-    functions[0].GetSource3dSOFT             = REINTERPRET_CAST(LPALGETSOURCE3DSOFT,                loader("alGetSource3dSOFT"));
-    functions[0].GetSourcedvSOFT             = REINTERPRET_CAST(LPALGETSOURCEDVSOFT,                loader("alGetSourcedvSOFT"));
-    functions[0].Sourcei64SOFT               = REINTERPRET_CAST(LPALSOURCEI64SOFT,                  loader("alSourcei64SOFT"));
-    functions[0].Source3i64SOFT              = REINTERPRET_CAST(LPALSOURCE3I64SOFT,                 loader("alSource3i64SOFT"));
-    functions[0].Sourcei64vSOFT              = REINTERPRET_CAST(LPALSOURCEI64VSOFT,                 loader("alSourcei64vSOFT"));
-    functions[0].GetSourcei64SOFT            = REINTERPRET_CAST(LPALGETSOURCEI64SOFT,               loader("alGetSourcei64SOFT"));
-    functions[0].GetSource3i64SOFT           = REINTERPRET_CAST(LPALGETSOURCE3I64SOFT,              loader("alGetSource3i64SOFT"));
-    functions[0].GetSourcei64vSOFT           = REINTERPRET_CAST(LPALGETSOURCEI64VSOFT,              loader("alGetSourcei64vSOFT"));
+    ALAD_DIRECT_ENTRY_(alSourcedDirectSOFT,                "alSourcedDirectSOFT",                ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSource3dDirectSOFT,               "alSource3dDirectSOFT",               ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSourcedvDirectSOFT,               "alSourcedvDirectSOFT",               ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetSourcedDirectSOFT,             "alGetSourcedDirectSOFT",             ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetSource3dDirectSOFT,            "alGetSource3dDirectSOFT",            ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetSourcedvDirectSOFT,            "alGetSourcedvDirectSOFT",            ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSourcei64DirectSOFT,              "alSourcei64DirectSOFT",              ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSource3i64DirectSOFT,             "alSource3i64DirectSOFT",             ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSourcei64vDirectSOFT,             "alSourcei64vDirectSOFT",             ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetSourcei64DirectSOFT,           "alGetSourcei64DirectSOFT",           ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetSource3i64DirectSOFT,          "alGetSource3i64DirectSOFT",          ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetSourcei64vDirectSOFT,          "alGetSourcei64vDirectSOFT",          ALAD_ALC_EXT_direct_context),
     /* AL_SOFT_deferred_updates */
-    functions[0].DeferUpdatesSOFT            = REINTERPRET_CAST(LPALDEFERUPDATESSOFT,               loader("alDeferUpdatesSOFT"));
-    functions[0].ProcessUpdatesSOFT          = REINTERPRET_CAST(LPALPROCESSUPDATESSOFT,             loader("alProcessUpdatesSOFT"));
+    ALAD_DIRECT_ENTRY_(alDeferUpdatesDirectSOFT,           "alDeferUpdatesDirectSOFT",           ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alProcessUpdatesDirectSOFT,         "alProcessUpdatesDirectSOFT",         ALAD_ALC_EXT_direct_context),
     /* AL_SOFT_source_resampler */
-    functions[0].GetStringiSOFT              = REINTERPRET_CAST(LPALGETSTRINGISOFT,                 loader("alGetStringiSOFT"));
+    ALAD_DIRECT_ENTRY_(alGetStringiDirectSOFT,             "alGetStringiDirectSOFT",             ALAD_ALC_EXT_direct_context),
     /* AL_SOFT_events */
-    functions[0].EventControlSOFT            = REINTERPRET_CAST(LPALEVENTCONTROLSOFT,               loader("alEventControlSOFT"));
-    functions[0].EventCallbackSOFT           = REINTERPRET_CAST(LPALEVENTCALLBACKSOFT,              loader("alEventCallbackSOFT"));
-    functions[0].GetPointerSOFT              = REINTERPRET_CAST(LPALGETPOINTERSOFT,                 loader("alGetPointerSOFT"));
-    functions[0].GetPointervSOFT             = REINTERPRET_CAST(LPALGETPOINTERVSOFT,                loader("alGetPointervSOFT"));
+    ALAD_DIRECT_ENTRY_(alEventControlDirectSOFT,           "alEventControlDirectSOFT",           ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alEventCallbackDirectSOFT,          "alEventCallbackDirectSOFT",          ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetPointerDirectSOFT,             "alGetPointerDirectSOFT",             ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetPointervDirectSOFT,            "alGetPointervDirectSOFT",            ALAD_ALC_EXT_direct_context),
     /* AL_SOFT_callback_buffer */
-    functions[0].BufferCallbackSOFT          = REINTERPRET_CAST(LPALBUFFERCALLBACKSOFT,             loader("alBufferCallbackSOFT"));
-    functions[0].GetBufferPtrSOFT            = REINTERPRET_CAST(LPALGETBUFFERPTRSOFT,               loader("alGetBufferPtrSOFT"));
-    functions[0].GetBuffer3PtrSOFT           = REINTERPRET_CAST(LPALGETBUFFER3PTRSOFT,              loader("alGetBuffer3PtrSOFT"));
-    functions[0].GetBufferPtrvSOFT           = REINTERPRET_CAST(LPALGETBUFFERPTRVSOFT,              loader("alGetBufferPtrvSOFT"));
+    ALAD_DIRECT_ENTRY_(alBufferCallbackDirectSOFT,         "alBufferCallbackDirectSOFT",         ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetBufferPtrDirectSOFT,           "alGetBufferPtrDirectSOFT",           ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetBuffer3PtrDirectSOFT,          "alGetBuffer3PtrDirectSOFT",          ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alGetBufferPtrvDirectSOFT,          "alGetBufferPtrvDirectSOFT",          ALAD_ALC_EXT_direct_context),
     /* AL_SOFT_source_start_delay */
-    functions[0].SourcePlayAtTimeSOFT        = REINTERPRET_CAST(LPALSOURCEPLAYATTIMESOFT,           loader("alSourcePlayAtTimeSOFT"));
-    functions[0].SourcePlayAtTimevSOFT       = REINTERPRET_CAST(LPALSOURCEPLAYATTIMEVSOFT,          loader("alSourcePlayAtTimevSOFT"));
-    /* AL_EXT_debug */
-    functions[0].DebugMessageCallbackEXT     = REINTERPRET_CAST(LPALDEBUGMESSAGECALLBACKEXT,        loader("alDebugMessageCallbackEXT"));
-    functions[0].DebugMessageInsertEXT       = REINTERPRET_CAST(LPALDEBUGMESSAGEINSERTEXT,          loader("alDebugMessageInsertEXT"));
-    functions[0].DebugMessageControlEXT      = REINTERPRET_CAST(LPALDEBUGMESSAGECONTROLEXT,         loader("alDebugMessageControlEXT"));
-    functions[0].PushDebugGroupEXT           = REINTERPRET_CAST(LPALPUSHDEBUGGROUPEXT,              loader("alPushDebugGroupEXT"));
-    functions[0].PopDebugGroupEXT            = REINTERPRET_CAST(LPALPOPDEBUGGROUPEXT,               loader("alPopDebugGroupEXT"));
-    functions[0].GetDebugMessageLogEXT       = REINTERPRET_CAST(LPALGETDEBUGMESSAGELOGEXT,          loader("alGetDebugMessageLogEXT"));
-    functions[0].ObjectLabelEXT              = REINTERPRET_CAST(LPALOBJECTLABELEXT,                 loader("alObjectLabelEXT"));
-    functions[0].GetObjectLabelEXT           = REINTERPRET_CAST(LPALGETOBJECTLABELEXT,              loader("alGetObjectLabelEXT"));
-    functions[0].GetPointerEXT               = REINTERPRET_CAST(LPALGETPOINTEREXT,                  loader("alGetPointerEXT"));
-    functions[0].GetPointervEXT              = REINTERPRET_CAST(LPALGETPOINTERVEXT,                 loader("alGetPointervEXT"));
-}
-void aladLoadALCCore(aladALFunctions* functions, aladLoader loader) {
-    functions[0].CreateContext      = REINTERPRET_CAST(LPALCCREATECONTEXT,      loader("alcCreateContext"));
-    functions[0].MakeContextCurrent = REINTERPRET_CAST(LPALCMAKECONTEXTCURRENT, loader("alcMakeContextCurrent"));
-    functions[0].ProcessContext     = REINTERPRET_CAST(LPALCPROCESSCONTEXT,     loader("alcProcessContext"));
-    functions[0].SuspendContext     = REINTERPRET_CAST(LPALCSUSPENDCONTEXT,     loader("alcSuspendContext"));
-    functions[0].DestroyContext     = REINTERPRET_CAST(LPALCDESTROYCONTEXT,     loader("alcDestroyContext"));
-    functions[0].GetCurrentContext  = REINTERPRET_CAST(LPALCGETCURRENTCONTEXT,  loader("alcGetCurrentContext"));
-    functions[0].GetContextsDevice  = REINTERPRET_CAST(LPALCGETCONTEXTSDEVICE,  loader("alcGetContextsDevice"));
-    functions[0].OpenDevice         = REINTERPRET_CAST(LPALCOPENDEVICE,         loader("alcOpenDevice"));
-    functions[0].CloseDevice        = REINTERPRET_CAST(LPALCCLOSEDEVICE,        loader("alcCloseDevice"));
-    functions[0].GetError           = REINTERPRET_CAST(LPALCGETERROR,           loader("alcGetError"));
-    functions[0].IsExtensionPresent = REINTERPRET_CAST(LPALCISEXTENSIONPRESENT, loader("alcIsExtensionPresent"));
-    functions[0].GetEnumValue       = REINTERPRET_CAST(LPALCGETENUMVALUE,       loader("alcGetEnumValue"));
-    functions[0].GetString          = REINTERPRET_CAST(LPALCGETSTRING,          loader("alcGetString"));
-    functions[0].GetIntegerv        = REINTERPRET_CAST(LPALCGETINTEGERV,        loader("alcGetIntegerv"));
-    functions[0].CaptureOpenDevice  = REINTERPRET_CAST(LPALCCAPTUREOPENDEVICE,  loader("alcCaptureOpenDevice"));
-    functions[0].CaptureCloseDevice = REINTERPRET_CAST(LPALCCAPTURECLOSEDEVICE, loader("alcCaptureCloseDevice"));
-    functions[0].CaptureStart       = REINTERPRET_CAST(LPALCCAPTURESTART,       loader("alcCaptureStart"));
-    functions[0].CaptureStop        = REINTERPRET_CAST(LPALCCAPTURESTOP,        loader("alcCaptureStop"));
-    functions[0].CaptureSamples     = REINTERPRET_CAST(LPALCCAPTURESAMPLES,     loader("alcCaptureSamples"));
-}
-void aladLoadALCExtensions(aladALFunctions* functions, aladLoader loader) {
-    /* ALC_EXT_thread_local_context */
-    functions[0].SetThreadContext            = REINTERPRET_CAST(PFNALCSETTHREADCONTEXTPROC,         loader("alcSetThreadContext"));
-    functions[0].GetThreadContext            = REINTERPRET_CAST(PFNALCGETTHREADCONTEXTPROC,         loader("alcGetThreadContext"));
-    /* ALC_SOFT_loopback */
-    functions[0].LoopbackOpenDeviceSOFT      = REINTERPRET_CAST(LPALCLOOPBACKOPENDEVICESOFT,        loader("alcLoopbackOpenDeviceSOFT"));
-    functions[0].IsRenderFormatSupportedSOFT = REINTERPRET_CAST(LPALCISRENDERFORMATSUPPORTEDSOFT,   loader("alcIsRenderFormatSupportedSOFT"));
-    functions[0].RenderSamplesSOFT           = REINTERPRET_CAST(LPALCRENDERSAMPLESSOFT,             loader("alcRenderSamplesSOFT"));
-    /* ALC_SOFT_pause_device */
-    functions[0].DevicePauseSOFT             = REINTERPRET_CAST(LPALCDEVICEPAUSESOFT,               loader("alcDevicePauseSOFT"));
-    functions[0].DeviceResumeSOFT            = REINTERPRET_CAST(LPALCDEVICERESUMESOFT,              loader("alcDeviceResumeSOFT"));
-    /* ALC_SOFT_HRTF */
-    functions[0].GetStringiSOFT              = REINTERPRET_CAST(LPALCGETSTRINGISOFT,                loader("alcGetStringiSOFT"));
-    functions[0].ResetDeviceSOFT             = REINTERPRET_CAST(LPALCRESETDEVICESOFT,               loader("alcResetDeviceSOFT"));
-    /* ALC_SOFT_device_clock */
-    functions[0].GetInteger64vSOFT           = REINTERPRET_CAST(LPALCGETINTEGER64VSOFT,             loader("alcGetInteger64vSOFT"));
-    /* ALC_SOFT_reopen_device */
-    functions[0].ReopenDeviceSOFT            = REINTERPRET_CAST(LPALCREOPENDEVICESOFT,              loader("alcReopenDeviceSOFT"));
-    /* ALC_SOFT_system_events */
-    functions[0].EventIsSupportedSOFT        = REINTERPRET_CAST(LPALCEVENTISSUPPORTEDSOFT,          loader("alcEventIsSupportedSOFT"));
-    functions[0].EventControlSOFT            = REINTERPRET_CAST(LPALCEVENTCONTROLSOFT,              loader("alcEventControlSOFT"));
-    functions[0].EventCallbackSOFT           = REINTERPRET_CAST(LPALCEVENTCALLBACKSOFT,             loader("alcEventCallbackSOFT"));
+    ALAD_DIRECT_ENTRY_(alSourcePlayAtTimeDirectSOFT,       "alSourcePlayAtTimeDirectSOFT",       ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(alSourcePlayAtTimevDirectSOFT,      "alSourcePlayAtTimevDirectSOFT",      ALAD_ALC_EXT_direct_context),
+    /* EAX */
+    ALAD_DIRECT_ENTRY_(EAXSetDirect,                       "EAXSetDirect",                       ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(EAXGetDirect,                       "EAXGetDirect",                       ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(EAXSetBufferModeDirect,             "EAXSetBufferModeDirect",             ALAD_ALC_EXT_direct_context),
+    ALAD_DIRECT_ENTRY_(EAXGetBufferModeDirect,             "EAXGetBufferModeDirect",             ALAD_ALC_EXT_direct_context)
+};
+const size_t aladALTableSize     = sizeof(aladALTable) / sizeof(aladALTable[0]);
+const size_t aladALCTableSize    = sizeof(aladALCTable) / sizeof(aladALCTable[0]);
+const size_t aladDirectTableSize = sizeof(aladDirectTable) / sizeof(aladDirectTable[0]);
+
+/* the plain aladLoader functions forward to the Ex versions with this as the user pointer */
+typedef struct alad_plain_loader_ {
+    aladLoader loader;
+} alad_plain_loader_;
+static aladFunction alad_call_plain_loader_(void *user, const char *name) {
+    return REINTERPRET_CAST(alad_plain_loader_*, user)->loader(name);
 }
-void aladLoadDirectExtension(aladDirectFunctions* functions, aladLoader loader) {
-    /* AL_EXT_direct_context */
-    functions[0].alcGetProcAddress2                      = REINTERPRET_CAST(LPALCGETPROCADDRESS2                 ,loader("alcGetProcAddress2"));
-    functions[0].alEnableDirect                          = REINTERPRET_CAST(LPALENABLEDIRECT                     ,loader("alEnableDirect"));
-    functions[0].alDisableDirect                         = REINTERPRET_CAST(LPALDISABLEDIRECT                    ,loader("alDisableDirect"));
-    functions[0].alIsEnabledDirect                       = REINTERPRET_CAST(LPALISENABLEDDIRECT                  ,loader("alIsEnabledDirect"));
-    functions[0].alDopplerFactorDirect                   = REINTERPRET_CAST(LPALDOPPLERFACTORDIRECT              ,loader("alDopplerFactorDirect"));
-    functions[0].alSpeedOfSoundDirect                    = REINTERPRET_CAST(LPALSPEEDOFSOUNDDIRECT               ,loader("alSpeedOfSoundDirect"));
-    functions[0].alDistanceModelDirect                   = REINTERPRET_CAST(LPALDISTANCEMODELDIRECT              ,loader("alDistanceModelDirect"));
-    functions[0].alGetStringDirect                       = REINTERPRET_CAST(LPALGETSTRINGDIRECT                  ,loader("alGetStringDirect"));
-    functions[0].alGetBooleanvDirect                     = REINTERPRET_CAST(LPALGETBOOLEANVDIRECT                ,loader("alGetBooleanvDirect"));
-    functions[0].alGetIntegervDirect                     = REINTERPRET_CAST(LPALGETINTEGERVDIRECT                ,loader("alGetIntegervDirect"));
-    functions[0].alGetFloatvDirect                       = REINTERPRET_CAST(LPALGETFLOATVDIRECT                  ,loader("alGetFloatvDirect"));
-    functions[0].alGetDoublevDirect                      = REINTERPRET_CAST(LPALGETDOUBLEVDIRECT                 ,loader("alGetDoublevDirect"));
-    functions[0].alGetBooleanDirect                      = REINTERPRET_CAST(LPALGETBOOLEANDIRECT                 ,loader("alGetBooleanDirect"));
-    functions[0].alGetIntegerDirect                      = REINTERPRET_CAST(LPALGETINTEGERDIRECT                 ,loader("alGetIntegerDirect"));
-    functions[0].alGetFloatDirect                        = REINTERPRET_CAST(LPALGETFLOATDIRECT                   ,loader("alGetFloatDirect"));
-    functions[0].alGetDoubleDirect                       = REINTERPRET_CAST(LPALGETDOUBLEDIRECT                  ,loader("alGetDoubleDirect"));
-    functions[0].alGetErrorDirect                        = REINTERPRET_CAST(LPALGETERRORDIRECT                   ,loader("alGetErrorDirect"));
-    functions[0].alIsExtensionPresentDirect              = REINTERPRET_CAST(LPALISEXTENSIONPRESENTDIRECT         ,loader("alIsExtensionPresentDirect"));
-    functions[0].alGetProcAddressDirect                  = REINTERPRET_CAST(LPALGETPROCADDRESSDIRECT             ,loader("alGetProcAddressDirect"));
-    functions[0].alGetEnumValueDirect                    = REINTERPRET_CAST(LPALGETENUMVALUEDIRECT               ,loader("alGetEnumValueDirect"));
-    functions[0].alListenerfDirect                       = REINTERPRET_CAST(LPALLISTENERFDIRECT                  ,loader("alListenerfDirect"));
-    functions[0].alListener3fDirect                      = REINTERPRET_CAST(LPALLISTENER3FDIRECT                 ,loader("alListener3fDirect"));
-    functions[0].alListenerfvDirect                      = REINTERPRET_CAST(LPALLISTENERFVDIRECT                 ,loader("alListenerfvDirect"));
-    functions[0].alListeneriDirect                       = REINTERPRET_CAST(LPALLISTENERIDIRECT                  ,loader("alListeneriDirect"));
-    functions[0].alListener3iDirect                      = REINTERPRET_CAST(LPALLISTENER3IDIRECT                 ,loader("alListener3iDirect"));
-    functions[0].alListenerivDirect                      = REINTERPRET_CAST(LPALLISTENERIVDIRECT                 ,loader("alListenerivDirect"));
-    functions[0].alGetListenerfDirect                    = REINTERPRET_CAST(LPALGETLISTENERFDIRECT               ,loader("alGetListenerfDirect"));
-    functions[0].alGetListener3fDirect                   = REINTERPRET_CAST(LPALGETLISTENER3FDIRECT              ,loader("alGetListener3fDirect"));
-    functions[0].alGetListenerfvDirect                   = REINTERPRET_CAST(LPALGETLISTENERFVDIRECT              ,loader("alGetListenerfvDirect"));
-    functions[0].alGetListeneriDirect                    = REINTERPRET_CAST(LPALGETLISTENERIDIRECT               ,loader("alGetListeneriDirect"));
-    functions[0].alGetListener3iDirect                   = REINTERPRET_CAST(LPALGETLISTENER3IDIRECT              ,loader("alGetListener3iDirect"));
-    functions[0].alGetListenerivDirect                   = REINTERPRET_CAST(LPALGETLISTENERIVDIRECT              ,loader("alGetListenerivDirect"));
-    functions[0].alGenSourcesDirect                      = REINTERPRET_CAST(LPALGENSOURCESDIRECT                 ,loader("alGenSourcesDirect"));
-    functions[0].alDeleteSourcesDirect                   = REINTERPRET_CAST(LPALDELETESOURCESDIRECT              ,loader("alDeleteSourcesDirect"));
-    functions[0].alIsSourceDirect                        = REINTERPRET_CAST(LPALISSOURCEDIRECT                   ,loader("alIsSourceDirect"));
-    functions[0].alSourcefDirect                         = REINTERPRET_CAST(LPALSOURCEFDIRECT                    ,loader("alSourcefDirect"));
-    functions[0].alSource3fDirect                        = REINTERPRET_CAST(LPALSOURCE3FDIRECT                   ,loader("alSource3fDirect"));
-    functions[0].alSourcefvDirect                        = REINTERPRET_CAST(LPALSOURCEFVDIRECT                   ,loader("alSourcefvDirect"));
-    functions[0].alSourceiDirect                         = REINTERPRET_CAST(LPALSOURCEIDIRECT                    ,loader("alSourceiDirect"));
-    functions[0].alSource3iDirect                        = REINTERPRET_CAST(LPALSOURCE3IDIRECT                   ,loader("alSource3iDirect"));
-    functions[0].alSourceivDirect                        = REINTERPRET_CAST(LPALSOURCEIVDIRECT                   ,loader("alSourceivDirect"));
-    functions[0].alSourceivDirect                        = REINTERPRET_CAST(LPALSOURCEIVDIRECT                   ,loader("alSourceivDirect"));
-    functions[0].alGetSourcefDirect                      = REINTERPRET_CAST(LPALGETSOURCEFDIRECT                 ,loader("alGetSourcefDirect"));
-    functions[0].alGetSource3fDirect                     = REINTERPRET_CAST(LPALGETSOURCE3FDIRECT                ,loader("alGetSource3fDirect"));
-    functions[0].alGetSourcefvDirect                     = REINTERPRET_CAST(LPALGETSOURCEFVDIRECT                ,loader("alGetSourcefvDirect"));
-    functions[0].alGetSourceiDirect                      = REINTERPRET_CAST(LPALGETSOURCEIDIRECT                 ,loader("alGetSourceiDirect"));
-    functions[0].alGetSource3iDirect                     = REINTERPRET_CAST(LPALGETSOURCE3IDIRECT                ,loader("alGetSource3iDirect"));
-    functions[0].alGetSourceivDirect                     = REINTERPRET_CAST(LPALGETSOURCEIVDIRECT                ,loader("alGetSourceivDirect"));
-    functions[0].alSourcePlayDirect                      = REINTERPRET_CAST(LPALSOURCEPLAYVDIRECT                ,loader("alSourcePlayDirect"));
-    functions[0].alSourceStopDirect                      = REINTERPRET_CAST(LPALSOURCESTOPVDIRECT                ,loader("alSourceStopDirect"));
-    functions[0].alSourceRewindvDirect                   = REINTERPRET_CAST(LPALSOURCEREWINDVDIRECT              ,loader("alSourceRewindvDirect"));
-    functions[0].alSourcePausevDirect                    = REINTERPRET_CAST(LPALSOURCEPAUSEVDIRECT               ,loader("alSourcePausevDirect"));
-    functions[0].alSourcePlayvDirect                     = REINTERPRET_CAST(LPALSOURCEPLAYDIRECT                 ,loader("alSourcePlayvDirect"));
-    functions[0].alSourceStopvDirect                     = REINTERPRET_CAST(LPALSOURCESTOPDIRECT                 ,loader("alSourceStopvDirect"));
-    functions[0].alSourceRewindDirect                    = REINTERPRET_CAST(LPALSOURCEREWINDDIRECT               ,loader("alSourceRewindDirect"));
-    functions[0].alSourcePauseDirect                     = REINTERPRET_CAST(LPALSOURCEPAUSEDIRECT                ,loader("alSourcePauseDirect"));
-    functions[0].alSourceQueueBuffersDirect              = REINTERPRET_CAST(LPALSOURCEQUEUEBUFFERSDIRECT         ,loader("alSourceQueueBuffersDirect"));
-    functions[0].alSourceUnqueueBuffersDirect            = REINTERPRET_CAST(LPALSOURCEUNQUEUEBUFFERSDIRECT       ,loader("alSourceUnqueueBuffersDirect"));
-    functions[0].alGenBuffersDirect                      = REINTERPRET_CAST(LPALGENBUFFERSDIRECT                 ,loader("alGenBuffersDirect"));
-    functions[0].alDeleteBuffersDirect                   = REINTERPRET_CAST(LPALDELETEBUFFERSDIRECT              ,loader("alDeleteBuffersDirect"));
-    functions[0].alIsBufferDirect                        = REINTERPRET_CAST(LPALISBUFFERDIRECT                   ,loader("alIsBufferDirect"));
-    functions[0].alBufferDataDirect                      = REINTERPRET_CAST(LPALBUFFERDATADIRECT                 ,loader("alBufferDataDirect"));
-    functions[0].alBufferfDirect                         = REINTERPRET_CAST(LPALBUFFERFDIRECT                    ,loader("alBufferfDirect"));
-    functions[0].alBuffer3fDirect                        = REINTERPRET_CAST(LPALBUFFER3FDIRECT                   ,loader("alBuffer3fDirect"));
-    functions[0].alBufferfvDirect                        = REINTERPRET_CAST(LPALBUFFERFVDIRECT                   ,loader("alBufferfvDirect"));
-    functions[0].alBufferiDirect                         = REINTERPRET_CAST(LPALBUFFERIDIRECT                    ,loader("alBufferiDirect"));
-    functions[0].alBuffer3iDirect                        = REINTERPRET_CAST(LPALBUFFER3IDIRECT                   ,loader("alBuffer3iDirect"));
-    functions[0].alBufferivDirect                        = REINTERPRET_CAST(LPALBUFFERIVDIRECT                   ,loader("alBufferivDirect"));
-    functions[0].alGetBufferfDirect                      = REINTERPRET_CAST(LPALGETBUFFERFDIRECT                 ,loader("alGetBufferfDirect"));
-    functions[0].alGetBuffer3fDirect                     = REINTERPRET_CAST(LPALGETBUFFER3FDIRECT                ,loader("alGetBuffer3fDirect"));
-    functions[0].alGetBufferfvDirect                     = REINTERPRET_CAST(LPALGETBUFFERFVDIRECT                ,loader("alGetBufferfvDirect"));
-    functions[0].alGetBufferiDirect                      = REINTERPRET_CAST(LPALGETBUFFERIDIRECT                 ,loader("alGetBufferiDirect"));
-    functions[0].alGetBuffer3iDirect                     = REINTERPRET_CAST(LPALGETBUFFER3IDIRECT                ,loader("alGetBuffer3iDirect"));
-    functions[0].alGetBufferivDirect                     = REINTERPRET_CAST(LPALGETBUFFERIVDIRECT                ,loader("alGetBufferivDirect"));
-        /* ALC_EXT_EFX */   
-    functions[0].alGenEffectsDirect                      = REINTERPRET_CAST(LPALGENEFFECTSDIRECT                 ,loader("alGenEffectsDirect"));
-    functions[0].alDeleteEffectsDirect                   = REINTERPRET_CAST(LPALDELETEEFFECTSDIRECT              ,loader("alDeleteEffectsDirect"));
-    functions[0].alIsEffectDirect                        = REINTERPRET_CAST(LPALISEFFECTDIRECT                   ,loader("alIsEffectDirect"));
-    functions[0].alEffectiDirect                         = REINTERPRET_CAST(LPALEFFECTIDIRECT                    ,loader("alEffectiDirect"));
-    functions[0].alEffectivDirect                        = REINTERPRET_CAST(LPALEFFECTIVDIRECT                   ,loader("alEffectivDirect"));
-    functions[0].alEffectfDirect                         = REINTERPRET_CAST(LPALEFFECTFDIRECT                    ,loader("alEffectfDirect"));
-    functions[0].alEffectfvDirect                        = REINTERPRET_CAST(LPALEFFECTFVDIRECT                   ,loader("alEffectfvDirect"));
-    functions[0].alGetEffectiDirect                      = REINTERPRET_CAST(LPALGETEFFECTIDIRECT                 ,loader("alGetEffectiDirect"));
-    functions[0].alGetEffectivDirect                     = REINTERPRET_CAST(LPALGETEFFECTIVDIRECT                ,loader("alGetEffectivDirect"));
-    functions[0].alGetEffectfDirect                      = REINTERPRET_CAST(LPALGETEFFECTFDIRECT                 ,loader("alGetEffectfDirect"));
-    functions[0].alGetEffectfvDirect                     = REINTERPRET_CAST(LPALGETEFFECTFVDIRECT                ,loader("alGetEffectfvDirect"));
-    functions[0].alGenFiltersDirect                      = REINTERPRET_CAST(LPALGENFILTERSDIRECT                 ,loader("alGenFiltersDirect"));
-    functions[0].alDeleteFiltersDirect                   = REINTERPRET_CAST(LPALDELETEFILTERSDIRECT              ,loader("alDeleteFiltersDirect"));
-    functions[0].alIsFilterDirect                        = REINTERPRET_CAST(LPALISFILTERDIRECT                   ,loader("alIsFilterDirect"));
-    functions[0].alFilteriDirect                         = REINTERPRET_CAST(LPALFILTERIDIRECT                    ,loader("alFilteriDirect"));
-    functions[0].alFilterivDirect                        = REINTERPRET_CAST(LPALFILTERIVDIRECT                   ,loader("alFilterivDirect"));
-    functions[0].alFilterfDirect                         = REINTERPRET_CAST(LPALFILTERFDIRECT                    ,loader("alFilterfDirect"));
-    functions[0].alFilterfvDirect                        = REINTERPRET_CAST(LPALFILTERFVDIRECT                   ,loader("alFilterfvDirect"));
-    functions[0].alGetFilteriDirect                      = REINTERPRET_CAST(LPALGETFILTERIDIRECT                 ,loader("alGetFilteriDirect"));
-    functions[0].alGetFilterivDirect                     = REINTERPRET_CAST(LPALGETFILTERIVDIRECT                ,loader("alGetFilterivDirect"));
-    functions[0].alGetFilterfDirect                      = REINTERPRET_CAST(LPALGETFILTERFDIRECT                 ,loader("alGetFilterfDirect"));
-    functions[0].alGetFilterfvDirect                     = REINTERPRET_CAST(LPALGETFILTERFVDIRECT                ,loader("alGetFilterfvDirect"));
-    functions[0].alGenAuxiliaryEffectSlotsDirect         = REINTERPRET_CAST(LPALGENAUXILIARYEFFECTSLOTSDIRECT    ,loader("alGenAuxiliaryEffectSlotsDirect"));
-    functions[0].alDeleteAuxiliaryEffectSlotsDirect      = REINTERPRET_CAST(LPALDELETEAUXILIARYEFFECTSLOTSDIRECT ,loader("alDeleteAuxiliaryEffectSlotsDirect"));
-    functions[0].alIsAuxiliaryEffectSlotDirect           = REINTERPRET_CAST(LPALISAUXILIARYEFFECTSLOTDIRECT      ,loader("alIsAuxiliaryEffectSlotDirect"));
-    functions[0].alAuxiliaryEffectSlotiDirect            = REINTERPRET_CAST(LPALAUXILIARYEFFECTSLOTIDIRECT       ,loader("alAuxiliaryEffectSlotiDirect"));
-    functions[0].alAuxiliaryEffectSlotivDirect           = REINTERPRET_CAST(LPALAUXILIARYEFFECTSLOTIVDIRECT      ,loader("alAuxiliaryEffectSlotivDirect"));
-    functions[0].alAuxiliaryEffectSlotfDirect            = REINTERPRET_CAST(LPALAUXILIARYEFFECTSLOTFDIRECT       ,loader("alAuxiliaryEffectSlotfDirect"));
-    functions[0].alAuxiliaryEffectSlotfvDirect           = REINTERPRET_CAST(LPALAUXILIARYEFFECTSLOTFVDIRECT      ,loader("alAuxiliaryEffectSlotfvDirect"));
-    functions[0].alGetAuxiliaryEffectSlotiDirect         = REINTERPRET_CAST(LPALGETAUXILIARYEFFECTSLOTIDIRECT    ,loader("alGetAuxiliaryEffectSlotiDirect"));
-    functions[0].alGetAuxiliaryEffectSlotivDirect        = REINTERPRET_CAST(LPALGETAUXILIARYEFFECTSLOTIVDIRECT   ,loader("alGetAuxiliaryEffectSlotivDirect"));
-    functions[0].alGetAuxiliaryEffectSlotfDirect         = REINTERPRET_CAST(LPALGETAUXILIARYEFFECTSLOTFDIRECT    ,loader("alGetAuxiliaryEffectSlotfDirect"));
-    functions[0].alGetAuxiliaryEffectSlotfvDirect        = REINTERPRET_CAST(LPALGETAUXILIARYEFFECTSLOTFVDIRECT   ,loader("alGetAuxiliaryEffectSlotfvDirect"));
-        /* AL_EXT_BUFFER_DATA_STATIC */
-    functions[0].alBufferDataStaticDirect                = REINTERPRET_CAST(LPALBUFFERDATASTATICDIRECT           ,loader("alBufferDataStaticDirect"));
-        /* AL_EXT_debug */
-    functions[0].alDebugMessageCallbackDirectEXT         = REINTERPRET_CAST(LPALDEBUGMESSAGECALLBACKDIRECTEXT    ,loader("alDebugMessageCallbackDirectEXT"));
-    functions[0].alDebugMessageInsertDirectEXT           = REINTERPRET_CAST(LPALDEBUGMESSAGEINSERTDIRECTEXT      ,loader("alDebugMessageInsertDirectEXT"));
-    functions[0].alDebugMessageControlDirectEXT          = REINTERPRET_CAST(LPALDEBUGMESSAGECONTROLDIRECTEXT     ,loader("alDebugMessageControlDirectEXT"));
-    functions[0].alPushDebugGroupDirectEXT               = REINTERPRET_CAST(LPALPUSHDEBUGGROUPDIRECTEXT          ,loader("alPushDebugGroupDirectEXT"));
-    functions[0].alPopDebugGroupDirectEXT                = REINTERPRET_CAST(LPALPOPDEBUGGROUPDIRECTEXT           ,loader("alPopDebugGroupDirectEXT"));
-    functions[0].alGetDebugMessageLogDirectEXT           = REINTERPRET_CAST(LPALGETDEBUGMESSAGELOGDIRECTEXT      ,loader("alGetDebugMessageLogDirectEXT"));
-    functions[0].alObjectLabelDirectEXT                  = REINTERPRET_CAST(LPALOBJECTLABELDIRECTEXT             ,loader("alObjectLabelDirectEXT"));
-    functions[0].alGetObjectLabelDirectEXT               = REINTERPRET_CAST(LPALGETOBJECTLABELDIRECTEXT          ,loader("alGetObjectLabelDirectEXT"));
-    functions[0].alGetPointerDirectEXT                   = REINTERPRET_CAST(LPALGETPOINTERDIRECTEXT              ,loader("alGetPointerDirectEXT"))
-    functions[0].alGetPointervDirectEXT                  = REINTERPRET_CAST(LPALGETPOINTERVDIRECTEXT             ,loader("alGetPointervDirectEXT"))
-        /* AL_EXT_FOLDBACK */
-    functions[0].alRequestFoldbackStartDirect            = REINTERPRET_CAST(LPALREQUESTFOLDBACKSTARTDIRECT       ,loader("alRequestFoldbackStartDirect"));
-    functions[0].alRequestFoldbackStopDirect             = REINTERPRET_CAST(LPALREQUESTFOLDBACKSTOPDIRECT        ,loader("alRequestFoldbackStopDirect"));
-        /* AL_SOFT_buffer_sub_data */
-    functions[0].alBufferSubDataDirectSOFT               = REINTERPRET_CAST(LPALBUFFERSUBDATADIRECTSOFT          ,loader("alBufferSubDataDirectSOFT"));
-        /* AL_SOFT_source_latency */
-    functions[0].alSourcedDirectSOFT                     = REINTERPRET_CAST(LPALSOURCEDDIRECTSOFT                ,loader("alSourcedDirectSOFT"));
-    functions[0].alSource3dDirectSOFT                    = REINTERPRET_CAST(LPALSOURCE3DDIRECTSOFT               ,loader("alSource3dDirectSOFT"));
-    functions[0].alSourcedvDirectSOFT                    = REINTERPRET_CAST(LPALSOURCEDVDIRECTSOFT               ,loader("alSourcedvDirectSOFT"));
-    functions[0].alGetSourcedDirectSOFT                  = REINTERPRET_CAST(LPALGETSOURCEDDIRECTSOFT             ,loader("alGetSourcedDirectSOFT"));
-    functions[0].alGetSource3dDirectSOFT                 = REINTERPRET_CAST(LPALGETSOURCE3DDIRECTSOFT            ,loader("alGetSource3dDirectSOFT"));
-    functions[0].alGetSourcedvDirectSOFT                 = REINTERPRET_CAST(LPALGETSOURCEDVDIRECTSOFT            ,loader("alGetSourcedvDirectSOFT"));
-    functions[0].alSourcei64DirectSOFT                   = REINTERPRET_CAST(LPALSOURCEI64DIRECTSOFT              ,loader("alSourcei64DirectSOFT"));
-    functions[0].alSource3i64DirectSOFT                  = REINTERPRET_CAST(LPALSOURCE3I64DIRECTSOFT             ,loader("alSource3i64DirectSOFT"));
-    functions[0].alSourcei64vDirectSOFT                  = REINTERPRET_CAST(LPALSOURCEI64VDIRECTSOFT             ,loader("alSourcei64vDirectSOFT"));
-    functions[0].alGetSourcei64DirectSOFT                = REINTERPRET_CAST(LPALGETSOURCEI64DIRECTSOFT           ,loader("alGetSourcei64DirectSOFT"));
-    functions[0].alGetSource3i64DirectSOFT               = REINTERPRET_CAST(LPALGETSOURCE3I64DIRECTSOFT          ,loader("alGetSource3i64DirectSOFT"));
-    functions[0].alGetSourcei64vDirectSOFT               = REINTERPRET_CAST(LPALGETSOURCEI64VDIRECTSOFT          ,loader("alGetSourcei64vDirectSOFT"));
-        /* AL_SOFT_deferred_updates */
-    functions[0].alDeferUpdatesDirectSOFT                = REINTERPRET_CAST(LPALDEFERUPDATESDIRECTSOFT           ,loader("alDeferUpdatesDirectSOFT"));
-    functions[0].alProcessUpdatesDirectSOFT              = REINTERPRET_CAST(LPALPROCESSUPDATESDIRECTSOFT         ,loader("alProcessUpdatesDirectSOFT"));
-        /* AL_SOFT_source_resampler */
-    functions[0].alGetStringiDirectSOFT                  = REINTERPRET_CAST(LPALGETSTRINGIDIRECTSOFT             ,loader("alGetStringiDirectSOFT"));
-        /* AL_SOFT_events */
-    functions[0].alEventControlDirectSOFT                = REINTERPRET_CAST(LPALEVENTCONTROLDIRECTSOFT           ,loader("alEventControlDirectSOFT"));
-    functions[0].alEventCallbackDirectSOFT               = REINTERPRET_CAST(LPALEVENTCALLBACKDIRECTSOFT          ,loader("alEventCallbackDirectSOFT"));
-    functions[0].alGetPointerDirectSOFT                  = REINTERPRET_CAST(LPALGETPOINTERDIRECTSOFT             ,loader("alGetPointerDirectSOFT"));
-    functions[0].alGetPointervDirectSOFT                 = REINTERPRET_CAST(LPALGETPOINTERVDIRECTSOFT            ,loader("alGetPointervDirectSOFT"));
-        /* AL_SOFT_callback_buffer */
-    functions[0].alBufferCallbackDirectSOFT              = REINTERPRET_CAST(LPALBUFFERCALLBACKDIRECTSOFT         ,loader("alBufferCallbackDirectSOFT"));
-    functions[0].alGetBufferPtrDirectSOFT                = REINTERPRET_CAST(LPALGETBUFFERPTRDIRECTSOFT           ,loader("alGetBufferPtrDirectSOFT"));
-    functions[0].alGetBuffer3PtrDirectSOFT               = REINTERPRET_CAST(LPALGETBUFFER3PTRDIRECTSOFT          ,loader("alGetBuffer3PtrDirectSOFT"));
-    functions[0].alGetBufferPtrvDirectSOFT               = REINTERPRET_CAST(LPALGETBUFFERPTRVDIRECTSOFT          ,loader("alGetBufferPtrvDirectSOFT"));
-        /* AL_SOFT_source_start_delay */
-    functions[0].alSourcePlayAtTimeDirectSOFT            = REINTERPRET_CAST(LPALSOURCEPLAYATTIMEDIRECTSOFT       ,loader("alSourcePlayAtTimeDirectSOFT"));
-    functions[0].alSourcePlayAtTimevDirectSOFT           = REINTERPRET_CAST(LPALSOURCEPLAYATTIMEVDIRECTSOFT      ,loader("alSourcePlayAtTimevDirectSOFT"));
-        /* EAX */
-    functions[0].EAXSetDirect                            = REINTERPRET_CAST(LPEAXSETDIRECT                       ,loader("EAXSetDirect"));
-    functions[0].EAXGetDirect                            = REINTERPRET_CAST(LPEAXGETDIRECT                       ,loader("EAXGetDirect"));
-    functions[0].EAXSetBufferModeDirect                  = REINTERPRET_CAST(LPEAXSETBUFFERMODEDIRECT             ,loader("EAXSetBufferModeDirect"));
-    functions[0].EAXGetBufferModeDirect                  = REINTERPRET_CAST(LPEAXGETBUFFERMODEDIRECT             ,loader("EAXGetBufferModeDirect"));
+
+void aladResolveTableEx(const aladTableEntry *table, size_t count, aladLoaderEx loader, void *user, void *dest) {
+    size_t i;
+    aladFunction function;
+    for (i = 0; i < count; i++) {
+        function = loader(user, table[i].name);
+        memcpy(REINTERPRET_CAST(char*, dest) + table[i].offset, &function, sizeof(function));
+    }
+}
+void aladResolveTable(const aladTableEntry *table, size_t count, aladLoader loader, void *dest) {
+    alad_plain_loader_ plain;
+    plain.loader = loader;
+    aladResolveTableEx(table, count, alad_call_plain_loader_, &plain, dest);
+}
+/* the tables are sorted by extension, so every group is a contiguous range */
+static const aladTableEntry* alad_find_extensions_(const aladTableEntry *table, size_t count, unsigned short first, unsigned short last, size_t *found) {
+    size_t begin, end;
+    for (begin = 0; begin < count && table[begin].extension < first; begin++);
+    for (end = begin; end < count && table[end].extension <= last; end++);
+    *found = end - begin;
+    return table + begin;
+}
+static void alad_resolve_extensions_(const aladTableEntry *table, size_t count, unsigned short first, unsigned short last, aladLoaderEx loader, void *user, void *dest) {
+    table = alad_find_extensions_(table, count, first, last, &count);
+    aladResolveTableEx(table, count, loader, user, dest);
+}
+
+void aladLoadALCoreMinimalEx(aladALFunctions* functions, aladLoaderEx loader, void *user) {
+    alad_resolve_extensions_(aladALTable, aladALTableSize, ALAD_AL_CORE_MINIMAL, ALAD_AL_CORE_MINIMAL, loader, user, functions);
+}
+void aladLoadALCoreRestEx(aladALFunctions* functions, aladLoaderEx loader, void *user) {
+    alad_resolve_extensions_(aladALTable, aladALTableSize, ALAD_AL_CORE_REST, ALAD_AL_CORE_REST, loader, user, functions);
+}
+void aladLoadEFXEx(aladALFunctions* functions, aladLoaderEx loader, void *user) {
+    alad_resolve_extensions_(aladALTable, aladALTableSize, ALAD_ALC_EXT_EFX, ALAD_ALC_EXT_EFX, loader, user, functions);
+}
+void aladLoadALExtensionsEx(aladALFunctions* functions, aladLoaderEx loader, void *user) {
+    alad_resolve_extensions_(aladALTable, aladALTableSize, ALAD_AL_EXT_STATIC_BUFFER, ALAD_AL_EXT_debug, loader, user, functions);
+}
+void aladLoadALCCoreEx(aladALCFunctions* functions, aladLoaderEx loader, void *user) {
+    alad_resolve_extensions_(aladALCTable, aladALCTableSize, ALAD_ALC_CORE, ALAD_ALC_CORE, loader, user, functions);
+}
+void aladLoadALCExtensionsEx(aladALCFunctions* functions, aladLoaderEx loader, void *user) {
+    alad_resolve_extensions_(aladALCTable, aladALCTableSize, ALAD_ALC_EXT_thread_local_context, ALAD_ALC_SOFT_system_events, loader, user, functions);
+}
+void aladLoadDirectExtensionEx(aladDirectFunctions* functions, aladLoaderEx loader, void *user) {
+    aladResolveTableEx(aladDirectTable, aladDirectTableSize, loader, user, functions);
+}
+
+#define ALAD_PLAIN_VIEW_(view, type)                                                    \
+    void view(type* functions, aladLoader loader) {                                     \
+        alad_plain_loader_ plain;                                                       \
+        plain.loader = loader;                                                          \
+        view##Ex(functions, alad_call_plain_loader_, &plain);                           \
+    }
+ALAD_PLAIN_VIEW_(aladLoadALCoreMinimal,   aladALFunctions)
+ALAD_PLAIN_VIEW_(aladLoadALCoreRest,      aladALFunctions)
+ALAD_PLAIN_VIEW_(aladLoadEFX,             aladALFunctions)
+ALAD_PLAIN_VIEW_(aladLoadALExtensions,    aladALFunctions)
+ALAD_PLAIN_VIEW_(aladLoadALCCore,         aladALCFunctions)
+ALAD_PLAIN_VIEW_(aladLoadALCExtensions,   aladALCFunctions)
+ALAD_PLAIN_VIEW_(aladLoadDirectExtension, aladDirectFunctions)
+
+void aladResolveExtensionsEx(const aladTableEntry *table, size_t count, aladExtensionMask mask, aladLoaderEx loader, void *user, void *dest) {
+    size_t i;
+    aladFunction function;
+    for (i = 0; i < count; i++) {
+        function = (mask & ALAD_EXTENSION_BIT(table[i].extension)) != 0 ? loader(user, table[i].name) : nullptr;
+        memcpy(REINTERPRET_CAST(char*, dest) + table[i].offset, &function, sizeof(function));
+    }
+}
+void aladResolveExtensions(const aladTableEntry *table, size_t count, aladExtensionMask mask, aladLoader loader, void *dest) {
+    alad_plain_loader_ plain;
+    plain.loader = loader;
+    aladResolveExtensionsEx(table, count, mask, alad_call_plain_loader_, &plain, dest);
+}
+
+/* indexed by aladExtension, the core groups have no name */
+static const char * const alad_extension_names_[ALAD_EXTENSION_COUNT] = {
+    nullptr,
+    nullptr,
+    nullptr,
+    "ALC_EXT_EFX",
+    "ALC_EXT_thread_local_context",
+    "ALC_SOFT_loopback",
+    "ALC_SOFT_pause_device",
+    "ALC_SOFT_HRTF",
+    "ALC_SOFT_device_clock",
+    "ALC_SOFT_reopen_device",
+    "ALC_SOFT_system_events",
+    "ALC_EXT_direct_context",
+    "AL_EXT_STATIC_BUFFER",
+    "AL_SOFT_buffer_sub_data",
+    "AL_EXT_FOLDBACK",
+    "AL_SOFT_buffer_samples",
+    "AL_SOFT_source_latency",
+    "AL_SOFT_deferred_updates",
+    "AL_SOFT_source_resampler",
+    "AL_SOFT_events",
+    "AL_SOFT_callback_buffer",
+    "AL_SOFT_source_start_delay",
+    "AL_EXT_debug"
+};
+/* perfect hash over the names above: 32 bit FNV-1a with the seed below instead of the usual offset basis, the top 5 bits select the slot.
+   The seed was searched offline so that no two names collide; if you add an extension, search a new one (and resize the table if needed). */
+#define ALAD_EXTENSION_HASH_SEED_ 0x672UL
+static const unsigned char alad_extension_slots_[32] = {
+    ALAD_ALC_SOFT_loopback,       0,                               ALAD_ALC_SOFT_system_events,       0,
+    ALAD_AL_EXT_FOLDBACK,         ALAD_AL_SOFT_buffer_samples,     0,                                 ALAD_AL_SOFT_source_start_delay,
+    ALAD_AL_SOFT_callback_buffer, ALAD_AL_SOFT_deferred_updates,   0,                                 0,
+    ALAD_AL_EXT_debug,            ALAD_ALC_SOFT_device_clock,      ALAD_ALC_SOFT_HRTF,                0,
+    0,                            ALAD_ALC_SOFT_pause_device,      ALAD_ALC_EXT_thread_local_context, ALAD_AL_SOFT_buffer_sub_data,
+    0,                            ALAD_AL_SOFT_events,             0,                                 ALAD_ALC_EXT_EFX,
+    0,                            ALAD_ALC_EXT_direct_context,     ALAD_AL_SOFT_source_resampler,     ALAD_ALC_SOFT_reopen_device,
+    ALAD_AL_SOFT_source_latency,  0,                               ALAD_AL_EXT_STATIC_BUFFER,         0
+};
+/* fails to compile if an extension was added without updating the hash table */
+typedef char alad_extension_slots_check_[ALAD_EXTENSION_COUNT == 23 ? 1 : -1];
+
+/* 0 is ALAD_AL_CORE_MINIMAL, which has no name, so it marks an empty slot */
+static aladExtension alad_hash_extension_name_(const char *name, size_t length) {
+    unsigned long hash = ALAD_EXTENSION_HASH_SEED_;
+    size_t i;
+    unsigned char extension;
+    for (i = 0; i < length; i++) hash = ((hash ^ REINTERPRET_CAST(const unsigned char*, name)[i]) * 16777619UL) & 0xFFFFFFFFUL;
+    extension = alad_extension_slots_[hash >> 27];
+    if (extension == 0 || strncmp(alad_extension_names_[extension], name, length) != 0 || alad_extension_names_[extension][length] != '\0') {
+        return ALAD_EXTENSION_COUNT;
+    }
+    return (aladExtension) extension;
+}
+aladExtension aladFindExtension(const char *name) {
+    if (name == nullptr) return ALAD_EXTENSION_COUNT;
+    return alad_hash_extension_name_(name, strlen(name));
+}
+aladExtensionMask aladParseExtensionString(const char *extensions) {
+    aladExtensionMask mask = 0;
+    size_t length;
+    if (extensions == nullptr) return 0;
+    while (*extensions != '\0') {
+        length = strcspn(extensions, " \t\n");
+        if (length > 0) {
+            aladExtension extension = alad_hash_extension_name_(extensions, length);
+            if (extension != ALAD_EXTENSION_COUNT) mask |= ALAD_EXTENSION_BIT(extension);
+        }
+        extensions += length;
+        if (*extensions != '\0') extensions++;
+    }
+    return mask;
 }
 
 
@@ -1232,6 +1703,83 @@ static void alad_close_ (alad_module_t_ module) {
         dlclose (module);
 }
 
+#if defined(ALAD_GNU_HASH_RESOLVER) && defined(__linux__)
+/* reads the symbol table of the loaded library directly, instead of taking the loader lock and walking all loaded objects for every dlsym */
+#include <link.h>
+#ifndef _GNU_SOURCE
+#error "ALAD_GNU_HASH_RESOLVER needs dlinfo, define _GNU_SOURCE before including any system header"
+#endif
+typedef struct alad_elf_symbols_ {
+    ElfW(Addr)              base;
+    const ElfW(Sym)        *symbols;
+    const char             *strings;
+    const ElfW(Versym)     *versions;
+    const ElfW(Addr)       *bloom;
+    const Elf32_Word       *buckets;
+    const Elf32_Word       *chain;
+    Elf32_Word              bucket_count;
+    Elf32_Word              symbol_offset;
+    Elf32_Word              bloom_size;
+    Elf32_Word              bloom_shift;
+} alad_elf_symbols_;
+/* glibc relocates the pointers in the dynamic section in place on most platforms, musl doesn't */
+static const void* alad_elf_pointer_ (ElfW(Addr) base, ElfW(Addr) value) {
+        return (const void*) (value < base ? base + value : value);
+}
+static int alad_elf_open_ (alad_module_t_ module, alad_elf_symbols_ *elf) {
+        struct link_map *map = nullptr;
+        const ElfW(Dyn) *dynamic;
+        const Elf32_Word *hash = nullptr;
+        memset (elf, 0, sizeof(*elf));
+        if (module == nullptr || dlinfo (module, RTLD_DI_LINKMAP, &map) != 0 || map == nullptr) return 0;
+        elf->base = map->l_addr;
+        for (dynamic = map->l_ld; dynamic->d_tag != DT_NULL; dynamic++) {
+                switch (dynamic->d_tag) {
+                case DT_SYMTAB:   elf->symbols  = REINTERPRET_CAST(const ElfW(Sym)*,    alad_elf_pointer_ (elf->base, dynamic->d_un.d_ptr)); break;
+                case DT_STRTAB:   elf->strings  = REINTERPRET_CAST(const char*,         alad_elf_pointer_ (elf->base, dynamic->d_un.d_ptr)); break;
+                case DT_VERSYM:   elf->versions = REINTERPRET_CAST(const ElfW(Versym)*, alad_elf_pointer_ (elf->base, dynamic->d_un.d_ptr)); break;
+                case DT_GNU_HASH: hash          = REINTERPRET_CAST(const Elf32_Word*,   alad_elf_pointer_ (elf->base, dynamic->d_un.d_ptr)); break;
+                default: break;
+                }
+        }
+        if (hash == nullptr || elf->symbols == nullptr || elf->strings == nullptr) return 0;
+        elf->bucket_count  = hash[0];
+        elf->symbol_offset = hash[1];
+        elf->bloom_size    = hash[2];
+        elf->bloom_shift   = hash[3];
+        elf->bloom         = REINTERPRET_CAST(const ElfW(Addr)*, (hash + 4));
+        elf->buckets       = REINTERPRET_CAST(const Elf32_Word*, (elf->bloom + elf->bloom_size));
+        elf->chain         = elf->buckets + elf->bucket_count;
+        return elf->bucket_count != 0 && elf->bloom_size != 0;
+}
+/* returns nullptr for anything that isn't a plain defined function (like IFUNCs), so that dlsym can handle it */
+static aladFunction alad_elf_lookup_ (const alad_elf_symbols_ *elf, const char *name) {
+        const unsigned int bits = sizeof(ElfW(Addr)) * 8;
+        const unsigned char *c;
+        const ElfW(Sym) *symbol;
+        Elf32_Word hash = 5381, chained, index;
+        ElfW(Addr) mask;
+        for (c = REINTERPRET_CAST(const unsigned char*, name); *c != 0; c++) hash = hash * 33 + *c;
+        mask = ((ElfW(Addr)) 1 << (hash % bits)) | ((ElfW(Addr)) 1 << ((hash >> elf->bloom_shift) % bits));
+        if ((elf->bloom[(hash / bits) % elf->bloom_size] & mask) != mask) return nullptr;
+        index = elf->buckets[hash % elf->bucket_count];
+        if (index < elf->symbol_offset) return nullptr;
+        do {
+                chained = elf->chain[index - elf->symbol_offset];
+                symbol = elf->symbols + index;
+                if ((hash | 1) == (chained | 1) && strcmp (name, elf->strings + symbol->st_name) == 0) {
+                        /* ELF32_ST_TYPE and ELF64_ST_TYPE are the same */
+                        if (symbol->st_shndx == SHN_UNDEF || ELF32_ST_TYPE(symbol->st_info) != STT_FUNC) return nullptr;
+                        /* the high bit of the version index marks hidden, non-default versions */
+                        if (elf->versions != nullptr && (elf->versions[index] & 0x8000) != 0) return nullptr;
+                        return REINTERPRET_CAST(aladFunction, (elf->base + symbol->st_value));
+                }
+                index++;
+        } while ((chained & 1) == 0);
+        return nullptr;
+}
+#endif /* ALAD_GNU_HASH_RESOLVER */
+
 /* there are also libopenal.so.1.[X].[Y] and libopenal.1.[X].[Y].dylib respectively, but it would be difficult to look all of those up */
 #if defined(__APPLE__)
 /* not tested myself; the only references I could find are https://github.com/ToweOPrO/sadsad and https://pastebin.com/MEmh3ZFr, which is at least tenuous */
@@ -1249,65 +1797,831 @@ static alad_module_t_ alad_module_ = nullptr;
 aladFunction alad_load_global_ (const char* name) {
     return alad_load_ (alad_module_, name);
 }
-ALCdevice * aladBakedDevice_;
-aladFunction alad_load_alc_with_baked_device_ (const char* name) {
-    return ((ALAD_ISO_C_COMPAT_LPALCGETPROCADDRESS_) aladALC.GetProcAddress) (aladBakedDevice_, name);
+/* aladLoaderEx adapters */
+static ALAD_ISO_C_COMPAT_LPALCGETPROCADDRESS_ alad_get_proc_address2_ = nullptr;
+aladFunction aladALCDeviceLoader (void *device, const char *name) {
+    if (aladALC.GetProcAddress == nullptr) return nullptr;
+    return ((ALAD_ISO_C_COMPAT_LPALCGETPROCADDRESS_) aladALC.GetProcAddress) (REINTERPRET_CAST(ALCdevice*, device), name);
+}
+aladFunction aladDirectDeviceLoader (void *device, const char *name) {
+    if (alad_get_proc_address2_ == nullptr) return nullptr;
+    return alad_get_proc_address2_ (REINTERPRET_CAST(ALCdevice*, device), name);
+}
+/* resolves a batch of table entries directly from the shared library */
+static void alad_load_module_table_ (const aladTableEntry *table, size_t count, void *dest) {
+#if defined(ALAD_GNU_HASH_RESOLVER) && defined(__linux__)
+    alad_elf_symbols_ elf;
+    int valid;
+    size_t i;
+    aladFunction function;
+    valid = alad_elf_open_ (alad_module_, &elf);
+    for (i = 0; i < count; i++) {
+        function = valid ? alad_elf_lookup_ (&elf, table[i].name) : nullptr;
+        if (function == nullptr) function = alad_load_ (alad_module_, table[i].name);
+        memcpy(REINTERPRET_CAST(char*, dest) + table[i].offset, &function, sizeof(function));
+    }
+#else
+    aladResolveTable(table, count, alad_load_global_, dest);
+#endif
+}
+static void alad_load_module_extensions_ (const aladTableEntry *table, size_t count, unsigned short first, unsigned short last, void *dest) {
+    table = alad_find_extensions_(table, count, first, last, &count);
+    alad_load_module_table_(table, count, dest);
 }
+/* the library is opened once, even if several threads get here at the same time; a failed attempt is tried again next time */
+static volatile long alad_library_loaded_ = 0;
+static volatile long alad_library_lock_ = 0;
 void alad_load_lib_(void) {
-    if(alad_module_ != nullptr) return;
-    alad_module_ = alad_open_ (alad_LIB_NAME_);
+    if (alad_atomic_load_long_(&alad_library_loaded_) != 0) return;
+    alad_spin_lock_(&alad_library_lock_);
     if (alad_module_ == nullptr) {
-        alad_module_ = alad_open_ (alad_SECONDARY_LIB_NAME_);
+        alad_module_ = alad_open_ (alad_LIB_NAME_);
+        if (alad_module_ == nullptr) {
+            alad_module_ = alad_open_ (alad_SECONDARY_LIB_NAME_);
+        }
     }
-    if (alad_module_ == nullptr) return;
+    if (alad_module_ != nullptr) alad_atomic_store_long_(&alad_library_loaded_, 1);
+    alad_spin_unlock_(&alad_library_lock_);
 }
 
+/* extensions of the current context and its device, as read by aladUpdateAL, and those listed for the NULL device */
+static aladExtensionMask alad_extensions_ = 0;
+static aladExtensionMask alad_null_device_extensions_ = 0;
+static ALCdevice *alad_extensions_device_ = nullptr;
+#ifdef ALAD_LAZY_LOADING
+/*  Lazy loading facilities:
+ *  Every slot of aladAL and aladALC starts out pointing at a trampoline generated from the function lists above, which resolves the real
+ *  symbol with the same loader the eager path would use, patches the slot and then tail-calls it. The slot patched is the one in the table
+ *  the trampoline was installed in, not the active table, which may be a utility layer or a context's table by then, and only while it still
+ *  holds the trampoline. A copy of a table made before its trampolines ran keeps calling them; they take the function from the slot they
+ *  were installed in once that is resolved, and only resolve it themselves before that. aladResolveAll resolves them all ahead of such copies.
+ *  Concurrent first calls are harmless, since every thread stores the same pointer. If the symbol can't be resolved, the slot is set to NULL
+ *  and the trampoline returns 0 without calling anything.
+ *  The core functions come from the shared library and the AL extensions from the alGetProcAddress of the table the trampoline was installed
+ *  in. The ALC extensions are resolved for the device they are called with: the slot is only patched for the device of the last aladUpdateAL
+ *  (or for functions without a device); a call for another device goes through that device's table in the registry, or looks the function
+ *  up with alcGetProcAddress for that device on every call as long as it isn't registered.
+ *  The calling conventions AL_APIENTRY and ALC_APIENTRY are defined identically by the OpenAL headers, so the ALC trampolines use the former as well.
+ */
+static aladALFunctions  *alad_lazy_target_AL_  = nullptr;
+static aladALCFunctions *alad_lazy_target_ALC_ = nullptr;
+static aladFunction alad_lazy_slot_ (void *table, size_t offset) {
+    aladFunction function;
+    memcpy(&function, REINTERPRET_CAST(char*, table) + offset, sizeof(function));
+    return function;
+}
+static void alad_lazy_patch_ (void *table, size_t offset, aladFunction trampoline, aladFunction function) {
+    if (table != nullptr && alad_lazy_slot_(table, offset) == trampoline) memcpy(REINTERPRET_CAST(char*, table) + offset, &function, sizeof(function));
+}
+static int alad_lazy_is_core_ (unsigned short extension) {
+    return (ALAD_CORE_EXTENSIONS & ALAD_EXTENSION_BIT(extension)) != 0;
+}
+static aladFunction alad_lazy_resolve_AL_ (aladALFunctions *table, const char *name, unsigned short extension) {
+    if (alad_lazy_is_core_(extension)) return alad_load_global_(name);
+    if (table == nullptr || table->GetProcAddress == nullptr) return nullptr;
+    return ((aladLoader) table->GetProcAddress)(name);
+}
+static aladFunction alad_lazy_resolve_ALC_ (ALCdevice *device, const char *name, unsigned short extension) {
+    if (alad_lazy_is_core_(extension)) return alad_load_global_(name);
+    return aladALCDeviceLoader(device, name);
+}
+static aladFunction alad_lazy_AL_ (const char *name, unsigned short extension, size_t offset, aladFunction trampoline) {
+    aladALFunctions *table = alad_lazy_target_AL_;
+    aladFunction function;
+    if (table == nullptr || (function = alad_lazy_slot_(table, offset)) == trampoline) {
+        function = alad_lazy_resolve_AL_(table, name, extension);
+        alad_lazy_patch_(table, offset, trampoline, function);
+    }
+#ifndef ALAD_THREAD_SAFE
+    /* aladAL holds a copy of the table, which takes the function over as well */
+    if (table != nullptr && aladActiveAL == table) alad_lazy_patch_(&aladAL, offset, trampoline, function);
+#endif
+    return function;
+}
+static aladFunction alad_lazy_ALC_ (const char *name, unsigned short extension, size_t offset, aladFunction trampoline, ALCdevice *device) {
+    aladALCFunctions *table = alad_lazy_target_ALC_, *registered;
+    aladFunction function;
+    if (table != nullptr && (function = alad_lazy_slot_(table, offset)) != trampoline) return function;
+    if (device != nullptr && device != alad_extensions_device_ && !alad_lazy_is_core_(extension)) {
+        registered = aladGetDeviceFunctions(device);
+        return registered != nullptr ? alad_lazy_slot_(registered, offset) : aladALCDeviceLoader(device, name);
+    }
+    function = alad_lazy_resolve_ALC_(alad_extensions_device_, name, extension);
+    alad_lazy_patch_(table, offset, trampoline, function);
+    return function;
+}
+
+#define ALAD_LAZY_AL_STUB_(ret, member, type, name, extension, params, args)                                                    \
+    static ret AL_APIENTRY alad_lazy_AL_##member##_ params ALAD_NOEXCEPT_ {                                                     \
+        type function = REINTERPRET_CAST(type, alad_lazy_AL_(name, extension, offsetof(aladALFunctions, member),               \
+                                                             REINTERPRET_CAST(aladFunction, alad_lazy_AL_##member##_)));       \
+        if (function == nullptr) return (ret) 0;                                                                                \
+        return function args;                                                                                                   \
+    }
+#define ALAD_LAZY_AL_STUB_VOID_(member, type, name, extension, params, args)                                                    \
+    static void AL_APIENTRY alad_lazy_AL_##member##_ params ALAD_NOEXCEPT_ {                                                    \
+        type function = REINTERPRET_CAST(type, alad_lazy_AL_(name, extension, offsetof(aladALFunctions, member),               \
+                                                             REINTERPRET_CAST(aladFunction, alad_lazy_AL_##member##_)));       \
+        if (function != nullptr) function args;                                                                                 \
+    }
+#define ALAD_LAZY_ALC_STUB_(ret, member, type, name, extension, device, params, args)                                           \
+    static ret AL_APIENTRY alad_lazy_ALC_##member##_ params ALAD_NOEXCEPT_ {                                                    \
+        type function = REINTERPRET_CAST(type, alad_lazy_ALC_(name, extension, offsetof(aladALCFunctions, member),             \
+                                                              REINTERPRET_CAST(aladFunction, alad_lazy_ALC_##member##_), device)); \
+        if (function == nullptr) return (ret) 0;                                                                                \
+        return function args;                                                                                                   \
+    }
+#define ALAD_LAZY_ALC_STUB_VOID_(member, type, name, extension, device, params, args)                                           \
+    static void AL_APIENTRY alad_lazy_ALC_##member##_ params ALAD_NOEXCEPT_ {                                                   \
+        type function = REINTERPRET_CAST(type, alad_lazy_ALC_(name, extension, offsetof(aladALCFunctions, member),             \
+                                                              REINTERPRET_CAST(aladFunction, alad_lazy_ALC_##member##_), device)); \
+        if (function != nullptr) function args;                                                                                 \
+    }
+ALAD_AL_FUNCTIONS_(ALAD_LAZY_AL_STUB_, ALAD_LAZY_AL_STUB_VOID_)
+ALAD_ALC_FUNCTIONS_(ALAD_LAZY_ALC_STUB_, ALAD_LAZY_ALC_STUB_VOID_)
+
+/* the trampolines in the order of aladALTable and aladALCTable */
+#define ALAD_LAZY_AL_TRAMPOLINE_(ret, member, type, name, extension, params, args)               REINTERPRET_CAST(aladFunction, alad_lazy_AL_##member##_),
+#define ALAD_LAZY_AL_TRAMPOLINE_VOID_(member, type, name, extension, params, args)               REINTERPRET_CAST(aladFunction, alad_lazy_AL_##member##_),
+#define ALAD_LAZY_ALC_TRAMPOLINE_(ret, member, type, name, extension, device, params, args)      REINTERPRET_CAST(aladFunction, alad_lazy_ALC_##member##_),
+#define ALAD_LAZY_ALC_TRAMPOLINE_VOID_(member, type, name, extension, device, params, args)      REINTERPRET_CAST(aladFunction, alad_lazy_ALC_##member##_),
+static const aladFunction alad_lazy_AL_trampolines_[] = {
+    ALAD_AL_FUNCTIONS_(ALAD_LAZY_AL_TRAMPOLINE_, ALAD_LAZY_AL_TRAMPOLINE_VOID_)
+};
+static const aladFunction alad_lazy_ALC_trampolines_[] = {
+    ALAD_ALC_FUNCTIONS_(ALAD_LAZY_ALC_TRAMPOLINE_, ALAD_LAZY_ALC_TRAMPOLINE_VOID_)
+};
+
+/* the trampolines go into the tables that aladLoadAL and aladUpdateAL are building, which need not be the active ones yet; only the
+   functions of the extensions in the mask are touched */
+static void alad_lazy_install_ (aladALFunctions *al, aladALCFunctions *alc, aladExtensionMask mask) {
+    size_t i;
+    alad_lazy_target_AL_ = al;
+    alad_lazy_target_ALC_ = alc;
+    for (i = 0; i < aladALTableSize; i++) {
+        if ((mask & ALAD_EXTENSION_BIT(aladALTable[i].extension)) != 0) memcpy(REINTERPRET_CAST(char*, al) + aladALTable[i].offset, &alad_lazy_AL_trampolines_[i], sizeof(aladFunction));
+    }
+    for (i = 0; i < aladALCTableSize; i++) {
+        if ((mask & ALAD_EXTENSION_BIT(aladALCTable[i].extension)) != 0) memcpy(REINTERPRET_CAST(char*, alc) + aladALCTable[i].offset, &alad_lazy_ALC_trampolines_[i], sizeof(aladFunction));
+    }
+}
+static void alad_lazy_resolve_ (aladALFunctions *al, aladALCFunctions *alc, aladExtensionMask mask) {
+    size_t i;
+    for (i = 0; i < aladALTableSize; i++) {
+        if ((mask & ALAD_EXTENSION_BIT(aladALTable[i].extension)) == 0 || alad_lazy_slot_(al, aladALTable[i].offset) != alad_lazy_AL_trampolines_[i]) continue;
+        alad_lazy_patch_(al, aladALTable[i].offset, alad_lazy_AL_trampolines_[i], alad_lazy_resolve_AL_(al, aladALTable[i].name, aladALTable[i].extension));
+    }
+    for (i = 0; i < aladALCTableSize; i++) {
+        if ((mask & ALAD_EXTENSION_BIT(aladALCTable[i].extension)) == 0 || alad_lazy_slot_(alc, aladALCTable[i].offset) != alad_lazy_ALC_trampolines_[i]) continue;
+        alad_lazy_patch_(alc, aladALCTable[i].offset, alad_lazy_ALC_trampolines_[i], alad_lazy_resolve_ALC_(alad_extensions_device_, aladALCTable[i].name, aladALCTable[i].extension));
+    }
+}
+#endif /* ALAD_LAZY_LOADING */
+
+
+static aladExtensionMask alad_parse_device_extensions_ (ALCdevice *device) {
+    if (aladALC.GetString == nullptr) return 0;
+    return aladParseExtensionString(aladALC.GetString(device, ALC_EXTENSIONS));
+}
+/* everything available with the current context on the given device; some ALC extensions are only listed for the NULL device */
+static aladExtensionMask alad_probe_extensions_ (ALCdevice *device) {
+    aladExtensionMask mask = ALAD_CORE_EXTENSIONS | alad_parse_device_extensions_(nullptr);
+    if (aladAL.GetString != nullptr) mask |= aladParseExtensionString(aladAL.GetString(AL_EXTENSIONS));
+    if (device != nullptr) mask |= alad_parse_device_extensions_(device);
+    return mask;
+}
+#ifdef ALAD_LAZY_LOADING
+/* the trampolines are installed unconditionally, so those of absent extensions are overwritten afterwards */
+static void alad_clear_absent_ (const aladTableEntry *table, size_t count, aladExtensionMask mask, void *dest) {
+    size_t i;
+    aladFunction function = nullptr;
+    for (i = 0; i < count; i++) {
+        if ((mask & ALAD_EXTENSION_BIT(table[i].extension)) == 0) memcpy(REINTERPRET_CAST(char*, dest) + table[i].offset, &function, sizeof(function));
+    }
+}
+#endif
+aladExtensionMask aladGetExtensions () {
+    return alad_extensions_;
+}
+ALboolean aladHasALExtension (aladExtension extension) {
+    if (extension >= ALAD_EXTENSION_COUNT) return AL_FALSE;
+    return (alad_extensions_ & ALAD_EXTENSION_BIT(extension)) != 0 ? AL_TRUE : AL_FALSE;
+}
+/* other devices than the one of the last aladUpdateAL are looked up in the device registry below */
+static aladExtensionMask alad_registered_extensions_ (ALCdevice *device);
+ALCboolean aladHasALCExtension (ALCdevice *device, aladExtension extension) {
+    aladExtensionMask mask;
+    if (extension >= ALAD_EXTENSION_COUNT) return ALC_FALSE;
+    if (device == nullptr) mask = alad_null_device_extensions_;
+    else if (device == alad_extensions_device_) mask = alad_extensions_;
+    else mask = alad_registered_extensions_(device);
+    return (mask & ALAD_EXTENSION_BIT(extension)) != 0 ? ALC_TRUE : ALC_FALSE;
+}
+
+
+/* per-context cache, a context's slot is free again once its context is NULL; it is only changed under alad_update_lock_, which
+   aladLoadAL and aladUpdateAL hold while they replace the tables the entries are derived from. A table that was handed out is never
+   written again and stays where it is until its context is invalidated (or aladTerminate), an update only gives the context a new one. */
+#ifndef ALAD_CONTEXT_CACHE_SIZE
+#define ALAD_CONTEXT_CACHE_SIZE 8
+#endif
+typedef struct alad_context_table_ {
+    struct alad_context_table_ *next;
+    aladALFunctions functions;
+} alad_context_table_;
+typedef struct alad_context_entry_ {
+    ALCcontext          *context;
+    alad_context_table_ *tables;    /* every table of the context, newest first */
+    aladALFunctions     *functions; /* the newest one, or NULL once an update left it behind */
+} alad_context_entry_;
+static alad_context_entry_ alad_context_cache_[ALAD_CONTEXT_CACHE_SIZE];
+static volatile long alad_update_lock_ = 0;
+
+static void alad_free_context_tables_ (alad_context_entry_ *entry) {
+    while (entry->tables != nullptr) {
+        alad_context_table_ *next = entry->tables->next;
+        free(entry->tables);
+        entry->tables = next;
+    }
+    entry->functions = nullptr;
+    entry->context = nullptr;
+}
+/* the core functions don't depend on the context, so they are taken over from the table of the simplified interface (the active
+   table may be another context's or a utility layer's, whose state isn't per context), and only the extensions the context has are
+   resolved. The context is made current for that on this thread only if the driver has ALC_EXT_thread_local_context, and globally
+   otherwise; either way, the previous one is restored afterwards. */
+static aladALFunctions* alad_derive_context_functions_ (alad_context_entry_ *entry, ALCcontext *context, aladALFunctions *al, aladALCFunctions *alc) {
+    alad_context_table_ *block;
+    ALCcontext *oldContext = nullptr;
+    ALCboolean threadLocal = ALC_FALSE;
+    const aladTableEntry *table;
+    size_t count;
+    if (al->GetProcAddress == nullptr) return nullptr;
+    block = REINTERPRET_CAST(alad_context_table_*, malloc(sizeof(alad_context_table_)));
+    if (block == nullptr) return nullptr;
+    if (alc->GetThreadContext != nullptr && alc->SetThreadContext != nullptr) {
+        oldContext = alc->GetThreadContext();
+        threadLocal = oldContext == context || alc->SetThreadContext(context) != ALC_FALSE ? ALC_TRUE : ALC_FALSE;
+    }
+    if (!threadLocal) {
+        oldContext = alc->GetCurrentContext != nullptr && alc->MakeContextCurrent != nullptr ? alc->GetCurrentContext() : nullptr;
+        if (alc->MakeContextCurrent == nullptr || (oldContext != context && alc->MakeContextCurrent(context) == ALC_FALSE)) {
+            free(block);
+            return nullptr;
+        }
+    }
+    block->functions = *al;
+    table = alad_find_extensions_(aladALTable, aladALTableSize, ALAD_ALC_EXT_EFX, ALAD_AL_EXT_debug, &count);
+    aladResolveExtensions(table, count, alad_probe_extensions_(alc->GetContextsDevice(context)), (aladLoader) block->functions.GetProcAddress, &block->functions);
+    if (oldContext != context) {
+        if (threadLocal) alc->SetThreadContext(oldContext);
+        else alc->MakeContextCurrent(oldContext);
+    }
+    /* a table that came out the same as the context's last one isn't kept, so updates that change nothing don't add up */
+    if (entry->tables != nullptr && memcmp(&entry->tables->functions, &block->functions, sizeof(aladALFunctions)) == 0) {
+        free(block);
+        entry->functions = &entry->tables->functions;
+        return entry->functions;
+    }
+    block->next = entry->tables;
+    entry->tables = block;
+    entry->functions = &block->functions;
+    entry->context = context;
+    return entry->functions;
+}
+static aladALFunctions* alad_fetch_context_functions_ (ALCcontext *context) {
+    alad_context_entry_ *entry = nullptr;
+    size_t i;
+    for (i = 0; i < ALAD_CONTEXT_CACHE_SIZE; i++) {
+        if (alad_context_cache_[i].context == context) {
+            entry = &alad_context_cache_[i];
+            break;
+        }
+        if (entry == nullptr && alad_context_cache_[i].context == nullptr) entry = &alad_context_cache_[i];
+    }
+    if (entry == nullptr) return nullptr;
+    if (entry->context == context && entry->functions != nullptr) return entry->functions;
+    return alad_derive_context_functions_(entry, context, alad_main_al_, aladActiveALC);
+}
+aladALFunctions* aladFetchContextFunctions (ALCcontext *context) {
+    aladALFunctions *functions;
+    if (context == nullptr) return nullptr;
+    alad_spin_lock_(&alad_update_lock_);
+    functions = alad_fetch_context_functions_(context);
+    alad_spin_unlock_(&alad_update_lock_);
+    return functions;
+}
+/* only swaps the table, making the context current is still up to you; NULL switches back to the table of the simplified interface */
+ALCboolean aladActivateContextFunctions (ALCcontext *context) {
+    aladALFunctions *functions;
+    alad_spin_lock_(&alad_update_lock_);
+    functions = context != nullptr ? alad_fetch_context_functions_(context) : alad_main_al_;
+    if (functions != nullptr) alad_activate_(functions);
+    alad_spin_unlock_(&alad_update_lock_);
+    return functions != nullptr ? ALC_TRUE : ALC_FALSE;
+}
+void aladActivateFunctions (aladALFunctions *functions) {
+    alad_spin_lock_(&alad_update_lock_);
+    alad_activate_(functions != nullptr ? functions : alad_main_al_);
+    alad_spin_unlock_(&alad_update_lock_);
+}
+void aladInvalidateContextFunctions (ALCcontext *context) {
+    alad_context_table_ *block;
+    size_t i;
+    if (context == nullptr) return;
+    alad_spin_lock_(&alad_update_lock_);
+    for (i = 0; i < ALAD_CONTEXT_CACHE_SIZE; i++) {
+        if (alad_context_cache_[i].context != context) continue;
+        for (block = alad_context_cache_[i].tables; block != nullptr; block = block->next) {
+            if (aladActiveAL == &block->functions) alad_activate_(alad_main_al_);
+        }
+        alad_free_context_tables_(&alad_context_cache_[i]);
+    }
+    alad_spin_unlock_(&alad_update_lock_);
+}
+
+/* frame scopes: one nesting depth per context, and how its updates were deferred, so that the outermost end undoes it the same way.
+   The lock is held over the driver calls, so a frame that ends can't apply the updates of one that begins on another thread. */
+#ifndef ALAD_FRAME_CONTEXTS
+#define ALAD_FRAME_CONTEXTS 8
+#endif
+typedef struct alad_frame_entry_ {
+    ALCcontext  *context;
+    long         depth;
+    ALboolean    suspended;
+} alad_frame_entry_;
+static alad_frame_entry_ alad_frames_[ALAD_FRAME_CONTEXTS];
+static volatile long alad_frame_lock_ = 0;
+
+ALCcontext* aladBeginFrame (ALCcontext *context) {
+    alad_frame_entry_ *entry = nullptr;
+    ALCcontext *current;
+    size_t i;
+    if (aladALC.GetCurrentContext == nullptr) return nullptr;
+    current = aladALC.GetCurrentContext();
+    if (context == nullptr) context = current;
+    if (context == nullptr) return nullptr;
+    alad_spin_lock_(&alad_frame_lock_);
+    for (i = 0; i < ALAD_FRAME_CONTEXTS; i++) {
+        if (alad_frames_[i].context == context) {
+            entry = &alad_frames_[i];
+            break;
+        }
+        if (entry == nullptr && alad_frames_[i].context == nullptr) entry = &alad_frames_[i];
+    }
+    if (entry == nullptr) {
+        alad_spin_unlock_(&alad_frame_lock_);
+        return nullptr;
+    }
+    if (entry->context != context) {
+        /* alDeferUpdatesSOFT only reaches the current context, alcSuspendContext defers the updates of any context with OpenAL Soft */
+        entry->suspended = context != current || aladAL.DeferUpdatesSOFT == nullptr || aladAL.ProcessUpdatesSOFT == nullptr ? AL_TRUE : AL_FALSE;
+        if (entry->suspended) {
+            if (aladALC.SuspendContext != nullptr) aladALC.SuspendContext(context);
+        } else {
+            aladAL.DeferUpdatesSOFT();
+        }
+        entry->context = context;
+        entry->depth = 0;
+    }
+    entry->depth++;
+    alad_spin_unlock_(&alad_frame_lock_);
+    return context;
+}
+/* alProcessUpdatesSOFT only reaches the current context, which may have changed since the frame began, so the frame's context is made
+   current for it and the previous one restored. If that doesn't take (a thread context set with alcSetThreadContext wins), alcProcessContext is left */
+static void alad_process_frame_ (ALCcontext *context) {
+    ALCcontext *current = aladALC.GetCurrentContext != nullptr ? aladALC.GetCurrentContext() : nullptr;
+    if (current == context) {
+        aladAL.ProcessUpdatesSOFT();
+        return;
+    }
+    if (aladALC.MakeContextCurrent != nullptr && aladALC.MakeContextCurrent(context) && aladALC.GetCurrentContext() == context) {
+        aladAL.ProcessUpdatesSOFT();
+        aladALC.MakeContextCurrent(current);
+        return;
+    }
+    if (aladALC.ProcessContext != nullptr) aladALC.ProcessContext(context);
+}
+void aladEndFrame (ALCcontext *context) {
+    size_t i;
+    if (context == nullptr) return;
+    alad_spin_lock_(&alad_frame_lock_);
+    for (i = 0; i < ALAD_FRAME_CONTEXTS; i++) {
+        if (alad_frames_[i].context != context) continue;
+        if (--alad_frames_[i].depth == 0) {
+            if (alad_frames_[i].suspended) {
+                if (aladALC.ProcessContext != nullptr) aladALC.ProcessContext(context);
+            } else if (aladAL.ProcessUpdatesSOFT != nullptr) {
+                alad_process_frame_(context);
+            }
+            alad_frames_[i].context = nullptr;
+        }
+        break;
+    }
+    alad_spin_unlock_(&alad_frame_lock_);
+}
+/* drops the frame of a destroyed context without touching the driver */
+static void alad_forget_frame_ (ALCcontext *context) {
+    size_t i;
+    alad_spin_lock_(&alad_frame_lock_);
+    for (i = 0; i < ALAD_FRAME_CONTEXTS; i++) {
+        if (alad_frames_[i].context == context) alad_frames_[i].context = nullptr;
+    }
+    alad_spin_unlock_(&alad_frame_lock_);
+}
+
+/* per-device registry: open addressing with linear probing, removed devices leave a tombstone so that the probe chains stay intact.
+   Each device gets a block of its own, which is filled before its slot is pointed at it and never written after that, so readers only
+   do atomic loads. Writers serialize on a spinlock. A removed device's block is kept until aladTerminate, so whoever still holds its
+   table doesn't see it change when the slot is taken by another device. */
+#ifndef ALAD_DEVICE_REGISTRY_SIZE
+#define ALAD_DEVICE_REGISTRY_SIZE 16
+#endif
+typedef char alad_device_registry_size_check_[(ALAD_DEVICE_REGISTRY_SIZE & (ALAD_DEVICE_REGISTRY_SIZE - 1)) == 0 ? 1 : -1];
+typedef struct alad_device_entry_ {
+    struct alad_device_entry_ *next; /* the removed ones, for aladTerminate */
+    ALCdevice                 *device;
+    aladExtensionMask          extensions;
+    aladALCFunctions           functions;
+} alad_device_entry_;
+static void * volatile alad_device_registry_[ALAD_DEVICE_REGISTRY_SIZE];
+static alad_device_entry_ *alad_removed_devices_ = nullptr;
+static volatile long alad_device_registry_lock_ = 0;
+static char alad_device_tombstone_;
+
+static void alad_apply_hooks_ (aladALCFunctions *functions);
+static size_t alad_device_slot_ (ALCdevice *device) {
+    size_t hash = REINTERPRET_CAST(size_t, device);
+    hash ^= hash >> 4;
+    hash *= 0x9E3779B1UL;
+    hash ^= hash >> 16;
+    return hash & (ALAD_DEVICE_REGISTRY_SIZE - 1);
+}
+static void alad_resolve_device_functions_ (ALCdevice *device, alad_device_entry_ *entry) {
+    const aladTableEntry *table;
+    size_t count;
+    entry->next = nullptr;
+    entry->device = device;
+    entry->extensions = ALAD_CORE_EXTENSIONS | alad_parse_device_extensions_(nullptr) | alad_parse_device_extensions_(device);
+    entry->functions.GetProcAddress = aladALC.GetProcAddress;
+    table = alad_find_extensions_(aladALCTable, aladALCTableSize, ALAD_ALC_CORE, ALAD_ALC_SOFT_system_events, &count);
+    aladResolveExtensionsEx(table, count, entry->extensions, aladALCDeviceLoader, device, &entry->functions);
+    alad_apply_hooks_(&entry->functions);
+}
+static alad_device_entry_* alad_find_device_ (ALCdevice *device) {
+    size_t i, slot;
+    void *key;
+    if (device == nullptr) return nullptr;
+    slot = alad_device_slot_(device);
+    for (i = 0; i < ALAD_DEVICE_REGISTRY_SIZE; i++, slot = (slot + 1) & (ALAD_DEVICE_REGISTRY_SIZE - 1)) {
+        key = alad_atomic_load_ptr_(&alad_device_registry_[slot]);
+        if (key == nullptr) return nullptr;
+        if (key != &alad_device_tombstone_ && REINTERPRET_CAST(alad_device_entry_*, key)->device == device) return REINTERPRET_CAST(alad_device_entry_*, key);
+    }
+    return nullptr;
+}
+
+aladALCFunctions* aladGetDeviceFunctions (ALCdevice *device) {
+    alad_device_entry_ *entry = alad_find_device_(device);
+    return entry != nullptr ? &entry->functions : nullptr;
+}
+/* only looks the device up, registering it is up to aladRegisterDevice; an unregistered device's extension string is parsed every time */
+static aladExtensionMask alad_registered_extensions_ (ALCdevice *device) {
+    alad_device_entry_ *entry = alad_find_device_(device);
+    return entry != nullptr ? entry->extensions : alad_null_device_extensions_ | alad_parse_device_extensions_(device);
+}
+aladALCFunctions* aladRegisterDevice (ALCdevice *device) {
+    alad_device_entry_ *entry;
+    void * volatile *free_slot = nullptr;
+    size_t i, slot;
+    void *key;
+    aladALCFunctions *functions = aladGetDeviceFunctions(device);
+    if (functions != nullptr || device == nullptr || aladALC.GetProcAddress == nullptr) return functions;
+    alad_spin_lock_(&alad_device_registry_lock_);
+    slot = alad_device_slot_(device);
+    for (i = 0; i < ALAD_DEVICE_REGISTRY_SIZE; i++, slot = (slot + 1) & (ALAD_DEVICE_REGISTRY_SIZE - 1)) {
+        key = alad_device_registry_[slot];
+        if (key != nullptr && key != &alad_device_tombstone_ && REINTERPRET_CAST(alad_device_entry_*, key)->device == device) {
+            functions = &REINTERPRET_CAST(alad_device_entry_*, key)->functions;
+            break;
+        }
+        if (free_slot == nullptr && (key == nullptr || key == &alad_device_tombstone_)) free_slot = &alad_device_registry_[slot];
+        if (key == nullptr) break;
+    }
+    if (functions == nullptr && free_slot != nullptr) {
+        entry = REINTERPRET_CAST(alad_device_entry_*, malloc(sizeof(alad_device_entry_)));
+        if (entry != nullptr) {
+            alad_resolve_device_functions_(device, entry);
+            alad_atomic_store_ptr_(free_slot, entry);
+            functions = &entry->functions;
+        }
+    }
+    alad_spin_unlock_(&alad_device_registry_lock_);
+    return functions;
+}
+void aladUnregisterDevice (ALCdevice *device) {
+    alad_device_entry_ *entry;
+    size_t i, slot;
+    void *key;
+    if (device == nullptr) return;
+    alad_spin_lock_(&alad_device_registry_lock_);
+    slot = alad_device_slot_(device);
+    for (i = 0; i < ALAD_DEVICE_REGISTRY_SIZE; i++, slot = (slot + 1) & (ALAD_DEVICE_REGISTRY_SIZE - 1)) {
+        key = alad_device_registry_[slot];
+        if (key == nullptr) break;
+        if (key != &alad_device_tombstone_ && REINTERPRET_CAST(alad_device_entry_*, key)->device == device) {
+            entry = REINTERPRET_CAST(alad_device_entry_*, key);
+            alad_atomic_store_ptr_(&alad_device_registry_[slot], &alad_device_tombstone_);
+            entry->next = alad_removed_devices_;
+            alad_removed_devices_ = entry;
+            break;
+        }
+    }
+    alad_spin_unlock_(&alad_device_registry_lock_);
+}
+
+/* aladLoadAL routes these through hooks, so destroyed contexts and closed devices drop out of the caches above */
+static LPALCDESTROYCONTEXT     alad_driver_destroy_context_      = nullptr;
+static LPALCCLOSEDEVICE        alad_driver_close_device_         = nullptr;
+static LPALCCAPTURECLOSEDEVICE alad_driver_capture_close_device_ = nullptr;
+static aladCloseDeviceCallback alad_close_device_callback_ = nullptr;
+aladCloseDeviceCallback aladSetCloseDeviceCallback (aladCloseDeviceCallback callback) {
+    aladCloseDeviceCallback previous = alad_close_device_callback_;
+    alad_close_device_callback_ = callback;
+    return previous;
+}
+static void ALC_APIENTRY alad_destroy_context_ (ALCcontext *context) ALAD_NOEXCEPT_ {
+    aladInvalidateContextFunctions(context);
+    alad_forget_frame_(context);
+    if (alad_driver_destroy_context_ != nullptr) alad_driver_destroy_context_(context);
+}
+/* the driver refuses to close a device that still has contexts, which then stays registered */
+static ALCboolean ALC_APIENTRY alad_close_device_ (ALCdevice *device) ALAD_NOEXCEPT_ {
+    ALCboolean closed;
+    if (alad_close_device_callback_ != nullptr) alad_close_device_callback_(device);
+    closed = alad_driver_close_device_ != nullptr ? alad_driver_close_device_(device) : ALC_FALSE;
+    if (closed) aladUnregisterDevice(device);
+    return closed;
+}
+static ALCboolean ALC_APIENTRY alad_capture_close_device_ (ALCdevice *device) ALAD_NOEXCEPT_ {
+    ALCboolean closed = alad_driver_capture_close_device_ != nullptr ? alad_driver_capture_close_device_(device) : ALC_FALSE;
+    if (closed) aladUnregisterDevice(device);
+    return closed;
+}
+static void alad_apply_hooks_ (aladALCFunctions *functions) {
+    if (alad_driver_destroy_context_ != nullptr)      functions->DestroyContext = alad_destroy_context_;
+    if (alad_driver_close_device_ != nullptr)         functions->CloseDevice = alad_close_device_;
+    if (alad_driver_capture_close_device_ != nullptr) functions->CaptureCloseDevice = alad_capture_close_device_;
+}
+/* with lazy loading, the slots only hold trampolines, which would replace the hooks on their first call */
+#ifdef ALAD_LAZY_LOADING
+#define ALAD_DRIVER_FUNCTION_(type, member, name) REINTERPRET_CAST(type, alad_load_global_(name))
+#else
+#define ALAD_DRIVER_FUNCTION_(type, member, name) alc->member
+#endif
+static void alad_install_hooks_ (aladALCFunctions *alc) {
+    alad_driver_destroy_context_      = ALAD_DRIVER_FUNCTION_(LPALCDESTROYCONTEXT,     DestroyContext,     "alcDestroyContext");
+    alad_driver_close_device_         = ALAD_DRIVER_FUNCTION_(LPALCCLOSEDEVICE,        CloseDevice,        "alcCloseDevice");
+    alad_driver_capture_close_device_ = ALAD_DRIVER_FUNCTION_(LPALCCAPTURECLOSEDEVICE, CaptureCloseDevice, "alcCaptureCloseDevice");
+    alad_apply_hooks_(alc);
+}
+
+
 /* simplified Interface */
-void aladLoadAL () {
+/* aladLoadAL and aladUpdateAL take turns (on alad_update_lock_, see the context cache); with ALAD_THREAD_SAFE, they fill copies of the
+   tables and then publish those, or fail if there's no memory for the copies */
+#ifdef ALAD_THREAD_SAFE
+typedef struct alad_table_block_ {
+    struct alad_table_block_ *next;
+    union {
+        aladALFunctions al;
+        aladALCFunctions alc;
+    } table;
+} alad_table_block_;
+/* other threads may still be calling through old tables, so the published ones are only freed by aladTerminate */
+static alad_table_block_ *alad_table_blocks_ = nullptr;
+static void* alad_copy_table_ (const void *source, size_t size) {
+    alad_table_block_ *block = REINTERPRET_CAST(alad_table_block_*, malloc(sizeof(alad_table_block_)));
+    if (block == nullptr) return nullptr;
+    memcpy(&block->table, source, size);
+    block->next = nullptr;
+    return &block->table;
+}
+static void alad_discard_table_ (void *copy) {
+    if (copy != nullptr) free(REINTERPRET_CAST(char*, copy) - offsetof(alad_table_block_, table));
+}
+/* a copy that came out the same as the table it was taken from is dropped, so that updates which change nothing don't keep a block */
+static void* alad_publish_table_ (void *copy, void *current, size_t size) {
+    alad_table_block_ *block;
+    if (memcmp(copy, current, size) == 0) {
+        alad_discard_table_(copy);
+        return current;
+    }
+    block = REINTERPRET_CAST(alad_table_block_*, (REINTERPRET_CAST(char*, copy) - offsetof(alad_table_block_, table)));
+    block->next = alad_table_blocks_;
+    alad_table_blocks_ = block;
+    return copy;
+}
+#endif
+static ALboolean alad_begin_update_ (aladALFunctions **al, aladALCFunctions **alc) {
+    alad_spin_lock_(&alad_update_lock_);
+#ifdef ALAD_THREAD_SAFE
+    *al = REINTERPRET_CAST(aladALFunctions*, alad_copy_table_(alad_main_al_, sizeof(aladALFunctions)));
+    *alc = REINTERPRET_CAST(aladALCFunctions*, alad_copy_table_(aladActiveALC, sizeof(aladALCFunctions)));
+    if (*al == nullptr || *alc == nullptr) {
+        alad_discard_table_(*al);
+        alad_discard_table_(*alc);
+        alad_spin_unlock_(&alad_update_lock_);
+        return AL_FALSE;
+    }
+#else
+    *al = alad_main_al_;
+    *alc = aladActiveALC;
+#endif
+    return AL_TRUE;
+}
+/* the context tables hold functions of the tables being replaced, so the next fetch derives new ones, except for an active one, which
+   is derived again from the new tables right away and stays active; any other active table (like a layer of alad-utils.h) gives way
+   to the new one. The old tables are kept for whoever still holds them. */
+static void alad_end_update_ (aladALFunctions *al, aladALCFunctions *alc) {
+    aladALFunctions *active;
+    aladALFunctions *derived;
+    size_t i;
+#ifdef ALAD_THREAD_SAFE
+    al = REINTERPRET_CAST(aladALFunctions*, alad_publish_table_(al, alad_main_al_, sizeof(aladALFunctions)));
+    alc = REINTERPRET_CAST(aladALCFunctions*, alad_publish_table_(alc, aladActiveALC, sizeof(aladALCFunctions)));
+#ifdef ALAD_LAZY_LOADING
+    /* the trampolines patch the table they were installed in, which may just have been dropped for the one it equals */
+    alad_lazy_target_AL_ = al;
+    alad_lazy_target_ALC_ = alc;
+#endif
+#endif
+    active = al;
+    for (i = 0; i < ALAD_CONTEXT_CACHE_SIZE; i++) {
+        alad_context_entry_ *entry = &alad_context_cache_[i];
+        if (entry->context == nullptr || entry->functions == nullptr) continue;
+        derived = aladActiveAL == entry->functions ? alad_derive_context_functions_(entry, entry->context, al, alc) : nullptr;
+        if (derived != nullptr) active = derived;
+        else entry->functions = nullptr;
+    }
+    alad_main_al_ = al;
+    alad_atomic_store_ptr_(REINTERPRET_CAST(void * volatile *, &aladActiveALC), alc);
+    alad_activate_(active);
+    alad_spin_unlock_(&alad_update_lock_);
+}
+static aladUpdateCallback alad_update_callback_ = nullptr;
+aladUpdateCallback aladSetUpdateCallback (aladUpdateCallback callback) {
+    aladUpdateCallback previous = alad_update_callback_;
+    alad_update_callback_ = callback;
+    return previous;
+}
+ALboolean aladLoadAL () {
+    aladALFunctions *al;
+    aladALCFunctions *alc;
     alad_load_lib_();
-    aladAL.GetProcAddress = alad_load_global_("alGetProcAddress");
-    aladLoadALCoreMinimal(&aladAL, alad_load_global_);
-    aladLoadALCoreRest(&aladAL, alad_load_global_);
-    aladALC.GetProcAddress = alad_load_global_("alcGetProcAddress");
-    aladLoadALCCore(&aladALC, alad_load_global_);
-}
-void aladUpdateAL () {
-    aladLoadEFX(&aladAL, aladAL.GetProcAddress);
-    aladLoadALExtensions(&aladAL, aladAL.GetProcAddress);
-    aladBakedDevice_ = aladALC.GetContextsDevice(aladALC.GetCurrentContext());
-    if(aladALC.GetProcAddress != nullptr) aladLoadALCExtensions(&aladALC, alad_load_alc_with_baked_device_);
+    if (!alad_begin_update_(&al, &alc)) return AL_FALSE;
+    al->GetProcAddress = REINTERPRET_CAST(LPALGETPROCADDRESS, alad_load_global_("alGetProcAddress"));
+    alc->GetProcAddress = REINTERPRET_CAST(LPALCGETPROCADDRESS, alad_load_global_("alcGetProcAddress"));
+    alad_get_proc_address2_ = alc->GetProcAddress == nullptr ? nullptr :
+        REINTERPRET_CAST(ALAD_ISO_C_COMPAT_LPALCGETPROCADDRESS_, ((ALAD_ISO_C_COMPAT_LPALCGETPROCADDRESS_) alc->GetProcAddress) (nullptr, "alcGetProcAddress2"));
+#ifdef ALAD_LAZY_LOADING
+    alad_lazy_install_(al, alc, ~(aladExtensionMask) 0);
+#else
+    alad_load_module_extensions_(aladALTable, aladALTableSize, ALAD_AL_CORE_MINIMAL, ALAD_AL_CORE_REST, al);
+    alad_load_module_extensions_(aladALCTable, aladALCTableSize, ALAD_ALC_CORE, ALAD_ALC_CORE, alc);
+#endif
+    alad_install_hooks_(alc);
+    alad_end_update_(al, alc);
+    if (alad_update_callback_ != nullptr) alad_update_callback_();
+    return AL_TRUE;
+}
+ALboolean aladUpdateAL () {
+    const aladTableEntry *table;
+    size_t count;
+    aladALFunctions *al;
+    aladALCFunctions *alc;
+    ALCdevice *device;
+#ifdef ALAD_LAZY_LOADING
+    ALCdevice *oldDevice = alad_extensions_device_;
+    aladExtensionMask oldExtensions = alad_extensions_;
+#endif
+    if (!alad_begin_update_(&al, &alc)) return AL_FALSE;
+    device = alc->GetContextsDevice(alc->GetCurrentContext());
+    alad_null_device_extensions_ = alad_parse_device_extensions_(nullptr);
+    alad_extensions_device_ = device;
+    alad_extensions_ = alad_probe_extensions_(device);
+#ifdef ALAD_LAZY_LOADING
+    /* re-arm the extension trampolines, so they resolve against the new device; with the same device and extensions, what they resolved
+       still holds */
+    if (device != oldDevice || alad_extensions_ != oldExtensions) alad_lazy_install_(al, alc, ~ALAD_CORE_EXTENSIONS);
+    table = alad_find_extensions_(aladALTable, aladALTableSize, ALAD_ALC_EXT_EFX, ALAD_AL_EXT_debug, &count);
+    alad_clear_absent_(table, count, alad_extensions_, al);
+    table = alad_find_extensions_(aladALCTable, aladALCTableSize, ALAD_ALC_EXT_thread_local_context, ALAD_ALC_SOFT_system_events, &count);
+    alad_clear_absent_(table, count, alad_extensions_, alc);
+#else
+    table = alad_find_extensions_(aladALTable, aladALTableSize, ALAD_ALC_EXT_EFX, ALAD_AL_EXT_debug, &count);
+    aladResolveExtensions(table, count, alad_extensions_, (aladLoader) al->GetProcAddress, al);
+    if(alc->GetProcAddress != nullptr) {
+        table = alad_find_extensions_(aladALCTable, aladALCTableSize, ALAD_ALC_EXT_thread_local_context, ALAD_ALC_SOFT_system_events, &count);
+        aladResolveExtensionsEx(table, count, alad_extensions_, aladALCDeviceLoader, device, alc);
+    }
+#endif
+    alad_end_update_(al, alc);
+    if (alad_update_callback_ != nullptr) alad_update_callback_();
+    return AL_TRUE;
+}
+void aladResolveAll () {
+#ifdef ALAD_LAZY_LOADING
+    alad_spin_lock_(&alad_update_lock_);
+    alad_lazy_resolve_(alad_main_al_, aladActiveALC, ~(aladExtensionMask) 0);
+    if (aladActiveAL == alad_main_al_) alad_activate_(alad_main_al_);
+    alad_spin_unlock_(&alad_update_lock_);
+#endif
+}
+/* only touches the member while it still holds its trampoline, so the functions of a utility layer in the copy stay as they are */
+void aladResolveFunction (aladALFunctions *functions, size_t offset) {
+#ifdef ALAD_LAZY_LOADING
+    size_t i;
+    for (i = 0; i < aladALTableSize; i++) {
+        if (aladALTable[i].offset != offset) continue;
+        if (alad_lazy_slot_(functions, offset) != alad_lazy_AL_trampolines_[i]) return;
+        alad_lazy_patch_(functions, offset, alad_lazy_AL_trampolines_[i], alad_lazy_AL_(aladALTable[i].name, aladALTable[i].extension, offset, alad_lazy_AL_trampolines_[i]));
+        return;
+    }
+#else
+    (void) functions;
+    (void) offset;
+#endif
 }
 void aladTerminate () {
+    size_t i;
     if (alad_module_ != nullptr) alad_close_ (alad_module_);
     alad_module_ = nullptr;
+    alad_library_loaded_ = 0;
+    alad_get_proc_address2_ = nullptr;
+    alad_extensions_ = 0;
+    alad_null_device_extensions_ = 0;
+    alad_extensions_device_ = nullptr;
+#ifdef ALAD_LAZY_LOADING
+    alad_lazy_target_AL_ = nullptr;
+    alad_lazy_target_ALC_ = nullptr;
+#endif
+    for (i = 0; i < ALAD_CONTEXT_CACHE_SIZE; i++) alad_free_context_tables_(&alad_context_cache_[i]);
+    for (i = 0; i < ALAD_FRAME_CONTEXTS; i++) alad_frames_[i].context = nullptr;
+    alad_main_al_ = &alad_default_al_;
+    alad_activate_(&alad_default_al_);
+    aladActiveALC = &alad_default_alc_;
+#ifdef ALAD_THREAD_SAFE
+    while (alad_table_blocks_ != nullptr) {
+        alad_table_block_ *next = alad_table_blocks_->next;
+        free(alad_table_blocks_);
+        alad_table_blocks_ = next;
+    }
+#endif
+    for (i = 0; i < ALAD_DEVICE_REGISTRY_SIZE; i++) {
+        void *key = alad_device_registry_[i];
+        if (key != nullptr && key != &alad_device_tombstone_) free(key);
+        alad_device_registry_[i] = nullptr;
+    }
+    while (alad_removed_devices_ != nullptr) {
+        alad_device_entry_ *next = alad_removed_devices_->next;
+        free(alad_removed_devices_);
+        alad_removed_devices_ = next;
+    }
 }
 
-/* old manual interface */
+/* old manual interface; it writes into the AL table of the simplified interface, and aladAL picks that up if it's active */
+static void alad_refresh_main_ () {
+    if (aladActiveAL == alad_main_al_) alad_activate_(alad_main_al_);
+}
 void aladLoadALContextFree (ALboolean loadAll) {
     alad_load_lib_();
-    aladAL.GetProcAddress = alad_load_global_("alGetProcAddress");
-    aladLoadALCoreMinimal(&aladAL, alad_load_global_);
-    if (loadAll != AL_FALSE) {
-        aladLoadALCoreRest(&aladAL, alad_load_global_);
-    }
-    aladALC.GetProcAddress = alad_load_global_("alcGetProcAddress");
-    aladLoadALCCore(&aladALC, alad_load_global_);
+    alad_main_al_->GetProcAddress = REINTERPRET_CAST(LPALGETPROCADDRESS, alad_load_global_("alGetProcAddress"));
+    alad_load_module_extensions_(aladALTable, aladALTableSize, ALAD_AL_CORE_MINIMAL, loadAll != AL_FALSE ? ALAD_AL_CORE_REST : ALAD_AL_CORE_MINIMAL, alad_main_al_);
+    aladALC.GetProcAddress = REINTERPRET_CAST(LPALCGETPROCADDRESS, alad_load_global_("alcGetProcAddress"));
+    alad_load_module_extensions_(aladALCTable, aladALCTableSize, ALAD_ALC_CORE, ALAD_ALC_CORE, &aladALC);
+    alad_apply_hooks_(&aladALC);
+    alad_refresh_main_();
 }
 void aladLoadALFromLoaderFunction (LPALGETPROCADDRESS inital_loader) {
     if (inital_loader != nullptr) {
-        aladAL.GetProcAddress = inital_loader;
-    } else if (alGetProcAddress == nullptr) {
+        alad_main_al_->GetProcAddress = inital_loader;
+    } else if (alad_main_al_->GetProcAddress == nullptr) {
         alad_load_lib_();
         if(alad_module_ == nullptr) {
-            aladAL.GetProcAddress = nullptr;
+            alad_main_al_->GetProcAddress = nullptr;
+            alad_refresh_main_();
             return;
         }
-        else aladAL.GetProcAddress = alad_load_global_("alGetProcAddress");
+        else alad_main_al_->GetProcAddress = REINTERPRET_CAST(LPALGETPROCADDRESS, alad_load_global_("alGetProcAddress"));
     }
-    aladLoadALCoreMinimal(&aladAL, (aladLoader) aladAL.GetProcAddress);
-    aladLoadALCoreRest(&aladAL, (aladLoader) aladAL.GetProcAddress);
-    if(aladALC.GetProcAddress == nullptr) aladALC.GetProcAddress = ((aladLoader) aladAL.GetProcAddress)("alcGetProcAddress");
-    aladLoadALCCore(&aladALC, (aladLoader) aladAL.GetProcAddress);
+    aladLoadALCoreMinimal(alad_main_al_, (aladLoader) alad_main_al_->GetProcAddress);
+    aladLoadALCoreRest(alad_main_al_, (aladLoader) alad_main_al_->GetProcAddress);
+    if(aladALC.GetProcAddress == nullptr) aladALC.GetProcAddress = REINTERPRET_CAST(LPALCGETPROCADDRESS, ((aladLoader) alad_main_al_->GetProcAddress)("alcGetProcAddress"));
+    aladLoadALCCore(&aladALC, (aladLoader) alad_main_al_->GetProcAddress);
+    alad_apply_hooks_(&aladALC);
+    alad_refresh_main_();
 }
 void aladUpdateALPointers (ALCcontext *context, ALboolean extensionsOnly) {
     ALCcontext *oldContext = nullptr;
@@ -1316,14 +2630,15 @@ void aladUpdateALPointers (ALCcontext *context, ALboolean extensionsOnly) {
         aladALC.MakeContextCurrent(context);
     }
     if (extensionsOnly == AL_FALSE) {
-        aladLoadALCoreMinimal(&aladAL, (aladLoader) aladAL.GetProcAddress);
-        aladLoadALCoreRest(&aladAL, (aladLoader) aladAL.GetProcAddress);
+        aladLoadALCoreMinimal(alad_main_al_, (aladLoader) alad_main_al_->GetProcAddress);
+        aladLoadALCoreRest(alad_main_al_, (aladLoader) alad_main_al_->GetProcAddress);
     }
-    aladLoadEFX(&aladAL, (aladLoader) aladAL.GetProcAddress);
-    aladLoadALExtensions(&aladAL, (aladLoader) aladAL.GetProcAddress);
+    aladLoadEFX(alad_main_al_, (aladLoader) alad_main_al_->GetProcAddress);
+    aladLoadALExtensions(alad_main_al_, (aladLoader) alad_main_al_->GetProcAddress);
     if(context != nullptr) {
         aladALC.MakeContextCurrent(oldContext);
     }
+    alad_refresh_main_();
 }
 void aladUpdateALCPointersFromContext (ALCcontext *context, ALboolean extensionsOnly) {
     ALCcontext *oldContext = nullptr;
@@ -1332,10 +2647,11 @@ void aladUpdateALCPointersFromContext (ALCcontext *context, ALboolean extensions
         aladALC.MakeContextCurrent(context);
     }
     if (extensionsOnly == AL_FALSE) {
-        if(aladALC.GetProcAddress == nullptr) aladALC.GetProcAddress = ((aladLoader) aladAL.GetProcAddress)("alcGetProcAddress");
-        aladLoadALCCore(&aladALC, (aladLoader) aladAL.GetProcAddress);
+        if(aladALC.GetProcAddress == nullptr) aladALC.GetProcAddress = REINTERPRET_CAST(LPALCGETPROCADDRESS, ((aladLoader) alad_main_al_->GetProcAddress)("alcGetProcAddress"));
+        aladLoadALCCore(&aladALC, (aladLoader) alad_main_al_->GetProcAddress);
+        alad_apply_hooks_(&aladALC);
     }
-    aladLoadALCExtensions(&aladALC, (aladLoader) aladAL.GetProcAddress);
+    aladLoadALCExtensions(&aladALC, (aladLoader) alad_main_al_->GetProcAddress);
     
     if(context != nullptr) {
         aladALC.MakeContextCurrent(oldContext);
@@ -1343,11 +2659,11 @@ void aladUpdateALCPointersFromContext (ALCcontext *context, ALboolean extensions
 }
 void aladUpdateALCPointersFromDevice (ALCdevice *device, ALboolean extensionsOnly) {
     if(aladALC.GetProcAddress == nullptr) return;
-    aladBakedDevice_ = device;
     if (extensionsOnly == AL_FALSE) {
-        aladLoadALCCore(&aladALC, alad_load_alc_with_baked_device_);
+        aladLoadALCCoreEx(&aladALC, aladALCDeviceLoader, device);
+        alad_apply_hooks_(&aladALC);
     }
-    aladLoadALCExtensions(&aladALC, alad_load_alc_with_baked_device_);
+    aladLoadALCExtensionsEx(&aladALC, aladALCDeviceLoader, device);
 }
 
 
@@ -1356,6 +2672,18 @@ void aladUpdateALCPointersFromDevice (ALCdevice *device, ALboolean extensionsOnl
 
 #if defined(__cplusplus)
 } /* extern "C" */
+
+/* RAII guard for a frame scope of the current context, or of the one given to the constructor */
+class aladFrame {
+public:
+    explicit aladFrame (ALCcontext *context = nullptr) : context_(aladBeginFrame(context)) {}
+    ~aladFrame () { aladEndFrame(context_); }
+    ALCcontext* context () const { return context_; }
+private:
+    aladFrame (const aladFrame&);
+    aladFrame& operator= (const aladFrame&);
+    ALCcontext *context_;
+};
 #endif
 
 #endif        /* ALAD_H */
@@ -0,0 +1,185 @@
+/*
+ *  alad-bench.c: measures the cost of aladLoadAL, aladUpdateAL and aladUpdateALCPointersFromDevice against the stand-in
+ *  libopenal.so.1 from stub-openal.c, so loader regressions can be spotted without an OpenAL implementation or audio hardware.
+ *
+ *  Build and run it on Linux with
+ *
+ *      cc -O2 -shared -fPIC -o libopenal.so.1 stub-openal.c
+ *      cc -O2 -I[path to the AL headers] -o alad-bench alad-bench.c -Wl,--wrap=dlsym -ldl
+ *      LD_LIBRARY_PATH=. ./alad-bench [iterations]
+ *
+ *  Add -DALAD_LAZY_LOADING or -DALAD_GNU_HASH_RESOLVER to the second line to measure those configurations instead.
+ *  The dlsym calls are counted by wrapping dlsym with the linker; with a linker that doesn't support --wrap, leave it out
+ *  and define ALAD_BENCH_NO_DLSYM_COUNT, then the dlsym counts are reported as -1.
+ *
+ *  Every measurement is run once on a fresh state ("cold") and then [iterations] times again ("warm", default 1000).
+ *  The results are written to stdout as one JSON object, with the timings in nanoseconds and the calls to dlsym,
+ *  alGetProcAddress and alcGetProcAddress (including alcGetProcAddress2) per run. The "unresolved" counts are the
+ *  entries of aladALTable and aladALCTable that are still NULL at the end, which should be 0 unless the stub library is
+ *  built with -DSTUB_OPENAL_CORE_ONLY, run with STUB_OPENAL_EXTENSIONS, or is missing functions alad.h looks up.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#define ALAD_IMPLEMENTATION
+#include "../alad.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+
+/* dlsym counting */
+static unsigned long bench_dlsym_calls_ = 0;
+#ifndef ALAD_BENCH_NO_DLSYM_COUNT
+void *__real_dlsym (void *module, const char *name);
+void *__wrap_dlsym (void *module, const char *name) {
+    bench_dlsym_calls_++;
+    return __real_dlsym(module, name);
+}
+#define bench_dlsym_ __real_dlsym
+#else
+#define bench_dlsym_ dlsym
+#endif
+
+/* matches stubOpenALCounters in stub-openal.c */
+typedef struct bench_stub_counters_ {
+    unsigned long al_get_proc_address;
+    unsigned long alc_get_proc_address;
+} bench_stub_counters_;
+static bench_stub_counters_ *bench_stub_counters_p_ = nullptr;
+
+typedef struct bench_counts_ {
+    unsigned long dlsym;
+    unsigned long al_get_proc_address;
+    unsigned long alc_get_proc_address;
+} bench_counts_;
+static bench_counts_ bench_read_counts_ (void) {
+    bench_counts_ counts;
+    counts.dlsym = bench_dlsym_calls_;
+    counts.al_get_proc_address = bench_stub_counters_p_ != nullptr ? bench_stub_counters_p_->al_get_proc_address : 0;
+    counts.alc_get_proc_address = bench_stub_counters_p_ != nullptr ? bench_stub_counters_p_->alc_get_proc_address : 0;
+    return counts;
+}
+
+static double bench_now_ (void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double) time.tv_sec * 1e9 + (double) time.tv_nsec;
+}
+static int bench_compare_ (const void *a, const void *b) {
+    double x = *(const double*) a, y = *(const double*) b;
+    return (x > y) - (x < y);
+}
+
+
+
+/* runs body [iterations] times, each after setup (which is not timed), and prints the result as one JSON object */
+static int bench_first_result_ = 1;
+static void bench_run_ (const char *name, void (*setup) (void), void (*body) (void), size_t iterations) {
+    double *samples = (double*) malloc(iterations * sizeof(double));
+    double total = 0.0;
+    bench_counts_ before, after;
+    size_t i;
+    if (samples == nullptr) return;
+    before = bench_read_counts_();
+    for (i = 0; i < iterations; i++) {
+        double start;
+        if (setup != nullptr) setup();
+        start = bench_now_();
+        body();
+        samples[i] = bench_now_() - start;
+        total += samples[i];
+    }
+    after = bench_read_counts_();
+    qsort(samples, iterations, sizeof(double), bench_compare_);
+    printf("%s\n    {\"name\": \"%s\", \"iterations\": %lu, \"min_ns\": %.0f, \"median_ns\": %.0f, \"mean_ns\": %.0f, \"max_ns\": %.0f, ",
+           bench_first_result_ ? "" : ",", name, (unsigned long) iterations,
+           samples[0], samples[iterations / 2], total / (double) iterations, samples[iterations - 1]);
+#ifndef ALAD_BENCH_NO_DLSYM_COUNT
+    printf("\"dlsym_per_run\": %.2f, ", (double) (after.dlsym - before.dlsym) / (double) iterations);
+#else
+    printf("\"dlsym_per_run\": -1, ");
+#endif
+    printf("\"alGetProcAddress_per_run\": %.2f, \"alcGetProcAddress_per_run\": %.2f}",
+           (double) (after.al_get_proc_address - before.al_get_proc_address) / (double) iterations,
+           (double) (after.alc_get_proc_address - before.alc_get_proc_address) / (double) iterations);
+    bench_first_result_ = 0;
+    free(samples);
+}
+
+static size_t bench_unresolved_ (const aladTableEntry *table, size_t count, const void *functions) {
+    size_t i, unresolved = 0;
+    for (i = 0; i < count; i++) {
+        aladFunction function;
+        memcpy(&function, REINTERPRET_CAST(const char*, functions) + table[i].offset, sizeof(aladFunction));
+        if (function == nullptr) unresolved++;
+    }
+    return unresolved;
+}
+
+
+
+static ALCdevice *bench_device_ = nullptr;
+
+static void bench_terminate_ (void) { aladTerminate(); }
+static void bench_load_ (void) { aladLoadAL(); }
+static void bench_update_ (void) { aladUpdateAL(); }
+static void bench_update_from_device_ (void) { aladUpdateALCPointersFromDevice(bench_device_, AL_FALSE); }
+
+int main (int argc, char **argv) {
+    size_t iterations = 1000;
+    void *stub;
+    ALCcontext *context;
+
+    if (argc > 1) iterations = (size_t) strtoul(argv[1], nullptr, 10);
+    if (iterations == 0) iterations = 1;
+
+    printf("{\n  \"configuration\": {\"lazy_loading\": %s, \"gnu_hash_resolver\": %s},\n  \"results\": [",
+#ifdef ALAD_LAZY_LOADING
+           "true",
+#else
+           "false",
+#endif
+#if defined(ALAD_GNU_HASH_RESOLVER) && defined(__linux__)
+           "true");
+#else
+           "false");
+#endif
+
+    /* the first load maps the library, so the stub's counters can only be found after it; it doesn't call the stub's
+       alGetProcAddress or alcGetProcAddress without ALAD_LAZY_LOADING anyway, and only installs trampolines with it */
+    bench_run_("aladLoadAL/cold", nullptr, bench_load_, 1);
+    stub = dlopen(alad_LIB_NAME_, RTLD_LAZY | RTLD_NOLOAD);
+    if (stub == nullptr) {
+        fprintf(stderr, "alad-bench: %s isn't loaded, check LD_LIBRARY_PATH\n", alad_LIB_NAME_);
+        return 1;
+    }
+    bench_stub_counters_p_ = REINTERPRET_CAST(bench_stub_counters_*, bench_dlsym_(stub, "stubOpenALCallCounters"));
+    if (bench_stub_counters_p_ == nullptr) fprintf(stderr, "alad-bench: %s is not the stub library, call counts will be 0\n", alad_LIB_NAME_);
+
+    /* our own handle keeps the library mapped, so these only measure the symbol resolution and not the mapping */
+    bench_run_("aladLoadAL/warm", bench_terminate_, bench_load_, iterations);
+
+    bench_device_ = alcOpenDevice(nullptr);
+    context = alcCreateContext(bench_device_, nullptr);
+    alcMakeContextCurrent(context);
+
+    bench_run_("aladUpdateAL/cold", nullptr, bench_update_, 1);
+    bench_run_("aladUpdateAL/warm", nullptr, bench_update_, iterations);
+    bench_run_("aladUpdateALCPointersFromDevice/cold", nullptr, bench_update_from_device_, 1);
+    bench_run_("aladUpdateALCPointersFromDevice/warm", nullptr, bench_update_from_device_, iterations);
+
+    printf("\n  ],\n  \"unresolved\": {\"al\": %lu, \"alc\": %lu}\n}\n",
+           (unsigned long) bench_unresolved_(aladALTable, aladALTableSize, &aladAL),
+           (unsigned long) bench_unresolved_(aladALCTable, aladALCTableSize, &aladALC));
+
+    alcMakeContextCurrent(nullptr);
+    alcDestroyContext(context);
+    alcCloseDevice(bench_device_);
+    aladTerminate();
+    dlclose(stub);
+    return 0;
+}
@@ -0,0 +1,555 @@
+/*
+ *  stub-openal.c: a stand-in libopenal.so.1 for benchmarking alad's loaders without an OpenAL implementation or audio hardware.
+ *
+ *  It exports every function alad.h looks up, as a no-op, plus working versions of the handful of functions the loaders
+ *  and the benchmark actually call (alGetProcAddress, alcGetProcAddress, alGetString, alcGetString, the extension queries and
+ *  a fake device and context). alGetProcAddress and alcGetProcAddress count their calls, see stubOpenALCounters below.
+ *
+ *  Build it with
+ *
+ *      cc -O2 -shared -fPIC -o libopenal.so.1 stub-openal.c
+ *
+ *  and add -DSTUB_OPENAL_CORE_ONLY to leave out all extension functions and report no extensions at all, which simulates an
+ *  old or minimal driver. At runtime, the advertised extensions can also be narrowed down by setting STUB_OPENAL_EXTENSIONS
+ *  to a space separated list of extension names (e.g. "ALC_EXT_EFX AL_SOFT_source_latency"); the functions of extensions that
+ *  aren't in that list stay exported, but alGetProcAddress and alcGetProcAddress return NULL for them, like a driver would.
+ *
+ *  The AL headers are deliberately not included, since all the functions here have the wrong prototypes.
+ *  The lists below are generated from the tables in alad.h and have to be extended together with them;
+ *  alad-bench reports the number of pointers it couldn't load, so a stale list will show up there.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GNUC__)
+#define STUB_EXPORT __attribute__((visibility("default")))
+#else
+#define STUB_EXPORT
+#endif
+
+typedef void (*stub_function_)(void);
+
+#define STUB_CORE_FUNCTIONS(X) \
+    X(alEnable,               NULL) \
+    X(alDisable,              NULL) \
+    X(alIsEnabled,            NULL) \
+    X(alGetBooleanv,          NULL) \
+    X(alGetIntegerv,          NULL) \
+    X(alGetFloatv,            NULL) \
+    X(alGetDoublev,           NULL) \
+    X(alGetBoolean,           NULL) \
+    X(alGetInteger,           NULL) \
+    X(alGetFloat,             NULL) \
+    X(alGetDouble,            NULL) \
+    X(alGetEnumValue,         NULL) \
+    X(alDopplerFactor,        NULL) \
+    X(alDopplerVelocity,      NULL) \
+    X(alSpeedOfSound,         NULL) \
+    X(alDistanceModel,        NULL) \
+    X(alListenerf,            NULL) \
+    X(alListener3f,           NULL) \
+    X(alListenerfv,           NULL) \
+    X(alListeneri,            NULL) \
+    X(alListener3i,           NULL) \
+    X(alListeneriv,           NULL) \
+    X(alGetListenerf,         NULL) \
+    X(alGetListener3f,        NULL) \
+    X(alGetListenerfv,        NULL) \
+    X(alGetListeneri,         NULL) \
+    X(alGetListener3i,        NULL) \
+    X(alGetListeneriv,        NULL) \
+    X(alGenSources,           NULL) \
+    X(alDeleteSources,        NULL) \
+    X(alIsSource,             NULL) \
+    X(alSourcef,              NULL) \
+    X(alSource3f,             NULL) \
+    X(alSourcefv,             NULL) \
+    X(alSourcei,              NULL) \
+    X(alSource3i,             NULL) \
+    X(alSourceiv,             NULL) \
+    X(alGetSourcef,           NULL) \
+    X(alGetSource3f,          NULL) \
+    X(alGetSourcefv,          NULL) \
+    X(alGetSourcei,           NULL) \
+    X(alGetSource3i,          NULL) \
+    X(alGetSourceiv,          NULL) \
+    X(alSourcePlayv,          NULL) \
+    X(alSourceStopv,          NULL) \
+    X(alSourceRewindv,        NULL) \
+    X(alSourcePausev,         NULL) \
+    X(alSourcePlay,           NULL) \
+    X(alSourceStop,           NULL) \
+    X(alSourceRewind,         NULL) \
+    X(alSourcePause,          NULL) \
+    X(alSourceQueueBuffers,   NULL) \
+    X(alSourceUnqueueBuffers, NULL) \
+    X(alGenBuffers,           NULL) \
+    X(alDeleteBuffers,        NULL) \
+    X(alIsBuffer,             NULL) \
+    X(alBufferData,           NULL) \
+    X(alBufferf,              NULL) \
+    X(alBuffer3f,             NULL) \
+    X(alBufferfv,             NULL) \
+    X(alBufferi,              NULL) \
+    X(alBuffer3i,             NULL) \
+    X(alBufferiv,             NULL) \
+    X(alGetBufferf,           NULL) \
+    X(alGetBuffer3f,          NULL) \
+    X(alGetBufferfv,          NULL) \
+    X(alGetBufferi,           NULL) \
+    X(alGetBuffer3i,          NULL) \
+    X(alGetBufferiv,          NULL) \
+    X(alcProcessContext,      NULL) \
+    X(alcSuspendContext,      NULL) \
+    X(alcGetEnumValue,        NULL) \
+    X(alcGetIntegerv,         NULL) \
+    X(alcCaptureOpenDevice,   NULL) \
+    X(alcCaptureCloseDevice,  NULL) \
+    X(alcCaptureStart,        NULL) \
+    X(alcCaptureStop,         NULL) \
+    X(alcCaptureSamples,      NULL)
+
+#define STUB_EXTENSION_FUNCTIONS(X) \
+    X(alGenEffects,                       "ALC_EXT_EFX")                  \
+    X(alDeleteEffects,                    "ALC_EXT_EFX")                  \
+    X(alIsEffect,                         "ALC_EXT_EFX")                  \
+    X(alEffecti,                          "ALC_EXT_EFX")                  \
+    X(alEffectiv,                         "ALC_EXT_EFX")                  \
+    X(alEffectf,                          "ALC_EXT_EFX")                  \
+    X(alEffectfv,                         "ALC_EXT_EFX")                  \
+    X(alGetEffecti,                       "ALC_EXT_EFX")                  \
+    X(alGetEffectiv,                      "ALC_EXT_EFX")                  \
+    X(alGetEffectf,                       "ALC_EXT_EFX")                  \
+    X(alGetEffectfv,                      "ALC_EXT_EFX")                  \
+    X(alGenFilters,                       "ALC_EXT_EFX")                  \
+    X(alDeleteFilters,                    "ALC_EXT_EFX")                  \
+    X(alIsFilter,                         "ALC_EXT_EFX")                  \
+    X(alFilteri,                          "ALC_EXT_EFX")                  \
+    X(alFilteriv,                         "ALC_EXT_EFX")                  \
+    X(alFilterf,                          "ALC_EXT_EFX")                  \
+    X(alFilterfv,                         "ALC_EXT_EFX")                  \
+    X(alGetFilteri,                       "ALC_EXT_EFX")                  \
+    X(alGetFilteriv,                      "ALC_EXT_EFX")                  \
+    X(alGetFilterf,                       "ALC_EXT_EFX")                  \
+    X(alGetFilterfv,                      "ALC_EXT_EFX")                  \
+    X(alGenAuxiliaryEffectSlots,          "ALC_EXT_EFX")                  \
+    X(alDeleteAuxiliaryEffectSlots,       "ALC_EXT_EFX")                  \
+    X(alIsAuxiliaryEffectSlot,            "ALC_EXT_EFX")                  \
+    X(alAuxiliaryEffectSloti,             "ALC_EXT_EFX")                  \
+    X(alAuxiliaryEffectSlotiv,            "ALC_EXT_EFX")                  \
+    X(alAuxiliaryEffectSlotf,             "ALC_EXT_EFX")                  \
+    X(alAuxiliaryEffectSlotfv,            "ALC_EXT_EFX")                  \
+    X(alGetAuxiliaryEffectSloti,          "ALC_EXT_EFX")                  \
+    X(alGetAuxiliaryEffectSlotiv,         "ALC_EXT_EFX")                  \
+    X(alGetAuxiliaryEffectSlotf,          "ALC_EXT_EFX")                  \
+    X(alGetAuxiliaryEffectSlotfv,         "ALC_EXT_EFX")                  \
+    X(alBufferDataStatic,                 "AL_EXT_STATIC_BUFFER")         \
+    X(alBufferSubDataSOFT,                "AL_SOFT_buffer_sub_data")      \
+    X(alRequestFoldbackStart,             "AL_EXT_FOLDBACK")              \
+    X(alRequestFoldbackStop,              "AL_EXT_FOLDBACK")              \
+    X(alBufferSamplesSOFT,                "AL_SOFT_buffer_samples")       \
+    X(alBufferSubSamplesSOFT,             "AL_SOFT_buffer_samples")       \
+    X(alGetBufferSamplesSOFT,             "AL_SOFT_buffer_samples")       \
+    X(alIsBufferFormatSupportedSOFT,      "AL_SOFT_buffer_samples")       \
+    X(alSourcedSOFT,                      "AL_SOFT_source_latency")       \
+    X(alSource3dSOFT,                     "AL_SOFT_source_latency")       \
+    X(alSourcedvSOFT,                     "AL_SOFT_source_latency")       \
+    X(alGetSourcedSOFT,                   "AL_SOFT_source_latency")       \
+    X(alGetSource3dSOFT,                  "AL_SOFT_source_latency")       \
+    X(alGetSourcedvSOFT,                  "AL_SOFT_source_latency")       \
+    X(alSourcei64SOFT,                    "AL_SOFT_source_latency")       \
+    X(alSource3i64SOFT,                   "AL_SOFT_source_latency")       \
+    X(alSourcei64vSOFT,                   "AL_SOFT_source_latency")       \
+    X(alGetSourcei64SOFT,                 "AL_SOFT_source_latency")       \
+    X(alGetSource3i64SOFT,                "AL_SOFT_source_latency")       \
+    X(alGetSourcei64vSOFT,                "AL_SOFT_source_latency")       \
+    X(alDeferUpdatesSOFT,                 "AL_SOFT_deferred_updates")     \
+    X(alProcessUpdatesSOFT,               "AL_SOFT_deferred_updates")     \
+    X(alGetStringiSOFT,                   "AL_SOFT_source_resampler")     \
+    X(alEventControlSOFT,                 "AL_SOFT_events")               \
+    X(alEventCallbackSOFT,                "AL_SOFT_events")               \
+    X(alGetPointerSOFT,                   "AL_SOFT_events")               \
+    X(alGetPointervSOFT,                  "AL_SOFT_events")               \
+    X(alBufferCallbackSOFT,               "AL_SOFT_callback_buffer")      \
+    X(alGetBufferPtrSOFT,                 "AL_SOFT_callback_buffer")      \
+    X(alGetBuffer3PtrSOFT,                "AL_SOFT_callback_buffer")      \
+    X(alGetBufferPtrvSOFT,                "AL_SOFT_callback_buffer")      \
+    X(alSourcePlayAtTimeSOFT,             "AL_SOFT_source_start_delay")   \
+    X(alSourcePlayAtTimevSOFT,            "AL_SOFT_source_start_delay")   \
+    X(alDebugMessageCallbackEXT,          "AL_EXT_debug")                 \
+    X(alDebugMessageInsertEXT,            "AL_EXT_debug")                 \
+    X(alDebugMessageControlEXT,           "AL_EXT_debug")                 \
+    X(alPushDebugGroupEXT,                "AL_EXT_debug")                 \
+    X(alPopDebugGroupEXT,                 "AL_EXT_debug")                 \
+    X(alGetDebugMessageLogEXT,            "AL_EXT_debug")                 \
+    X(alObjectLabelEXT,                   "AL_EXT_debug")                 \
+    X(alGetObjectLabelEXT,                "AL_EXT_debug")                 \
+    X(alGetPointerEXT,                    "AL_EXT_debug")                 \
+    X(alGetPointervEXT,                   "AL_EXT_debug")                 \
+    X(alcSetThreadContext,                "ALC_EXT_thread_local_context") \
+    X(alcGetThreadContext,                "ALC_EXT_thread_local_context") \
+    X(alcLoopbackOpenDeviceSOFT,          "ALC_SOFT_loopback")            \
+    X(alcIsRenderFormatSupportedSOFT,     "ALC_SOFT_loopback")            \
+    X(alcRenderSamplesSOFT,               "ALC_SOFT_loopback")            \
+    X(alcDevicePauseSOFT,                 "ALC_SOFT_pause_device")        \
+    X(alcDeviceResumeSOFT,                "ALC_SOFT_pause_device")        \
+    X(alcGetStringiSOFT,                  "ALC_SOFT_HRTF")                \
+    X(alcResetDeviceSOFT,                 "ALC_SOFT_HRTF")                \
+    X(alcGetInteger64vSOFT,               "ALC_SOFT_device_clock")        \
+    X(alcReopenDeviceSOFT,                "ALC_SOFT_reopen_device")       \
+    X(alcEventIsSupportedSOFT,            "ALC_SOFT_system_events")       \
+    X(alcEventControlSOFT,                "ALC_SOFT_system_events")       \
+    X(alcEventCallbackSOFT,               "ALC_SOFT_system_events")       \
+    X(alEnableDirect,                     "ALC_EXT_direct_context")       \
+    X(alDisableDirect,                    "ALC_EXT_direct_context")       \
+    X(alIsEnabledDirect,                  "ALC_EXT_direct_context")       \
+    X(alDopplerFactorDirect,              "ALC_EXT_direct_context")       \
+    X(alSpeedOfSoundDirect,               "ALC_EXT_direct_context")       \
+    X(alDistanceModelDirect,              "ALC_EXT_direct_context")       \
+    X(alGetStringDirect,                  "ALC_EXT_direct_context")       \
+    X(alGetBooleanvDirect,                "ALC_EXT_direct_context")       \
+    X(alGetIntegervDirect,                "ALC_EXT_direct_context")       \
+    X(alGetFloatvDirect,                  "ALC_EXT_direct_context")       \
+    X(alGetDoublevDirect,                 "ALC_EXT_direct_context")       \
+    X(alGetBooleanDirect,                 "ALC_EXT_direct_context")       \
+    X(alGetIntegerDirect,                 "ALC_EXT_direct_context")       \
+    X(alGetFloatDirect,                   "ALC_EXT_direct_context")       \
+    X(alGetDoubleDirect,                  "ALC_EXT_direct_context")       \
+    X(alGetErrorDirect,                   "ALC_EXT_direct_context")       \
+    X(alIsExtensionPresentDirect,         "ALC_EXT_direct_context")       \
+    X(alGetProcAddressDirect,             "ALC_EXT_direct_context")       \
+    X(alGetEnumValueDirect,               "ALC_EXT_direct_context")       \
+    X(alListenerfDirect,                  "ALC_EXT_direct_context")       \
+    X(alListener3fDirect,                 "ALC_EXT_direct_context")       \
+    X(alListenerfvDirect,                 "ALC_EXT_direct_context")       \
+    X(alListeneriDirect,                  "ALC_EXT_direct_context")       \
+    X(alListener3iDirect,                 "ALC_EXT_direct_context")       \
+    X(alListenerivDirect,                 "ALC_EXT_direct_context")       \
+    X(alGetListenerfDirect,               "ALC_EXT_direct_context")       \
+    X(alGetListener3fDirect,              "ALC_EXT_direct_context")       \
+    X(alGetListenerfvDirect,              "ALC_EXT_direct_context")       \
+    X(alGetListeneriDirect,               "ALC_EXT_direct_context")       \
+    X(alGetListener3iDirect,              "ALC_EXT_direct_context")       \
+    X(alGetListenerivDirect,              "ALC_EXT_direct_context")       \
+    X(alGenSourcesDirect,                 "ALC_EXT_direct_context")       \
+    X(alDeleteSourcesDirect,              "ALC_EXT_direct_context")       \
+    X(alIsSourceDirect,                   "ALC_EXT_direct_context")       \
+    X(alSourcefDirect,                    "ALC_EXT_direct_context")       \
+    X(alSource3fDirect,                   "ALC_EXT_direct_context")       \
+    X(alSourcefvDirect,                   "ALC_EXT_direct_context")       \
+    X(alSourceiDirect,                    "ALC_EXT_direct_context")       \
+    X(alSource3iDirect,                   "ALC_EXT_direct_context")       \
+    X(alSourceivDirect,                   "ALC_EXT_direct_context")       \
+    X(alGetSourcefDirect,                 "ALC_EXT_direct_context")       \
+    X(alGetSource3fDirect,                "ALC_EXT_direct_context")       \
+    X(alGetSourcefvDirect,                "ALC_EXT_direct_context")       \
+    X(alGetSourceiDirect,                 "ALC_EXT_direct_context")       \
+    X(alGetSource3iDirect,                "ALC_EXT_direct_context")       \
+    X(alGetSourceivDirect,                "ALC_EXT_direct_context")       \
+    X(alSourcePlayDirect,                 "ALC_EXT_direct_context")       \
+    X(alSourceStopDirect,                 "ALC_EXT_direct_context")       \
+    X(alSourceRewindvDirect,              "ALC_EXT_direct_context")       \
+    X(alSourcePausevDirect,               "ALC_EXT_direct_context")       \
+    X(alSourcePlayvDirect,                "ALC_EXT_direct_context")       \
+    X(alSourceStopvDirect,                "ALC_EXT_direct_context")       \
+    X(alSourceRewindDirect,               "ALC_EXT_direct_context")       \
+    X(alSourcePauseDirect,                "ALC_EXT_direct_context")       \
+    X(alSourceQueueBuffersDirect,         "ALC_EXT_direct_context")       \
+    X(alSourceUnqueueBuffersDirect,       "ALC_EXT_direct_context")       \
+    X(alGenBuffersDirect,                 "ALC_EXT_direct_context")       \
+    X(alDeleteBuffersDirect,              "ALC_EXT_direct_context")       \
+    X(alIsBufferDirect,                   "ALC_EXT_direct_context")       \
+    X(alBufferDataDirect,                 "ALC_EXT_direct_context")       \
+    X(alBufferfDirect,                    "ALC_EXT_direct_context")       \
+    X(alBuffer3fDirect,                   "ALC_EXT_direct_context")       \
+    X(alBufferfvDirect,                   "ALC_EXT_direct_context")       \
+    X(alBufferiDirect,                    "ALC_EXT_direct_context")       \
+    X(alBuffer3iDirect,                   "ALC_EXT_direct_context")       \
+    X(alBufferivDirect,                   "ALC_EXT_direct_context")       \
+    X(alGetBufferfDirect,                 "ALC_EXT_direct_context")       \
+    X(alGetBuffer3fDirect,                "ALC_EXT_direct_context")       \
+    X(alGetBufferfvDirect,                "ALC_EXT_direct_context")       \
+    X(alGetBufferiDirect,                 "ALC_EXT_direct_context")       \
+    X(alGetBuffer3iDirect,                "ALC_EXT_direct_context")       \
+    X(alGetBufferivDirect,                "ALC_EXT_direct_context")       \
+    X(alGenEffectsDirect,                 "ALC_EXT_direct_context")       \
+    X(alDeleteEffectsDirect,              "ALC_EXT_direct_context")       \
+    X(alIsEffectDirect,                   "ALC_EXT_direct_context")       \
+    X(alEffectiDirect,                    "ALC_EXT_direct_context")       \
+    X(alEffectivDirect,                   "ALC_EXT_direct_context")       \
+    X(alEffectfDirect,                    "ALC_EXT_direct_context")       \
+    X(alEffectfvDirect,                   "ALC_EXT_direct_context")       \
+    X(alGetEffectiDirect,                 "ALC_EXT_direct_context")       \
+    X(alGetEffectivDirect,                "ALC_EXT_direct_context")       \
+    X(alGetEffectfDirect,                 "ALC_EXT_direct_context")       \
+    X(alGetEffectfvDirect,                "ALC_EXT_direct_context")       \
+    X(alGenFiltersDirect,                 "ALC_EXT_direct_context")       \
+    X(alDeleteFiltersDirect,              "ALC_EXT_direct_context")       \
+    X(alIsFilterDirect,                   "ALC_EXT_direct_context")       \
+    X(alFilteriDirect,                    "ALC_EXT_direct_context")       \
+    X(alFilterivDirect,                   "ALC_EXT_direct_context")       \
+    X(alFilterfDirect,                    "ALC_EXT_direct_context")       \
+    X(alFilterfvDirect,                   "ALC_EXT_direct_context")       \
+    X(alGetFilteriDirect,                 "ALC_EXT_direct_context")       \
+    X(alGetFilterivDirect,                "ALC_EXT_direct_context")       \
+    X(alGetFilterfDirect,                 "ALC_EXT_direct_context")       \
+    X(alGetFilterfvDirect,                "ALC_EXT_direct_context")       \
+    X(alGenAuxiliaryEffectSlotsDirect,    "ALC_EXT_direct_context")       \
+    X(alDeleteAuxiliaryEffectSlotsDirect, "ALC_EXT_direct_context")       \
+    X(alIsAuxiliaryEffectSlotDirect,      "ALC_EXT_direct_context")       \
+    X(alAuxiliaryEffectSlotiDirect,       "ALC_EXT_direct_context")       \
+    X(alAuxiliaryEffectSlotivDirect,      "ALC_EXT_direct_context")       \
+    X(alAuxiliaryEffectSlotfDirect,       "ALC_EXT_direct_context")       \
+    X(alAuxiliaryEffectSlotfvDirect,      "ALC_EXT_direct_context")       \
+    X(alGetAuxiliaryEffectSlotiDirect,    "ALC_EXT_direct_context")       \
+    X(alGetAuxiliaryEffectSlotivDirect,   "ALC_EXT_direct_context")       \
+    X(alGetAuxiliaryEffectSlotfDirect,    "ALC_EXT_direct_context")       \
+    X(alGetAuxiliaryEffectSlotfvDirect,   "ALC_EXT_direct_context")       \
+    X(alBufferDataStaticDirect,           "ALC_EXT_direct_context")       \
+    X(alDebugMessageCallbackDirectEXT,    "ALC_EXT_direct_context")       \
+    X(alDebugMessageInsertDirectEXT,      "ALC_EXT_direct_context")       \
+    X(alDebugMessageControlDirectEXT,     "ALC_EXT_direct_context")       \
+    X(alPushDebugGroupDirectEXT,          "ALC_EXT_direct_context")       \
+    X(alPopDebugGroupDirectEXT,           "ALC_EXT_direct_context")       \
+    X(alGetDebugMessageLogDirectEXT,      "ALC_EXT_direct_context")       \
+    X(alObjectLabelDirectEXT,             "ALC_EXT_direct_context")       \
+    X(alGetObjectLabelDirectEXT,          "ALC_EXT_direct_context")       \
+    X(alGetPointerDirectEXT,              "ALC_EXT_direct_context")       \
+    X(alGetPointervDirectEXT,             "ALC_EXT_direct_context")       \
+    X(alRequestFoldbackStartDirect,       "ALC_EXT_direct_context")       \
+    X(alRequestFoldbackStopDirect,        "ALC_EXT_direct_context")       \
+    X(alBufferSubDataDirectSOFT,          "ALC_EXT_direct_context")       \
+    X(alSourcedDirectSOFT,                "ALC_EXT_direct_context")       \
+    X(alSource3dDirectSOFT,               "ALC_EXT_direct_context")       \
+    X(alSourcedvDirectSOFT,               "ALC_EXT_direct_context")       \
+    X(alGetSourcedDirectSOFT,             "ALC_EXT_direct_context")       \
+    X(alGetSource3dDirectSOFT,            "ALC_EXT_direct_context")       \
+    X(alGetSourcedvDirectSOFT,            "ALC_EXT_direct_context")       \
+    X(alSourcei64DirectSOFT,              "ALC_EXT_direct_context")       \
+    X(alSource3i64DirectSOFT,             "ALC_EXT_direct_context")       \
+    X(alSourcei64vDirectSOFT,             "ALC_EXT_direct_context")       \
+    X(alGetSourcei64DirectSOFT,           "ALC_EXT_direct_context")       \
+    X(alGetSource3i64DirectSOFT,          "ALC_EXT_direct_context")       \
+    X(alGetSourcei64vDirectSOFT,          "ALC_EXT_direct_context")       \
+    X(alDeferUpdatesDirectSOFT,           "ALC_EXT_direct_context")       \
+    X(alProcessUpdatesDirectSOFT,         "ALC_EXT_direct_context")       \
+    X(alGetStringiDirectSOFT,             "ALC_EXT_direct_context")       \
+    X(alEventControlDirectSOFT,           "ALC_EXT_direct_context")       \
+    X(alEventCallbackDirectSOFT,          "ALC_EXT_direct_context")       \
+    X(alGetPointerDirectSOFT,             "ALC_EXT_direct_context")       \
+    X(alGetPointervDirectSOFT,            "ALC_EXT_direct_context")       \
+    X(alBufferCallbackDirectSOFT,         "ALC_EXT_direct_context")       \
+    X(alGetBufferPtrDirectSOFT,           "ALC_EXT_direct_context")       \
+    X(alGetBuffer3PtrDirectSOFT,          "ALC_EXT_direct_context")       \
+    X(alGetBufferPtrvDirectSOFT,          "ALC_EXT_direct_context")       \
+    X(alSourcePlayAtTimeDirectSOFT,       "ALC_EXT_direct_context")       \
+    X(alSourcePlayAtTimevDirectSOFT,      "ALC_EXT_direct_context")       \
+    X(EAXSetDirect,                       "ALC_EXT_direct_context")       \
+    X(EAXGetDirect,                       "ALC_EXT_direct_context")       \
+    X(EAXSetBufferModeDirect,             "ALC_EXT_direct_context")       \
+    X(EAXGetBufferModeDirect,             "ALC_EXT_direct_context")      
+
+/* the functions with an actual implementation, which the lists above leave out */
+#ifdef STUB_OPENAL_CORE_ONLY
+#define STUB_SPECIAL_EXTENSION_FUNCTIONS(X)
+#else
+#define STUB_SPECIAL_EXTENSION_FUNCTIONS(X) \
+    X(alcGetProcAddress2,    "ALC_EXT_direct_context")
+#endif
+#define STUB_SPECIAL_FUNCTIONS(X)            \
+    X(alGetError,            NULL)           \
+    X(alGetString,           NULL)           \
+    X(alIsExtensionPresent,  NULL)           \
+    X(alGetProcAddress,      NULL)           \
+    X(alcCreateContext,      NULL)           \
+    X(alcMakeContextCurrent, NULL)           \
+    X(alcDestroyContext,     NULL)           \
+    X(alcGetCurrentContext,  NULL)           \
+    X(alcGetContextsDevice,  NULL)           \
+    X(alcOpenDevice,         NULL)           \
+    X(alcCloseDevice,        NULL)           \
+    X(alcGetError,           NULL)           \
+    X(alcIsExtensionPresent, NULL)           \
+    X(alcGetProcAddress,     NULL)           \
+    X(alcGetString,          NULL)           \
+    STUB_SPECIAL_EXTENSION_FUNCTIONS(X)
+
+
+
+/* no-op exports */
+#define STUB_DEFINE_(name, extension) STUB_EXPORT void name (void) { }
+STUB_CORE_FUNCTIONS(STUB_DEFINE_)
+#ifndef STUB_OPENAL_CORE_ONLY
+STUB_EXTENSION_FUNCTIONS(STUB_DEFINE_)
+#endif
+#undef STUB_DEFINE_
+
+
+
+/* advertised extensions */
+#ifdef STUB_OPENAL_CORE_ONLY
+#define STUB_ALL_EXTENSIONS ""
+#else
+#define STUB_ALL_EXTENSIONS                                                                                         \
+    "ALC_EXT_EFX ALC_EXT_thread_local_context ALC_SOFT_loopback ALC_SOFT_pause_device ALC_SOFT_HRTF "               \
+    "ALC_SOFT_device_clock ALC_SOFT_reopen_device ALC_SOFT_system_events ALC_EXT_direct_context "                   \
+    "AL_EXT_STATIC_BUFFER AL_SOFT_buffer_sub_data AL_EXT_FOLDBACK AL_SOFT_buffer_samples AL_SOFT_source_latency "   \
+    "AL_SOFT_deferred_updates AL_SOFT_source_resampler AL_SOFT_events AL_SOFT_callback_buffer "                     \
+    "AL_SOFT_source_start_delay AL_EXT_debug"
+#endif
+
+static int  stub_initialized_ = 0;
+static char stub_al_extensions_[1024];
+static char stub_alc_extensions_[1024];
+
+/* checks for a whole word in a space separated list */
+static int stub_has_word_ (const char *list, const char *word) {
+    size_t length = strlen(word);
+    const char *p = list;
+    if (length == 0) return 0;
+    while ((p = strstr(p, word)) != NULL) {
+        if ((p == list || p[-1] == ' ') && (p[length] == ' ' || p[length] == '\0')) return 1;
+        p += length;
+    }
+    return 0;
+}
+/* splits the enabled extensions into the AL and ALC extension strings */
+static void stub_init_extensions_ (void) {
+    const char *enabled = getenv("STUB_OPENAL_EXTENSIONS");
+    const char *p = STUB_ALL_EXTENSIONS;
+    if (stub_initialized_) return;
+    stub_initialized_ = 1;
+    if (enabled == NULL) enabled = STUB_ALL_EXTENSIONS;
+    while (*p != '\0') {
+        char word[64];
+        size_t length = strcspn(p, " ");
+        if (length < sizeof(word)) {
+            char *target = strncmp(p, "ALC_", 4) == 0 ? stub_alc_extensions_ : stub_al_extensions_;
+            memcpy(word, p, length);
+            word[length] = '\0';
+            if (stub_has_word_(enabled, word)) {
+                if (target[0] != '\0') strcat(target, " ");
+                strcat(target, word);
+            }
+        }
+        p += length;
+        while (*p == ' ') p++;
+    }
+}
+static int stub_extension_enabled_ (const char *extension) {
+    if (extension == NULL) return 1;
+    stub_init_extensions_();
+    return stub_has_word_(strncmp(extension, "ALC_", 4) == 0 ? stub_alc_extensions_ : stub_al_extensions_, extension);
+}
+
+
+
+/* call counters for the benchmark, which looks this up with dlsym */
+typedef struct stubOpenALCounters {
+    unsigned long al_get_proc_address;
+    unsigned long alc_get_proc_address;
+} stubOpenALCounters;
+STUB_EXPORT stubOpenALCounters stubOpenALCallCounters = {0, 0};
+
+
+
+/* fake device and context, only their addresses are used */
+static int   stub_device_;
+static int   stub_context_;
+static void *stub_current_context_ = NULL;
+
+STUB_EXPORT int   alGetError (void) { return 0; }
+STUB_EXPORT const char *alGetString (int param) {
+    stub_init_extensions_();
+    switch (param) {
+        case 0xB001: return "stub";                 /* AL_VENDOR */
+        case 0xB002: return "1.1 stub";             /* AL_VERSION */
+        case 0xB003: return "stub-openal";          /* AL_RENDERER */
+        case 0xB004: return stub_al_extensions_;    /* AL_EXTENSIONS */
+        default:     return NULL;
+    }
+}
+STUB_EXPORT char  alIsExtensionPresent (const char *name) { return (char) (name != NULL && stub_extension_enabled_(name)); }
+
+STUB_EXPORT void *alcCreateContext (void *device, const int *attributes) { (void) attributes; return device == &stub_device_ ? &stub_context_ : NULL; }
+STUB_EXPORT char  alcMakeContextCurrent (void *context) { stub_current_context_ = context; return 1; }
+STUB_EXPORT void  alcDestroyContext (void *context) { if (stub_current_context_ == context) stub_current_context_ = NULL; }
+STUB_EXPORT void *alcGetCurrentContext (void) { return stub_current_context_; }
+STUB_EXPORT void *alcGetContextsDevice (void *context) { return context == &stub_context_ ? &stub_device_ : NULL; }
+STUB_EXPORT void *alcOpenDevice (const char *name) { (void) name; return &stub_device_; }
+STUB_EXPORT char  alcCloseDevice (void *device) { return (char) (device == &stub_device_); }
+STUB_EXPORT int   alcGetError (void *device) { (void) device; return 0; }
+STUB_EXPORT char  alcIsExtensionPresent (void *device, const char *name) { (void) device; return (char) (name != NULL && stub_extension_enabled_(name)); }
+STUB_EXPORT const char *alcGetString (void *device, int param) {
+    (void) device;
+    stub_init_extensions_();
+    switch (param) {
+        case 0x1004: return "stub";                 /* ALC_DEFAULT_DEVICE_SPECIFIER */
+        case 0x1005: return "stub\0";               /* ALC_DEVICE_SPECIFIER */
+        case 0x1006: return stub_alc_extensions_;   /* ALC_EXTENSIONS */
+        default:     return NULL;
+    }
+}
+
+
+
+/* defined below, after the lookup table */
+STUB_EXPORT stub_function_ alGetProcAddress (const char *name);
+STUB_EXPORT stub_function_ alcGetProcAddress (void *device, const char *name);
+#ifndef STUB_OPENAL_CORE_ONLY
+STUB_EXPORT stub_function_ alcGetProcAddress2 (void *device, const char *name);
+#endif
+
+/* name lookup, sorted on first use so that the lookup itself doesn't dominate the measurements */
+typedef struct stub_entry_ {
+    const char     *name;
+    stub_function_  function;
+    const char     *extension;
+} stub_entry_;
+
+#define STUB_ENTRY_(name, extension) { #name, (stub_function_) name, extension },
+static stub_entry_ stub_entries_[] = {
+    STUB_SPECIAL_FUNCTIONS(STUB_ENTRY_)
+    STUB_CORE_FUNCTIONS(STUB_ENTRY_)
+#ifndef STUB_OPENAL_CORE_ONLY
+    STUB_EXTENSION_FUNCTIONS(STUB_ENTRY_)
+#endif
+};
+#undef STUB_ENTRY_
+static const size_t stub_entry_count_ = sizeof(stub_entries_) / sizeof(stub_entries_[0]);
+static int stub_sorted_ = 0;
+
+static int stub_compare_ (const void *a, const void *b) {
+    return strcmp(((const stub_entry_*) a)->name, ((const stub_entry_*) b)->name);
+}
+static stub_function_ stub_lookup_ (const char *name) {
+    stub_entry_ key;
+    const stub_entry_ *entry;
+    if (name == NULL) return NULL;
+    if (!stub_sorted_) {
+        qsort(stub_entries_, stub_entry_count_, sizeof(stub_entry_), stub_compare_);
+        stub_sorted_ = 1;
+    }
+    key.name = name;
+    entry = (const stub_entry_*) bsearch(&key, stub_entries_, stub_entry_count_, sizeof(stub_entry_), stub_compare_);
+    if (entry == NULL || !stub_extension_enabled_(entry->extension)) return NULL;
+    return entry->function;
+}
+
+STUB_EXPORT stub_function_ alGetProcAddress (const char *name) {
+    stubOpenALCallCounters.al_get_proc_address++;
+    return stub_lookup_(name);
+}
+STUB_EXPORT stub_function_ alcGetProcAddress (void *device, const char *name) {
+    (void) device;
+    stubOpenALCallCounters.alc_get_proc_address++;
+    return stub_lookup_(name);
+}
+#ifndef STUB_OPENAL_CORE_ONLY
+STUB_EXPORT stub_function_ alcGetProcAddress2 (void *device, const char *name) {
+    (void) device;
+    stubOpenALCallCounters.alc_get_proc_address++;
+    return stub_lookup_(name);
+}
+#endif
@@ -5,7 +5,7 @@
 
 
 /* to separate listener- and context-dependency */
-typedef ALlistener *ALCdevice;
+typedef ALCcontext* ALlistener;
 
 
 
@@ -29,6 +29,8 @@ typedef ALlistener *ALCdevice;
 void            alGenBuffersExplicitEXT         (ALCdevice* device, ALsizei n, ALuint *buffers);
 void            alDeleteBuffersExplicitEXT      (ALCdevice* device, ALsizei n, const ALuint *buffers);
 ALboolean       alIsBufferExplicitEXT           (ALCdevice* device, ALuint buffer);
+/* destroys the helper context these keep for the device; alcCloseDevice does this by itself if alad.h was loaded with aladLoadAL */
+void            alexpReleaseHelperContexts      (ALCdevice* device);
 
 
 /* Function prototypes for added context references: */
@@ -48,7 +50,7 @@ ALboolean       alGetBooleanExplicitEXT         (ALCcontext* context, ALenum par
 ALint           alGetIntegerExplicitEXT         (ALCcontext* context, ALenum param);
 ALfloat         alGetFloatExplicitEXT           (ALCcontext* context, ALenum param);
 ALdouble        alGetDoubleExplicitEXT          (ALCcontext* context, ALenum param);
-ALenum          alGetErrorExplicitEXT           (ALCcontext* context, void);
+ALenum          alGetErrorExplicitEXT           (ALCcontext* context);
 ALboolean       alIsExtensionPresentExplicitEXT (ALCcontext* context, const ALchar *extname);
 void*           alGetProcAddressExplicitEXT     (ALCcontext* context, const ALchar *fname);
 ALenum          alGetEnumValueExplicitEXT       (ALCcontext* context, const ALchar *ename);
@@ -62,6 +64,38 @@ void            alSourceRewindvExplicitEXT      (ALCcontext* context, ALsizei n,
 void            alSourcePausevExplicitEXT       (ALCcontext* context, ALsizei n, const ALuint *sources);
 
 
+/*
+ * Function prototypes routed by the object:
+ * the Gen and Delete functions above remember which context each source and which device each buffer belongs to, so these find it
+ * by themselves. IDs that weren't generated through them are used with the current context (the calling thread's, if it has one of
+ * its own). So are IDs that two contexts (or devices) have handed out at once, which can't be told apart by the ID alone, until all but
+ * one of the owners have deleted theirs; test/polyfill-routes.c checks this.
+ */
+void            alSourcefExplicitEXT            (ALuint source, ALenum param, ALfloat value);
+void            alSource3fExplicitEXT           (ALuint source, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3);
+void            alSourcefvExplicitEXT           (ALuint source, ALenum param, const ALfloat *values);
+void            alSourceiExplicitEXT            (ALuint source, ALenum param, ALint value);
+void            alSource3iExplicitEXT           (ALuint source, ALenum param, ALint value1, ALint value2, ALint value3);
+void            alSourceivExplicitEXT           (ALuint source, ALenum param, const ALint *values);
+void            alGetSourcefExplicitEXT         (ALuint source, ALenum param, ALfloat *value);
+void            alGetSource3fExplicitEXT        (ALuint source, ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3);
+void            alGetSourcefvExplicitEXT        (ALuint source, ALenum param, ALfloat *values);
+void            alGetSourceiExplicitEXT         (ALuint source, ALenum param, ALint *value);
+void            alGetSource3iExplicitEXT        (ALuint source, ALenum param, ALint *value1, ALint *value2, ALint *value3);
+void            alGetSourceivExplicitEXT        (ALuint source, ALenum param, ALint *values);
+void            alSourcePlayExplicitEXT         (ALuint source);
+void            alSourceStopExplicitEXT         (ALuint source);
+void            alSourceRewindExplicitEXT       (ALuint source);
+void            alSourcePauseExplicitEXT        (ALuint source);
+void            alSourceQueueBuffersExplicitEXT (ALuint source, ALsizei nb, const ALuint *buffers);
+void            alSourceUnqueueBuffersExplicitEXT (ALuint source, ALsizei nb, ALuint *buffers);
+void            alBufferDataExplicitEXT         (ALuint buffer, ALenum format, const ALvoid *data, ALsizei size, ALsizei samplerate);
+void            alBufferfExplicitEXT            (ALuint buffer, ALenum param, ALfloat value);
+void            alBufferiExplicitEXT            (ALuint buffer, ALenum param, ALint value);
+void            alGetBufferfExplicitEXT         (ALuint buffer, ALenum param, ALfloat *value);
+void            alGetBufferiExplicitEXT         (ALuint buffer, ALenum param, ALint *value);
+
+
 /* Function prototypes for added listener references: */
 
 void            alListenerfExplicitEXT          (ALlistener listener, ALenum param, ALfloat value);
@@ -81,33 +115,211 @@ void            alGetListenerivExplicitEXT      (ALlistener listener, ALenum par
 
 
 
-/* New functions that currently do basically nothing, but could be expanded upon */
+/*
+ * Batches of explicit calls: between alexpBeginBatch and alexpSubmitBatch, the calls above that don't return anything and only set state
+ * (alDopplerFactor, alDopplerVelocity, alSpeedOfSound, alDistanceModel, alEnable, alDisable, the alListener setters, alSourcePlayv,
+ * alSourceStopv, alSourceRewindv and alSourcePausev, and of those routed by the object below, the alSource setters and alSourcePlay,
+ * alSourceStop, alSourceRewind and alSourcePause) are only recorded. alexpSubmitBatch then sorts them by context and replays them with
+ * one context switch per context, inside alDeferUpdatesSOFT and alProcessUpdatesSOFT if those are loaded, so each context applies its
+ * share at once. The calls with a result still run right away, so they don't see what's recorded yet. There is only one batch, so only
+ * one thread at a time may record; the memory for it is kept for the next batch until alexpFreeBatch.
+ */
+void            alexpBeginBatch                 (void);
+void            alexpSubmitBatch                (void);
+void            alexpFreeBatch                  (void);
+
+
+
+/*
+ * New functions for additional listeners on the same sources, for example for split screen:
+ * with ALC_SOFT_loopback, alCreateListenerEXT makes a listener that hears copies of the sources and buffers of the context (and its device)
+ * that the polyfill knows, and follows the changes made to them through the polyfill; without it, or once ALEXP_LISTENERS are in use,
+ * the listener is the context itself, as before. Only the *ExplicitEXT functions above (also when recorded in a batch) are seen by the
+ * polyfill: objects generated and changes made with the plain functions of aladAL don't reach the listeners. The sources and buffers
+ * there already when the listener is created are copied with the properties the driver can report, which doesn't include the data of
+ * a buffer; define ALEXP_LISTENER_BUFFER_DATA to have the polyfill keep a copy of each buffer's data for that. Every listener holds its
+ * own copy of the data of every buffer on the device, so memory for buffers grows by one copy per listener (plus one with
+ * ALEXP_LISTENER_BUFFER_DATA), and alBufferDataExplicitEXT copies the data once per listener. Their stereo float output at the frequency of the
+ * context's device is added up by alRenderListenersEXT, which alexpListenerBufferCallback calls for alBufferCallbackSOFT with the
+ * context as user pointer, so a source with AL_DIRECT_CHANNELS_SOFT can play all listeners on the real device. The listeners render in
+ * parallel with an ALEXPtaskrunner, which has to call task(data, i) for each i below count and return once all have run, for example
+ * on the engine's job system. Listeners can be created and destroyed while the mixer renders them, alDestroyListenerEXT waits for a
+ * render that still uses the listener; they have to be destroyed before their context. Rendering doesn't allocate memory.
+ */
 ALlistener      alCreateListenerEXT             (ALCcontext* context);
 ALboolean       alIsListenerinContextEXT        (ALCcontext* context, ALlistener listener);
 void            alDestroyListenerEXT            (ALCcontext* context, ALlistener listener);
+void            alRenderListenersEXT            (ALCcontext* context, ALfloat* samples, ALsizei frames);
+ALsizei AL_APIENTRY alexpListenerBufferCallback     (ALvoid* userptr, ALvoid* sampledata, ALsizei numbytes);
+typedef void (*ALEXPtaskrunner) (void* user, ALsizei count, void (*task) (void* data, ALsizei index), void* data);
+void            alexpSetListenerTaskRunner      (ALEXPtaskrunner runner, void* user);
 
 
 
 #ifdef OPENAL_EXPLICIT_POLYFILL_IMPLEMENTATION
 
+#include <stdlib.h>
+
+/*
+ * atomics, for the state other threads use at the same time; the loads acquire, the stores release, the exchange does both, and the
+ * adds are sequentially consistent, so of two threads that each add to one counter and then add 0 to the other, one sees the other's
+ */
+#if defined(__GNUC__) || defined(__clang__)
+static long alexp_atomic_load_long_ (volatile long* p)              { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+static void alexp_atomic_store_long_ (volatile long* p, long v)     { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+static long alexp_atomic_exchange_long_ (volatile long* p, long v)  { return __atomic_exchange_n(p, v, __ATOMIC_ACQ_REL); }
+static long alexp_atomic_add_long_ (volatile long* p, long v)       { return __atomic_add_fetch(p, v, __ATOMIC_SEQ_CST); }
+#elif defined(_MSC_VER)
+#include <intrin.h>
+static long alexp_atomic_load_long_ (volatile long* p)              { return _InterlockedCompareExchange(p, 0, 0); }
+static void alexp_atomic_store_long_ (volatile long* p, long v)     { _InterlockedExchange(p, v); }
+static long alexp_atomic_exchange_long_ (volatile long* p, long v)  { return _InterlockedExchange(p, v); }
+static long alexp_atomic_add_long_ (volatile long* p, long v)       { return _InterlockedExchangeAdd(p, v) + v; }
+#else
+/* no known atomics, so this is only safe as long as a single thread uses the polyfill */
+static long alexp_atomic_load_long_ (volatile long* p)              { return *p; }
+static void alexp_atomic_store_long_ (volatile long* p, long v)     { *p = v; }
+static long alexp_atomic_exchange_long_ (volatile long* p, long v)  { long old = *p; *p = v; return old; }
+static long alexp_atomic_add_long_ (volatile long* p, long v)       { return *p += v; }
+#endif
+static void alexp_spin_lock_ (volatile long* lock) {
+    while(alexp_atomic_exchange_long_(lock, 1) != 0) {
+        while(alexp_atomic_load_long_(lock) != 0);
+    }
+}
+static void alexp_spin_unlock_ (volatile long* lock) {
+    alexp_atomic_store_long_(lock, 0);
+}
+
+/* guards the helper contexts, the direct table and the callbacks chained into alad.h below */
+static volatile long alexp_lock_ = 0;
+
+/*
+ * Buffers belong to a device, so the device functions need some context on it to be current. Creating one starts up the mixer in most
+ * implementations, so each device gets one helper context on first use, which is kept until the device is closed. If more than
+ * ALEXP_HELPER_CONTEXTS devices are used that way at once, the others fall back to a temporary context per call. The driver is only
+ * called outside the lock, so a thread creating or destroying a helper context doesn't hold up the others.
+ */
+#ifndef ALEXP_HELPER_CONTEXTS
+#define ALEXP_HELPER_CONTEXTS 16
+#endif
+typedef struct alexp_helper_context_t_ {
+    ALCdevice*  device;
+    ALCcontext* context;
+} alexp_helper_context_t_;
+static alexp_helper_context_t_ alexp_helper_contexts_[ALEXP_HELPER_CONTEXTS];
+static aladCloseDeviceCallback alexp_next_close_device_callback_ = NULL;
+static int alexp_close_device_callback_set_ = 0;
+
+void            alexpReleaseHelperContexts      (ALCdevice* device) {
+    ALCcontext* contexts[ALEXP_HELPER_CONTEXTS];
+    size_t i, count = 0;
+    if(device == NULL) return;
+    alexp_spin_lock_(&alexp_lock_);
+    for(i = 0; i < ALEXP_HELPER_CONTEXTS; i++) {
+        if(alexp_helper_contexts_[i].device != device) continue;
+        contexts[count++] = alexp_helper_contexts_[i].context;
+        alexp_helper_contexts_[i].device = NULL;
+        alexp_helper_contexts_[i].context = NULL;
+    }
+    alexp_spin_unlock_(&alexp_lock_);
+    for(i = 0; i < count; i++) alcDestroyContext(contexts[i]);
+}
+/* the driver won't close a device that still has contexts, so they have to go first */
+static void alexp_close_device_ (ALCdevice* device) {
+    alexpReleaseHelperContexts(device);
+    if(alexp_next_close_device_callback_ != NULL) alexp_next_close_device_callback_(device);
+}
+/* the device's helper context, or NULL with a free slot written to freeSlot (NULL if there is none); alexp_lock_ has to be held */
+static ALCcontext* alexp_find_helper_context_ (ALCdevice* device, alexp_helper_context_t_** freeSlot) {
+    size_t i;
+    *freeSlot = NULL;
+    for(i = 0; i < ALEXP_HELPER_CONTEXTS; i++) {
+        if(alexp_helper_contexts_[i].device == device) return alexp_helper_contexts_[i].context;
+        if(*freeSlot == NULL && alexp_helper_contexts_[i].device == NULL) *freeSlot = &alexp_helper_contexts_[i];
+    }
+    return NULL;
+}
+/* returns NULL if there is no free slot or the context can't be created; if another thread sets one up for the device at the same time,
+   the one that comes second destroys its own and uses the other */
+static ALCcontext* alexp_helper_context_ (ALCdevice* device) {
+    alexp_helper_context_t_ *slot;
+    ALCcontext *context, *created;
+    alexp_spin_lock_(&alexp_lock_);
+    context = alexp_find_helper_context_(device, &slot);
+    if(context == NULL && slot != NULL && !alexp_close_device_callback_set_) {
+        alexp_next_close_device_callback_ = aladSetCloseDeviceCallback(alexp_close_device_);
+        alexp_close_device_callback_set_ = 1;
+    }
+    alexp_spin_unlock_(&alexp_lock_);
+    if(context != NULL || slot == NULL) return context;
+    created = alcCreateContext(device, NULL);
+    if(created == NULL) return NULL;
+    alexp_spin_lock_(&alexp_lock_);
+    context = alexp_find_helper_context_(device, &slot);
+    if(context == NULL && slot != NULL) {
+        slot->device = device;
+        slot->context = created;
+    }
+    alexp_spin_unlock_(&alexp_lock_);
+    if(context == NULL && slot != NULL) return created;
+    alcDestroyContext(created);
+    return context;
+}
+
+
+/*
+ * With ALC_EXT_thread_local_context (loaded by aladUpdateAL), only the calling thread's context is switched, which neither takes the
+ * global lock nor disturbs other threads. Without it, or if the driver turns the thread context down, the global one is switched as before;
+ * a thread context the calling thread has set is cleared for that, since the global context has no effect on a thread that has one.
+ */
+/* the context the calling thread is using; its own thread context (or NULL if it has none) is written to threadContext */
+static ALCcontext* alexp_get_context_ (ALCcontext** threadContext) {
+    *threadContext = alcGetThreadContext != NULL ? alcGetThreadContext() : NULL;
+    return *threadContext != NULL ? *threadContext : alcGetCurrentContext();
+}
+/* returns ALC_TRUE if only the thread context was switched; otherwise threadContext, the one set now, is cleared, and the global context
+   before the switch is written to globalContext */
+static ALCboolean alexp_switch_context_ (ALCcontext* context, ALCcontext* threadContext, ALCcontext** globalContext) {
+    if(alcSetThreadContext != NULL && alcSetThreadContext(context) != ALC_FALSE) return ALC_TRUE;
+    if(threadContext != NULL) alcSetThreadContext(NULL);
+    *globalContext = alcGetCurrentContext();
+    alcMakeContextCurrent(context);
+    return ALC_FALSE;
+}
+/* undoes the switches: the global context if it was switched, and the thread context if it was switched or cleared for that */
+static void alexp_restore_context_ (ALCboolean threadSwitched, ALCboolean globalSwitched, ALCcontext* threadContext, ALCcontext* globalContext) {
+    if(globalSwitched) alcMakeContextCurrent(globalContext);
+    if(threadSwitched || (globalSwitched && threadContext != NULL)) alcSetThreadContext(threadContext);
+}
+
 
 #define ALEXP_DEVICE_WRAP(device, code)                                     \
             do {                                                            \
-                ALCcontext* oldContext, helperContext;                      \
+                ALCcontext* oldContext;                                     \
+                ALCcontext* threadContext;                                  \
+                ALCcontext* globalContext = NULL;                           \
+                ALCcontext* helperContext = NULL;                           \
                 ALCdevice*  oldDevice;                                      \
+                ALCboolean  threadLocal = ALC_FALSE;                        \
+                int         temporary = 0;                                  \
                                                                             \
-                oldContext = alcGetCurrentContext();                        \
+                oldContext = alexp_get_context_(&threadContext);            \
                 oldDevice = alcGetContextsDevice(oldContext);               \
                 if(oldDevice != device) {                                   \
-                    helperContext = alcCreateContext(device, NULL);         \
-                    alcMakeContextCurrent(helperContext);                   \
+                    helperContext = alexp_helper_context_(device);          \
+                    if(helperContext == NULL) {                             \
+                        helperContext = alcCreateContext(device, NULL);     \
+                        temporary = 1;                                      \
+                    }                                                       \
+                    threadLocal = alexp_switch_context_(helperContext, threadContext, &globalContext); \
                 }                                                           \
                                                                             \
                 (code);                                                     \
                                                                             \
                 if(oldDevice != device) {                                   \
-                    alcMakeContextCurrent(oldContext);                      \
-                    alcDestroyContext(helperContext);                       \
+                    alexp_restore_context_(threadLocal, !threadLocal, threadContext, globalContext); \
+                    if(temporary) alcDestroyContext(helperContext);         \
                 }                                                           \
             } while(0);                                                     
             
@@ -115,33 +327,856 @@ void            alDestroyListenerEXT            (ALCcontext* context, ALlistener
 #define ALEXP_CONTEXT_WRAP(context, code)                                   \
             do {                                                            \
               ALCcontext* oldContext;                                       \
+              ALCcontext* threadContext;                                    \
+              ALCcontext* globalContext = NULL;                             \
+              ALCboolean  threadLocal = ALC_FALSE;                          \
                                                                             \
-              oldContext = alcGetCurrentContext();                          \
+              oldContext = alexp_get_context_(&threadContext);              \
               if(oldContext != context) {                                   \
-                  alcMakeContextCurrent(context);                           \
+                  threadLocal = alexp_switch_context_(context, threadContext, &globalContext); \
               }                                                             \
                                                                             \
               (code);                                                       \
                                                                             \
               if(oldContext != context) {                                   \
-                  alcMakeContextCurrent(oldContext);                        \
+                  alexp_restore_context_(threadLocal, !threadLocal, threadContext, globalContext); \
               }                                                             \
             } while(0);                                                     
 
+/*
+ * With AL_EXT_direct_context, the functions below call its *Direct versions instead, which take the context as their first parameter,
+ * so nothing has to be switched at all. That is only tried if aladUpdateAL found ALC_EXT_direct_context among the extensions without a
+ * device; the functions are then loaded with alcGetProcAddress2 by the first thread that needs them (the others wait for it), and again
+ * after the next aladLoadAL or aladUpdateAL, which call alexp_direct_update_. Those the driver doesn't have are emulated.
+ */
+static aladDirectFunctions alexp_direct_;
+static aladDirectFunctions alexp_no_direct_;
+static volatile long alexp_direct_loaded_ = 0;
+static aladUpdateCallback alexp_next_update_callback_ = NULL;
+static int alexp_update_callback_set_ = 0;
+static void alexp_direct_update_ (void) {
+    alexp_spin_lock_(&alexp_lock_);
+    alexp_atomic_store_long_(&alexp_direct_loaded_, 0);
+    alexp_spin_unlock_(&alexp_lock_);
+    if(alexp_next_update_callback_ != NULL) alexp_next_update_callback_();
+}
+static const aladDirectFunctions* alexp_direct_functions_ (void) {
+    if(!aladHasALCExtension(NULL, ALAD_ALC_EXT_direct_context)) return &alexp_no_direct_;
+    if(!alexp_atomic_load_long_(&alexp_direct_loaded_)) {
+        alexp_spin_lock_(&alexp_lock_);
+        if(!alexp_direct_loaded_) {
+            if(!alexp_update_callback_set_) {
+                alexp_next_update_callback_ = aladSetUpdateCallback(alexp_direct_update_);
+                alexp_update_callback_set_ = 1;
+            }
+            aladLoadDirectExtensionEx(&alexp_direct_, aladDirectDeviceLoader, NULL);
+            alexp_atomic_store_long_(&alexp_direct_loaded_, 1);
+        }
+        alexp_spin_unlock_(&alexp_lock_);
+    }
+    return &alexp_direct_;
+}
+/* a context on the device to pass to the *Direct functions: the calling thread's if it's on the device, otherwise the helper context */
+static ALCcontext* alexp_device_context_ (ALCdevice* device) {
+    ALCcontext* threadContext;
+    ALCcontext* context = alexp_get_context_(&threadContext);
+    if(context != NULL && alcGetContextsDevice(context) == device) return context;
+    return alexp_helper_context_(device);
+}
+
+/*
+ * Which context a source and which device a buffer belongs to, as open addressing hash maps from the ID with linear probing. An entry
+ * is an ID, the ID of its copy for the listeners below, how many buffers that copy still has to unqueue, and a pointer, so a lookup
+ * usually stays within one or two cache lines.
+ * ID 0 marks an empty slot, since no object has it. Every context numbers its sources on its own (and every device its buffers), so
+ * an entry is keyed by the ID together with its owner, and the entries of one ID are all in the probe chain from its slot.
+ * With ALEXP_LISTENER_BUFFER_DATA defined, a buffer's entry also keeps a copy of the data last given to alBufferDataExplicitEXT, so
+ * that a listener created later can be given it too (see alCreateListenerEXT).
+ */
+typedef struct alexp_route_t_ {
+    ALuint  id;
+    ALuint  mirror;
+    ALsizei unqueue;
+    void*   owner;
+#ifdef ALEXP_LISTENER_BUFFER_DATA
+    void*   data;
+    ALsizei size;
+    ALsizei samplerate;
+    ALenum  format;
+#endif
+} alexp_route_t_;
+typedef struct alexp_routes_t_ {
+    alexp_route_t_* entries;
+    size_t          mask;
+    size_t          used;
+} alexp_routes_t_;
+static alexp_routes_t_ alexp_source_routes_ = { NULL, 0, 0 };
+static alexp_routes_t_ alexp_buffer_routes_ = { NULL, 0, 0 };
+/* marks entries whose objects were deleted, so the probing continues past them */
+static char alexp_route_deleted_;
+
+static size_t alexp_route_slot_ (const alexp_routes_t_* routes, ALuint id) {
+    return (size_t) (id * 2654435761u) & routes->mask;
+}
+static alexp_route_t_* alexp_find_route_ (const alexp_routes_t_* routes, ALuint id, void* owner) {
+    size_t slot;
+    if(routes->entries == NULL || id == 0) return NULL;
+    for(slot = alexp_route_slot_(routes, id); routes->entries[slot].id != 0; slot = (slot + 1) & routes->mask) {
+        if(routes->entries[slot].id == id && routes->entries[slot].owner == owner) return &routes->entries[slot];
+    }
+    return NULL;
+}
+/* rehashes into twice the size (or the same size, if it's mostly deleted entries); returns AL_FALSE if there's no memory left */
+static ALboolean alexp_grow_routes_ (alexp_routes_t_* routes) {
+    alexp_routes_t_ grown;
+    size_t i, live = 0, size;
+    for(i = 0; routes->entries != NULL && i <= routes->mask; i++) {
+        if(routes->entries[i].id != 0 && routes->entries[i].owner != &alexp_route_deleted_) live++;
+    }
+    size = routes->entries != NULL ? routes->mask + 1 : 64;
+    while(live * 4 >= size) size *= 2;
+    grown.entries = REINTERPRET_CAST(alexp_route_t_*, calloc(size, sizeof(alexp_route_t_)));
+    if(grown.entries == NULL) return AL_FALSE;
+    grown.mask = size - 1;
+    grown.used = live;
+    for(i = 0; routes->entries != NULL && i <= routes->mask; i++) {
+        size_t slot;
+        if(routes->entries[i].id == 0 || routes->entries[i].owner == &alexp_route_deleted_) continue;
+        for(slot = alexp_route_slot_(&grown, routes->entries[i].id); grown.entries[slot].id != 0; slot = (slot + 1) & grown.mask);
+        grown.entries[slot] = routes->entries[i];
+    }
+    free(routes->entries);
+    *routes = grown;
+    return AL_TRUE;
+}
+/* returns the owner's entry for the ID, which is added if it's new, or NULL if there's no memory left */
+static alexp_route_t_* alexp_add_route_ (alexp_routes_t_* routes, ALuint id, void* owner) {
+    alexp_route_t_* route = alexp_find_route_(routes, id, owner);
+    size_t slot;
+    if(id == 0) return NULL;
+    if(route != NULL) return route;
+    /* at most half the slots are in use, counting the deleted ones, so the probing stays short */
+    if((routes->used + 1) * 2 > routes->mask + 1 && !alexp_grow_routes_(routes)) return NULL;
+    for(slot = alexp_route_slot_(routes, id); routes->entries[slot].id != 0; slot = (slot + 1) & routes->mask);
+    routes->entries[slot].id = id;
+    routes->entries[slot].mirror = 0;
+    routes->entries[slot].unqueue = 0;
+    routes->entries[slot].owner = owner;
+#ifdef ALEXP_LISTENER_BUFFER_DATA
+    routes->entries[slot].data = NULL;
+#endif
+    routes->used++;
+    return &routes->entries[slot];
+}
+/* the global maps below are used from any thread, so these take alexp_lock_; growing frees the old entries, which nobody may still read */
+static void alexp_add_routes_ (alexp_routes_t_* routes, ALsizei n, const ALuint* ids, void* owner) {
+    ALsizei i;
+    alexp_spin_lock_(&alexp_lock_);
+    for(i = 0; i < n; i++) alexp_add_route_(routes, ids[i], owner);
+    alexp_spin_unlock_(&alexp_lock_);
+}
+/* only removes the owner's own entries, the other owners of the same IDs still have their objects */
+static void alexp_remove_routes_ (alexp_routes_t_* routes, ALsizei n, const ALuint* ids, void* owner) {
+    ALsizei i;
+    if(ids == NULL) return;
+    alexp_spin_lock_(&alexp_lock_);
+    for(i = 0; i < n; i++) {
+        alexp_route_t_* route = alexp_find_route_(routes, ids[i], owner);
+        if(route == NULL) continue;
+        route->owner = &alexp_route_deleted_;
+#ifdef ALEXP_LISTENER_BUFFER_DATA
+        free(route->data);
+        route->data = NULL;
+#endif
+    }
+    alexp_spin_unlock_(&alexp_lock_);
+}
+/* the IDs the owner has in the map, in a new array; NULL if there are none or there's no memory left */
+static ALuint* alexp_route_ids_ (const alexp_routes_t_* routes, void* owner, ALsizei* count) {
+    ALuint* ids = NULL;
+    size_t i;
+    *count = 0;
+    alexp_spin_lock_(&alexp_lock_);
+    for(i = 0; routes->entries != NULL && i <= routes->mask; i++) {
+        if(routes->entries[i].id != 0 && routes->entries[i].owner == owner) (*count)++;
+    }
+    if(*count != 0) ids = REINTERPRET_CAST(ALuint*, malloc((size_t) *count * sizeof(ALuint)));
+    for(i = 0, *count = 0; ids != NULL && i <= routes->mask; i++) {
+        if(routes->entries[i].id != 0 && routes->entries[i].owner == owner) ids[(*count)++] = routes->entries[i].id;
+    }
+    alexp_spin_unlock_(&alexp_lock_);
+    if(ids == NULL) *count = 0;
+    return ids;
+}
+#ifdef ALEXP_LISTENER_BUFFER_DATA
+/* replaces the kept data of a buffer the polyfill knows; the copy is made before taking the lock */
+static void alexp_keep_buffer_data_ (ALCdevice* device, ALuint buffer, ALenum format, const ALvoid* data, ALsizei size, ALsizei samplerate) {
+    alexp_route_t_* route;
+    void* copy = data != NULL && size > 0 ? malloc((size_t) size) : NULL;
+    if(copy != NULL) memcpy(copy, data, (size_t) size);
+    alexp_spin_lock_(&alexp_lock_);
+    route = alexp_find_route_(&alexp_buffer_routes_, buffer, device);
+    if(route != NULL) {
+        free(route->data);
+        route->data = copy;
+        route->size = size;
+        route->samplerate = samplerate;
+        route->format = format;
+        copy = NULL;
+    }
+    alexp_spin_unlock_(&alexp_lock_);
+    free(copy);
+}
+#endif
+/* the owner of the ID, if there is exactly one, otherwise NULL */
+static void* alexp_route_ (const alexp_routes_t_* routes, ALuint id) {
+    void* owner = NULL;
+    size_t slot;
+    if(id == 0) return NULL;
+    alexp_spin_lock_(&alexp_lock_);
+    for(slot = alexp_route_slot_(routes, id); routes->entries != NULL && routes->entries[slot].id != 0; slot = (slot + 1) & routes->mask) {
+        alexp_route_t_* route = &routes->entries[slot];
+        if(route->id != id || route->owner == &alexp_route_deleted_) continue;
+        if(owner != NULL && route->owner != owner) {
+            owner = NULL;
+            break;
+        }
+        owner = route->owner;
+    }
+    alexp_spin_unlock_(&alexp_lock_);
+    return owner;
+}
+/*
+ * The context of a source and the device of a buffer that the polyfill doesn't know are the ones the calling thread is using. So are
+ * those of an ID that several of them handed out, which can't be told apart by the ID alone; the call then does what it would have
+ * done without the polyfill.
+ */
+static ALCcontext* alexp_source_context_ (ALuint source) {
+    ALCcontext* threadContext;
+    void* owner = alexp_route_(&alexp_source_routes_, source);
+    return owner != NULL ? REINTERPRET_CAST(ALCcontext*, owner) : alexp_get_context_(&threadContext);
+}
+static ALCdevice* alexp_buffer_device_ (ALuint buffer) {
+    ALCcontext* threadContext;
+    void* owner = alexp_route_(&alexp_buffer_routes_, buffer);
+    return owner != NULL ? REINTERPRET_CAST(ALCdevice*, owner) : alcGetContextsDevice(alexp_get_context_(&threadContext));
+}
+
 /* defined to be the same since there is currently no difference in implementation */
 #define ALEXP_LISTENER_WRAP(listener, code)                                 \
             ALEXP_CONTEXT_WRAP(listener, code)
 
 
 
+/*
+ * Listeners: each one is a context on its own ALC_SOFT_loopback device, so ALlistener stays a context and the listener functions work
+ * on it like before. Every source and buffer the polyfill knows of the context (and its device) gets a copy in it, those there already
+ * when alCreateListenerEXT replays them and the later ones when they're generated, and the routed source and buffer functions above
+ * repeat their changes on those copies. alRenderListenersEXT renders all listeners of a context, each in a task of the runner set with
+ * alexpSetListenerTaskRunner (or one after the other without one), and adds them up.
+ * It usually runs on the mixer thread of the real device, while the listeners are created, destroyed and changed on other threads.
+ * alCreateListenerEXT claims a free slot under alexp_lock_ and sets live only after it filled it in. Renders and changes count
+ * themselves in the listener's users before they check live, so alDestroyListenerEXT can clear live and then wait for the users to
+ * drop to 0 before it frees anything; the changes also take the listener's lock, so two threads don't change its maps at once. Each
+ * listener renders into its own buffer of ALEXP_LISTENER_FRAMES frames, allocated when it's created, and longer requests are rendered
+ * in pieces of that size.
+ */
+#ifndef ALEXP_LISTENERS
+#define ALEXP_LISTENERS 8
+#endif
+#ifndef ALEXP_LISTENER_FRAMES
+#define ALEXP_LISTENER_FRAMES 1024
+#endif
+typedef struct alexp_listener_t_ {
+    ALCcontext*     parent;
+    ALCdevice*      parentDevice;
+    ALCdevice*      device;
+    ALCcontext*     context;
+    alexp_routes_t_ sources;
+    alexp_routes_t_ buffers;
+    ALfloat*        samples;
+    ALsizei         unqueue;
+    volatile long   claimed;
+    volatile long   live;
+    volatile long   users;
+    volatile long   lock;
+} alexp_listener_t_;
+static alexp_listener_t_ alexp_listeners_[ALEXP_LISTENERS];
+static volatile long     alexp_listener_count_ = 0;
+static ALEXPtaskrunner   alexp_task_runner_ = NULL;
+static void*             alexp_task_runner_user_ = NULL;
+
+static alexp_listener_t_* alexp_find_listener_ (ALCcontext* context, ALlistener listener) {
+    size_t i;
+    if(listener == NULL) return NULL;
+    for(i = 0; i < ALEXP_LISTENERS; i++) {
+        if(alexp_atomic_load_long_(&alexp_listeners_[i].live) == 0) continue;
+        if(alexp_listeners_[i].context == listener && alexp_listeners_[i].parent == context) return &alexp_listeners_[i];
+    }
+    return NULL;
+}
+/* counts the caller in on a live listener and takes its lock to change it; returns AL_FALSE, with nothing taken, if it isn't live */
+static ALboolean alexp_enter_listener_ (alexp_listener_t_* listener) {
+    if(alexp_atomic_load_long_(&alexp_listener_count_) == 0 || alexp_atomic_load_long_(&listener->live) == 0) return AL_FALSE;
+    alexp_atomic_add_long_(&listener->users, 1);
+    if(alexp_atomic_add_long_(&listener->live, 0) == 0) {
+        alexp_atomic_add_long_(&listener->users, -1);
+        return AL_FALSE;
+    }
+    alexp_spin_lock_(&listener->lock);
+    return AL_TRUE;
+}
+static void alexp_leave_listener_ (alexp_listener_t_* listener) {
+    alexp_spin_unlock_(&listener->lock);
+    alexp_atomic_add_long_(&listener->users, -1);
+}
+/* the listener's copy of the object, or 0 if it has none; the listener owns all entries of its maps */
+static ALuint alexp_mirror_ (alexp_listener_t_* listener, const alexp_routes_t_* routes, ALuint id) {
+    alexp_route_t_* route = alexp_find_route_(routes, id, listener);
+    return route != NULL ? route->mirror : 0;
+}
+
+/* runs code with each listener of the source's context current, with mirror set to the listener's copy of the source */
+#define ALEXP_MIRROR_SOURCE(owner, source, code)                            \
+            do {                                                            \
+                size_t l;                                                   \
+                for(l = 0; l < ALEXP_LISTENERS; l++) {                      \
+                    alexp_listener_t_* listener = &alexp_listeners_[l];     \
+                    ALuint mirror;                                          \
+                    if(!alexp_enter_listener_(listener)) continue;          \
+                    mirror = listener->parent == (owner) ? alexp_mirror_(listener, &listener->sources, (source)) : 0; \
+                    if(mirror != 0) ALEXP_CONTEXT_WRAP(listener->context, code) \
+                    alexp_leave_listener_(listener);                        \
+                }                                                           \
+            } while(0);
+/* the same for the listeners on the buffer's device */
+#define ALEXP_MIRROR_BUFFER(owner, buffer, code)                            \
+            do {                                                            \
+                size_t l;                                                   \
+                for(l = 0; l < ALEXP_LISTENERS; l++) {                      \
+                    alexp_listener_t_* listener = &alexp_listeners_[l];     \
+                    ALuint mirror;                                          \
+                    if(!alexp_enter_listener_(listener)) continue;          \
+                    mirror = listener->parentDevice == (owner) ? alexp_mirror_(listener, &listener->buffers, (buffer)) : 0; \
+                    if(mirror != 0) ALEXP_CONTEXT_WRAP(listener->context, code) \
+                    alexp_leave_listener_(listener);                        \
+                }                                                           \
+            } while(0);
+
+/* skips IDs that have a copy already, which a replay and a generation on another thread can both make */
+static void alexp_mirror_gen_ (alexp_listener_t_* listener, ALsizei n, const ALuint* ids, ALboolean sources) {
+    ALsizei i;
+    for(i = 0; i < n; i++) {
+        alexp_route_t_* route;
+        ALuint mirror = 0;
+        if(ids[i] == 0 || alexp_find_route_(sources ? &listener->sources : &listener->buffers, ids[i], listener) != NULL) continue;
+        ALEXP_CONTEXT_WRAP(listener->context, (sources ? alGenSources(1, &mirror) : alGenBuffers(1, &mirror)))
+        if(mirror == 0) continue;
+        route = alexp_add_route_(sources ? &listener->sources : &listener->buffers, ids[i], listener);
+        if(route != NULL) route->mirror = mirror;
+        else ALEXP_CONTEXT_WRAP(listener->context, (sources ? alDeleteSources(1, &mirror) : alDeleteBuffers(1, &mirror)))
+    }
+}
+static void alexp_mirror_delete_ (alexp_listener_t_* listener, ALsizei n, const ALuint* ids, ALboolean sources) {
+    ALsizei i;
+    for(i = 0; i < n; i++) {
+        alexp_route_t_* route = alexp_find_route_(sources ? &listener->sources : &listener->buffers, ids[i], listener);
+        if(route == NULL) continue;
+        ALEXP_CONTEXT_WRAP(listener->context, (sources ? alDeleteSources(1, &route->mirror) : alDeleteBuffers(1, &route->mirror)))
+        listener->unqueue -= route->unqueue;
+        route->owner = &alexp_route_deleted_;
+    }
+}
+/* generates or deletes the copies in each listener of the owner, which is a context for sources and a device for buffers */
+static void alexp_mirror_objects_ (void* owner, ALsizei n, const ALuint* ids, ALboolean sources, ALboolean gen) {
+    size_t l;
+    for(l = 0; ids != NULL && l < ALEXP_LISTENERS; l++) {
+        alexp_listener_t_* listener = &alexp_listeners_[l];
+        if(!alexp_enter_listener_(listener)) continue;
+        if((sources ? (void*) listener->parent : (void*) listener->parentDevice) == owner) {
+            if(gen) alexp_mirror_gen_(listener, n, ids, sources);
+            else alexp_mirror_delete_(listener, n, ids, sources);
+        }
+        alexp_leave_listener_(listener);
+    }
+}
+static void alexp_mirror_gen_sources_ (ALCcontext* context, ALsizei n, const ALuint* sources) {
+    alexp_mirror_objects_(context, n, sources, AL_TRUE, AL_TRUE);
+}
+static void alexp_mirror_delete_sources_ (ALCcontext* context, ALsizei n, const ALuint* sources) {
+    alexp_mirror_objects_(context, n, sources, AL_TRUE, AL_FALSE);
+}
+static void alexp_mirror_gen_buffers_ (ALCdevice* device, ALsizei n, const ALuint* buffers) {
+    alexp_mirror_objects_(device, n, buffers, AL_FALSE, AL_TRUE);
+}
+static void alexp_mirror_delete_buffers_ (ALCdevice* device, ALsizei n, const ALuint* buffers) {
+    alexp_mirror_objects_(device, n, buffers, AL_FALSE, AL_FALSE);
+}
+/* alSourcePlayv and the like for the copies, which are numbered differently, so one at a time */
+enum { ALEXP_MIRROR_PLAY_, ALEXP_MIRROR_STOP_, ALEXP_MIRROR_REWIND_, ALEXP_MIRROR_PAUSE_ };
+static void alexp_mirror_state_ (ALuint mirror, int state) {
+    switch(state) {
+        case ALEXP_MIRROR_PLAY_:   alSourcePlay(mirror); break;
+        case ALEXP_MIRROR_STOP_:   alSourceStop(mirror); break;
+        case ALEXP_MIRROR_REWIND_: alSourceRewind(mirror); break;
+        case ALEXP_MIRROR_PAUSE_:  alSourcePause(mirror); break;
+        default: break;
+    }
+}
+static void alexp_mirror_statev_ (ALCcontext* context, ALsizei n, const ALuint* sources, int state) {
+    ALsizei i;
+    if(alexp_atomic_load_long_(&alexp_listener_count_) == 0 || sources == NULL) return;
+    for(i = 0; i < n; i++) {
+        ALEXP_MIRROR_SOURCE(context, sources[i], (alexp_mirror_state_(mirror, state)))
+    }
+}
+/* buffers in the listener's copy of the source are the listener's copies of the buffers */
+static ALint alexp_mirror_buffer_ (alexp_listener_t_* listener, ALint buffer) {
+    return buffer != 0 ? (ALint) alexp_mirror_(listener, &listener->buffers, (ALuint) buffer) : 0;
+}
+/*
+ * The copy only plays while alRenderListenersEXT runs, so it may not have processed the buffers the source unqueues yet. Those are counted
+ * on its entry (and in total on the listener), and unqueued once the copy reports them as processed, on the next queue or unqueue of
+ * the source, or before any of the listener's buffers gets new data.
+ */
+static void alexp_mirror_unqueue_ (alexp_listener_t_* listener, alexp_route_t_* route) {
+    ALint processed = 0;
+    ALuint buffer;
+    if(route->unqueue == 0) return;
+    alGetSourcei(route->mirror, AL_BUFFERS_PROCESSED, &processed);
+    for(; processed > 0 && route->unqueue > 0; processed--) {
+        alSourceUnqueueBuffers(route->mirror, 1, &buffer);
+        route->unqueue--;
+        listener->unqueue--;
+    }
+}
+static void alexp_mirror_queue_ (alexp_listener_t_* listener, ALuint source, ALsizei nb, const ALuint* buffers, ALboolean queue) {
+    alexp_route_t_* route = alexp_find_route_(&listener->sources, source, listener);
+    ALsizei i;
+    if(route == NULL || nb <= 0 || buffers == NULL) return;
+    /* the unqueued IDs are never 0, so a 0 left in the array means the source unqueued nothing */
+    if(!queue && buffers[0] != 0) {
+        route->unqueue += nb;
+        listener->unqueue += nb;
+    }
+    alexp_mirror_unqueue_(listener, route);
+    for(i = 0; queue && i < nb; i++) {
+        ALuint buffer = alexp_mirror_(listener, &listener->buffers, buffers[i]);
+        if(buffer != 0) alSourceQueueBuffers(route->mirror, 1, &buffer);
+    }
+}
+/* setting AL_BUFFER replaces the whole queue, so there is nothing left to unqueue */
+static void alexp_mirror_set_buffer_ (alexp_listener_t_* listener, ALuint source, ALint buffer) {
+    alexp_route_t_* route = alexp_find_route_(&listener->sources, source, listener);
+    if(route == NULL) return;
+    alSourcei(route->mirror, AL_BUFFER, alexp_mirror_buffer_(listener, buffer));
+    listener->unqueue -= route->unqueue;
+    route->unqueue = 0;
+}
+/* a buffer that is still queued on a copy can't get new data, so the copies catch up first */
+static void alexp_mirror_buffer_data_ (alexp_listener_t_* listener, ALuint mirror, ALenum format, const ALvoid* data, ALsizei size, ALsizei samplerate) {
+    size_t i;
+    for(i = 0; listener->unqueue != 0 && listener->sources.entries != NULL && i <= listener->sources.mask; i++) {
+        alexp_route_t_* route = &listener->sources.entries[i];
+        if(route->id != 0 && route->owner != &alexp_route_deleted_) alexp_mirror_unqueue_(listener, route);
+    }
+    alBufferData(mirror, format, data, size, samplerate);
+}
+
+/*
+ * A new listener gets copies of the sources and buffers that are there already. The driver can't hand the data of a buffer back, so
+ * a copy only gets the data the polyfill kept with ALEXP_LISTENER_BUFFER_DATA, and is empty until its next alBufferDataExplicitEXT
+ * otherwise. A copy of a source gets the source's properties, its buffer if it's static, and its offset and state if it's playing or
+ * paused; a streaming source's queue can't be read back, so its copy starts with the buffers queued from then on.
+ */
+static const ALenum alexp_replay_floats_[] = {
+    AL_PITCH, AL_GAIN, AL_MIN_GAIN, AL_MAX_GAIN, AL_MAX_DISTANCE, AL_ROLLOFF_FACTOR,
+    AL_CONE_OUTER_GAIN, AL_CONE_INNER_ANGLE, AL_CONE_OUTER_ANGLE, AL_REFERENCE_DISTANCE
+};
+static const ALenum alexp_replay_vectors_[] = { AL_POSITION, AL_VELOCITY, AL_DIRECTION };
+static const ALenum alexp_replay_ints_[] = { AL_SOURCE_RELATIVE, AL_LOOPING, AL_SOURCE_TYPE, AL_BUFFER, AL_SOURCE_STATE };
+enum { ALEXP_REPLAY_RELATIVE_, ALEXP_REPLAY_LOOPING_, ALEXP_REPLAY_TYPE_, ALEXP_REPLAY_BUFFER_, ALEXP_REPLAY_STATE_, ALEXP_REPLAY_INTS_ };
+typedef struct alexp_source_state_t_ {
+    ALfloat floats[sizeof(alexp_replay_floats_) / sizeof(ALenum)];
+    ALfloat vectors[sizeof(alexp_replay_vectors_) / sizeof(ALenum)][3];
+    ALint   ints[ALEXP_REPLAY_INTS_];
+    ALfloat offset;
+} alexp_source_state_t_;
+/* runs with the source's context current */
+static void alexp_read_sources_ (ALsizei n, const ALuint* sources, alexp_source_state_t_* states) {
+    ALsizei i;
+    size_t p;
+    memset(states, 0, (size_t) n * sizeof(alexp_source_state_t_));
+    for(i = 0; i < n; i++) {
+        for(p = 0; p < sizeof(alexp_replay_floats_) / sizeof(ALenum); p++) alGetSourcef(sources[i], alexp_replay_floats_[p], &states[i].floats[p]);
+        for(p = 0; p < sizeof(alexp_replay_vectors_) / sizeof(ALenum); p++) alGetSourcefv(sources[i], alexp_replay_vectors_[p], states[i].vectors[p]);
+        for(p = 0; p < ALEXP_REPLAY_INTS_; p++) alGetSourcei(sources[i], alexp_replay_ints_[p], &states[i].ints[p]);
+        alGetSourcef(sources[i], AL_SEC_OFFSET, &states[i].offset);
+    }
+}
+/* runs with the listener current */
+static void alexp_write_sources_ (alexp_listener_t_* listener, ALsizei n, const ALuint* sources, const alexp_source_state_t_* states) {
+    ALsizei i;
+    size_t p;
+    for(i = 0; i < n; i++) {
+        ALint state = states[i].ints[ALEXP_REPLAY_STATE_];
+        ALuint mirror = alexp_mirror_(listener, &listener->sources, sources[i]);
+        if(mirror == 0) continue;
+        for(p = 0; p < sizeof(alexp_replay_floats_) / sizeof(ALenum); p++) alSourcef(mirror, alexp_replay_floats_[p], states[i].floats[p]);
+        for(p = 0; p < sizeof(alexp_replay_vectors_) / sizeof(ALenum); p++) alSourcefv(mirror, alexp_replay_vectors_[p], states[i].vectors[p]);
+        alSourcei(mirror, AL_SOURCE_RELATIVE, states[i].ints[ALEXP_REPLAY_RELATIVE_]);
+        alSourcei(mirror, AL_LOOPING, states[i].ints[ALEXP_REPLAY_LOOPING_]);
+        if(states[i].ints[ALEXP_REPLAY_TYPE_] == AL_STATIC) alSourcei(mirror, AL_BUFFER, alexp_mirror_buffer_(listener, states[i].ints[ALEXP_REPLAY_BUFFER_]));
+        if(state != AL_PLAYING && state != AL_PAUSED) continue;
+        alSourcef(mirror, AL_SEC_OFFSET, states[i].offset);
+        alSourcePlay(mirror);
+        if(state == AL_PAUSED) alSourcePause(mirror);
+    }
+}
+/* runs with the listener entered, so the changes made meanwhile on other threads wait and come after the replay */
+static void alexp_replay_listener_ (alexp_listener_t_* listener) {
+    alexp_source_state_t_* states;
+    ALsizei n;
+    ALuint* ids = alexp_route_ids_(&alexp_buffer_routes_, listener->parentDevice, &n);
+    if(ids != NULL) {
+        alexp_mirror_gen_(listener, n, ids, AL_FALSE);
+#ifdef ALEXP_LISTENER_BUFFER_DATA
+        {
+            ALsizei i;
+            alexp_spin_lock_(&alexp_lock_);
+            for(i = 0; i < n; i++) {
+                alexp_route_t_* route = alexp_find_route_(&alexp_buffer_routes_, ids[i], listener->parentDevice);
+                ALuint mirror = alexp_mirror_(listener, &listener->buffers, ids[i]);
+                if(route != NULL && route->data != NULL && mirror != 0) ALEXP_CONTEXT_WRAP(listener->context, (alBufferData(mirror, route->format, route->data, route->size, route->samplerate)))
+            }
+            alexp_spin_unlock_(&alexp_lock_);
+        }
+#endif
+        free(ids);
+    }
+    ids = alexp_route_ids_(&alexp_source_routes_, listener->parent, &n);
+    if(ids == NULL) return;
+    alexp_mirror_gen_(listener, n, ids, AL_TRUE);
+    states = REINTERPRET_CAST(alexp_source_state_t_*, malloc((size_t) n * sizeof(alexp_source_state_t_)));
+    if(states != NULL) {
+        ALEXP_CONTEXT_WRAP(listener->parent, (alexp_read_sources_(n, ids, states)))
+        ALEXP_CONTEXT_WRAP(listener->context, (alexp_write_sources_(listener, n, ids, states)))
+    }
+    free(states);
+    free(ids);
+}
+
+typedef struct alexp_render_t_ {
+    alexp_listener_t_* listeners[ALEXP_LISTENERS];
+    ALsizei            frames;
+} alexp_render_t_;
+static void alexp_render_listener_ (void* data, ALsizei index) {
+    alexp_render_t_* render = REINTERPRET_CAST(alexp_render_t_*, data);
+    alcRenderSamplesSOFT(render->listeners[index]->device, render->listeners[index]->samples, render->frames);
+}
+
+void            alexpSetListenerTaskRunner      (ALEXPtaskrunner runner, void* user) {
+    alexp_task_runner_ = runner;
+    alexp_task_runner_user_ = user;
+}
+void            alRenderListenersEXT            (ALCcontext* context, ALfloat* samples, ALsizei frames) {
+    alexp_render_t_ render;
+    ALsizei count = 0, done, i, j;
+    size_t l;
+    if(samples == NULL || frames <= 0) return;
+    memset(samples, 0, (size_t) frames * 2 * sizeof(ALfloat));
+    for(l = 0; l < ALEXP_LISTENERS; l++) {
+        alexp_listener_t_* listener = &alexp_listeners_[l];
+        if(alexp_atomic_load_long_(&listener->live) == 0) continue;
+        alexp_atomic_add_long_(&listener->users, 1);
+        if(alexp_atomic_add_long_(&listener->live, 0) == 0 || listener->parent != context) {
+            alexp_atomic_add_long_(&listener->users, -1);
+            continue;
+        }
+        render.listeners[count++] = listener;
+    }
+    if(count == 0) return;
+    for(done = 0; done < frames; done += render.frames) {
+        render.frames = frames - done < ALEXP_LISTENER_FRAMES ? frames - done : ALEXP_LISTENER_FRAMES;
+        if(alexp_task_runner_ != NULL) alexp_task_runner_(alexp_task_runner_user_, count, alexp_render_listener_, &render);
+        else for(i = 0; i < count; i++) alexp_render_listener_(&render, i);
+        for(i = 0; i < count; i++) {
+            const ALfloat* rendered = render.listeners[i]->samples;
+            ALfloat* mixed = samples + (size_t) done * 2;
+            for(j = 0; j < render.frames * 2; j++) mixed[j] += rendered[j];
+        }
+    }
+    for(i = 0; i < count; i++) alexp_atomic_add_long_(&render.listeners[i]->users, -1);
+}
+ALsizei AL_APIENTRY alexpListenerBufferCallback     (ALvoid* userptr, ALvoid* sampledata, ALsizei numbytes) {
+    ALsizei frames = numbytes / (ALsizei) (2 * sizeof(ALfloat));
+    alRenderListenersEXT(REINTERPRET_CAST(ALCcontext*, userptr), REINTERPRET_CAST(ALfloat*, sampledata), frames);
+    return frames * (ALsizei) (2 * sizeof(ALfloat));
+}
+
+
+
+/* batch recording; the commands and the source IDs they refer to live in two arrays that only grow */
+enum {
+    ALEXP_OP_DOPPLER_FACTOR_,
+    ALEXP_OP_DOPPLER_VELOCITY_,
+    ALEXP_OP_SPEED_OF_SOUND_,
+    ALEXP_OP_DISTANCE_MODEL_,
+    ALEXP_OP_ENABLE_,
+    ALEXP_OP_DISABLE_,
+    ALEXP_OP_LISTENERF_,
+    ALEXP_OP_LISTENER3F_,
+    ALEXP_OP_LISTENERFV_,
+    ALEXP_OP_LISTENERI_,
+    ALEXP_OP_LISTENER3I_,
+    ALEXP_OP_LISTENERIV_,
+    ALEXP_OP_SOURCE_PLAYV_,
+    ALEXP_OP_SOURCE_STOPV_,
+    ALEXP_OP_SOURCE_REWINDV_,
+    ALEXP_OP_SOURCE_PAUSEV_,
+    ALEXP_OP_SOURCEF_,
+    ALEXP_OP_SOURCE3F_,
+    ALEXP_OP_SOURCEFV_,
+    ALEXP_OP_SOURCEI_,
+    ALEXP_OP_SOURCE3I_,
+    ALEXP_OP_SOURCEIV_
+};
+typedef struct alexp_command_t_ {
+    ALCcontext* context;
+    size_t      sequence;
+    int         op;
+    ALenum      param;
+    ALsizei     count;
+    size_t      sources;
+    ALuint      source;
+    union {
+        ALfloat f[6];
+        ALint   i[6];
+    } values;
+} alexp_command_t_;
+static int               alexp_batch_recording_ = 0;
+static alexp_command_t_* alexp_batch_commands_ = NULL;
+static size_t            alexp_batch_command_count_ = 0;
+static size_t            alexp_batch_command_capacity_ = 0;
+static ALuint*           alexp_batch_sources_ = NULL;
+static size_t            alexp_batch_source_count_ = 0;
+static size_t            alexp_batch_source_capacity_ = 0;
+
+/* the number of values alListenerfv and alListeneriv read for the parameter */
+static ALsizei alexp_listener_values_ (ALenum param) {
+    if(param == AL_ORIENTATION) return 6;
+    if(param == AL_POSITION || param == AL_VELOCITY) return 3;
+    return 1;
+}
+/* the number of values alSourcefv and alSourceiv read for the parameter */
+static ALsizei alexp_source_values_ (ALenum param) {
+    if(param == AL_ORIENTATION) return 6;
+    if(param == AL_POSITION || param == AL_VELOCITY || param == AL_DIRECTION || param == AL_AUXILIARY_SEND_FILTER) return 3;
+    if(param == AL_STEREO_ANGLES) return 2;
+    return 1;
+}
+/* returns NULL if nothing is being recorded or there is no memory left, then the call has to run right away */
+static alexp_command_t_* alexp_record_ (ALCcontext* context, int op, ALenum param) {
+    alexp_command_t_* command;
+    if(!alexp_batch_recording_) return NULL;
+    if(alexp_batch_command_count_ == alexp_batch_command_capacity_) {
+        size_t capacity = alexp_batch_command_capacity_ != 0 ? alexp_batch_command_capacity_ * 2 : 64;
+        alexp_command_t_* commands = REINTERPRET_CAST(alexp_command_t_*, realloc(alexp_batch_commands_, capacity * sizeof(alexp_command_t_)));
+        if(commands == NULL) return NULL;
+        alexp_batch_commands_ = commands;
+        alexp_batch_command_capacity_ = capacity;
+    }
+    command = &alexp_batch_commands_[alexp_batch_command_count_];
+    command->context = context;
+    command->sequence = alexp_batch_command_count_;
+    command->op = op;
+    command->param = param;
+    command->count = 0;
+    command->sources = 0;
+    command->source = 0;
+    alexp_batch_command_count_++;
+    return command;
+}
+/* invalid arrays aren't recorded either, so the driver gets to report them */
+static ALboolean alexp_record_floats_ (ALCcontext* context, int op, ALenum param, ALsizei count, const ALfloat* values) {
+    alexp_command_t_* command = values != NULL ? alexp_record_(context, op, param) : NULL;
+    if(command == NULL) return AL_FALSE;
+    command->count = count;
+    memcpy(command->values.f, values, (size_t) count * sizeof(ALfloat));
+    return AL_TRUE;
+}
+static ALboolean alexp_record_ints_ (ALCcontext* context, int op, ALenum param, ALsizei count, const ALint* values) {
+    alexp_command_t_* command = values != NULL ? alexp_record_(context, op, param) : NULL;
+    if(command == NULL) return AL_FALSE;
+    command->count = count;
+    memcpy(command->values.i, values, (size_t) count * sizeof(ALint));
+    return AL_TRUE;
+}
+/* the setters routed by the source, which keep it in the command */
+static ALboolean alexp_record_source_floats_ (ALCcontext* context, int op, ALuint source, ALenum param, ALsizei count, const ALfloat* values) {
+    if(!alexp_record_floats_(context, op, param, count, values)) return AL_FALSE;
+    alexp_batch_commands_[alexp_batch_command_count_ - 1].source = source;
+    return AL_TRUE;
+}
+static ALboolean alexp_record_source_ints_ (ALCcontext* context, int op, ALuint source, ALenum param, ALsizei count, const ALint* values) {
+    if(!alexp_record_ints_(context, op, param, count, values)) return AL_FALSE;
+    alexp_batch_commands_[alexp_batch_command_count_ - 1].source = source;
+    return AL_TRUE;
+}
+static ALboolean alexp_record_sources_ (ALCcontext* context, int op, ALsizei n, const ALuint* sources) {
+    alexp_command_t_* command;
+    if(!alexp_batch_recording_ || n < 0 || (n > 0 && sources == NULL)) return AL_FALSE;
+    if(alexp_batch_source_capacity_ - alexp_batch_source_count_ < (size_t) n) {
+        size_t capacity = alexp_batch_source_capacity_ != 0 ? alexp_batch_source_capacity_ : 256;
+        ALuint* ids;
+        while(capacity - alexp_batch_source_count_ < (size_t) n) capacity *= 2;
+        ids = REINTERPRET_CAST(ALuint*, realloc(alexp_batch_sources_, capacity * sizeof(ALuint)));
+        if(ids == NULL) return AL_FALSE;
+        alexp_batch_sources_ = ids;
+        alexp_batch_source_capacity_ = capacity;
+    }
+    command = alexp_record_(context, op, 0);
+    if(command == NULL) return AL_FALSE;
+    command->count = n;
+    command->sources = alexp_batch_source_count_;
+    if(n > 0) memcpy(alexp_batch_sources_ + alexp_batch_source_count_, sources, (size_t) n * sizeof(ALuint));
+    alexp_batch_source_count_ += (size_t) n;
+    return AL_TRUE;
+}
+static void alexp_replay_ (const alexp_command_t_* command) {
+    const ALfloat* f = command->values.f;
+    const ALint*   i = command->values.i;
+    const ALuint*  sources = alexp_batch_sources_ + command->sources;
+    switch(command->op) {
+        case ALEXP_OP_DOPPLER_FACTOR_:   alDopplerFactor(f[0]); break;
+        case ALEXP_OP_DOPPLER_VELOCITY_: alDopplerVelocity(f[0]); break;
+        case ALEXP_OP_SPEED_OF_SOUND_:   alSpeedOfSound(f[0]); break;
+        case ALEXP_OP_DISTANCE_MODEL_:   alDistanceModel(command->param); break;
+        case ALEXP_OP_ENABLE_:           alEnable(command->param); break;
+        case ALEXP_OP_DISABLE_:          alDisable(command->param); break;
+        case ALEXP_OP_LISTENERF_:        alListenerf(command->param, f[0]); break;
+        case ALEXP_OP_LISTENER3F_:       alListener3f(command->param, f[0], f[1], f[2]); break;
+        case ALEXP_OP_LISTENERFV_:       alListenerfv(command->param, f); break;
+        case ALEXP_OP_LISTENERI_:        alListeneri(command->param, i[0]); break;
+        case ALEXP_OP_LISTENER3I_:       alListener3i(command->param, i[0], i[1], i[2]); break;
+        case ALEXP_OP_LISTENERIV_:       alListeneriv(command->param, i); break;
+        case ALEXP_OP_SOURCE_PLAYV_:     alSourcePlayv(command->count, sources); alexp_mirror_statev_(command->context, command->count, sources, ALEXP_MIRROR_PLAY_); break;
+        case ALEXP_OP_SOURCE_STOPV_:     alSourceStopv(command->count, sources); alexp_mirror_statev_(command->context, command->count, sources, ALEXP_MIRROR_STOP_); break;
+        case ALEXP_OP_SOURCE_REWINDV_:   alSourceRewindv(command->count, sources); alexp_mirror_statev_(command->context, command->count, sources, ALEXP_MIRROR_REWIND_); break;
+        case ALEXP_OP_SOURCE_PAUSEV_:    alSourcePausev(command->count, sources); alexp_mirror_statev_(command->context, command->count, sources, ALEXP_MIRROR_PAUSE_); break;
+        case ALEXP_OP_SOURCEF_:
+            alSourcef(command->source, command->param, f[0]);
+            ALEXP_MIRROR_SOURCE(command->context, command->source, (alSourcef(mirror, command->param, f[0])))
+            break;
+        case ALEXP_OP_SOURCE3F_:
+            alSource3f(command->source, command->param, f[0], f[1], f[2]);
+            ALEXP_MIRROR_SOURCE(command->context, command->source, (alSource3f(mirror, command->param, f[0], f[1], f[2])))
+            break;
+        case ALEXP_OP_SOURCEFV_:
+            alSourcefv(command->source, command->param, f);
+            ALEXP_MIRROR_SOURCE(command->context, command->source, (alSourcefv(mirror, command->param, f)))
+            break;
+        case ALEXP_OP_SOURCEI_:
+            alSourcei(command->source, command->param, i[0]);
+            ALEXP_MIRROR_SOURCE(command->context, command->source, (command->param == AL_BUFFER ? alexp_mirror_set_buffer_(listener, command->source, i[0]) : alSourcei(mirror, command->param, i[0])))
+            break;
+        case ALEXP_OP_SOURCE3I_:
+            alSource3i(command->source, command->param, i[0], i[1], i[2]);
+            ALEXP_MIRROR_SOURCE(command->context, command->source, (alSource3i(mirror, command->param, i[0], i[1], i[2])))
+            break;
+        case ALEXP_OP_SOURCEIV_:
+            alSourceiv(command->source, command->param, i);
+            ALEXP_MIRROR_SOURCE(command->context, command->source, (alSourceiv(mirror, command->param, i)))
+            break;
+        default: break;
+    }
+}
+/* by context, and in the order they were recorded within each context */
+static int alexp_compare_commands_ (const void* a, const void* b) {
+    const alexp_command_t_* x = REINTERPRET_CAST(const alexp_command_t_*, a);
+    const alexp_command_t_* y = REINTERPRET_CAST(const alexp_command_t_*, b);
+    if(x->context != y->context) return x->context < y->context ? -1 : 1;
+    return x->sequence < y->sequence ? -1 : (x->sequence > y->sequence ? 1 : 0);
+}
+
+void            alexpBeginBatch                 (void) {
+    alexp_batch_recording_ = 1;
+}
+void            alexpSubmitBatch                (void) {
+    ALCcontext* threadContext;
+    ALCcontext* currentThreadContext;
+    ALCcontext* globalContext = NULL;
+    ALCcontext* active;
+    ALCboolean  threadSwitched = ALC_FALSE;
+    ALCboolean  globalSwitched = ALC_FALSE;
+    size_t      first, last;
+    alexp_batch_recording_ = 0;
+    if(alexp_batch_command_count_ == 0) return;
+    qsort(alexp_batch_commands_, alexp_batch_command_count_, sizeof(alexp_command_t_), alexp_compare_commands_);
+    active = alexp_get_context_(&threadContext);
+    currentThreadContext = threadContext;
+    for(first = 0; first < alexp_batch_command_count_; first = last) {
+        ALCcontext* context = alexp_batch_commands_[first].context;
+        for(last = first; last < alexp_batch_command_count_ && alexp_batch_commands_[last].context == context; last++);
+        if(context != active) {
+            ALCcontext* global = NULL;
+            /* only the global context from before the first global switch is restored */
+            if(alexp_switch_context_(context, currentThreadContext, &global)) {
+                threadSwitched = ALC_TRUE;
+                currentThreadContext = context;
+            } else {
+                if(!globalSwitched) globalContext = global;
+                globalSwitched = ALC_TRUE;
+                if(currentThreadContext != NULL) threadSwitched = ALC_TRUE;
+                currentThreadContext = NULL;
+            }
+            active = context;
+        }
+        if(alDeferUpdatesSOFT != NULL) alDeferUpdatesSOFT();
+        for(; first < last; first++) alexp_replay_(&alexp_batch_commands_[first]);
+        if(alProcessUpdatesSOFT != NULL) alProcessUpdatesSOFT();
+    }
+    alexp_restore_context_(threadSwitched, globalSwitched, threadContext, globalContext);
+    alexp_batch_command_count_ = 0;
+    alexp_batch_source_count_ = 0;
+}
+void            alexpFreeBatch                  (void) {
+    alexp_batch_recording_ = 0;
+    free(alexp_batch_commands_);
+    free(alexp_batch_sources_);
+    alexp_batch_commands_ = NULL;
+    alexp_batch_sources_ = NULL;
+    alexp_batch_command_count_ = alexp_batch_command_capacity_ = 0;
+    alexp_batch_source_count_ = alexp_batch_source_capacity_ = 0;
+}
+
+
+
 void            alGenBuffersExplicitEXT         (ALCdevice* device, ALsizei n, ALuint *buffers) {
-    ALEXP_DEVICE_WRAP(device, (alGenBuffers(n, buffers)));
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    ALCcontext* context = direct->alGenBuffersDirect != NULL ? alexp_device_context_(device) : NULL;
+    /* the driver leaves the array alone on errors, so only the slots that aren't 0 afterwards hold new buffers */
+    if(buffers != NULL && n > 0) memset(buffers, 0, (size_t) n * sizeof(ALuint));
+    if(context != NULL) direct->alGenBuffersDirect(context, n, buffers);
+    else ALEXP_DEVICE_WRAP(device, (alGenBuffers(n, buffers)));
+    if(buffers != NULL) {
+        alexp_add_routes_(&alexp_buffer_routes_, n, buffers, device);
+        alexp_mirror_gen_buffers_(device, n, buffers);
+    }
 }
 void            alDeleteBuffersExplicitEXT      (ALCdevice* device, ALsizei n, const ALuint *buffers) {
-    ALEXP_DEVICE_WRAP(device, (alDeleteBuffers(n, buffers)));
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    ALCcontext* context = direct->alDeleteBuffersDirect != NULL ? alexp_device_context_(device) : NULL;
+    if(context != NULL) direct->alDeleteBuffersDirect(context, n, buffers);
+    else ALEXP_DEVICE_WRAP(device, (alDeleteBuffers(n, buffers)));
+    alexp_remove_routes_(&alexp_buffer_routes_, n, buffers, device);
+    alexp_mirror_delete_buffers_(device, n, buffers);
 }
 ALboolean       alIsBufferExplicitEXT           (ALCdevice* device, ALuint buffer) {
     ALboolean isBuffer;
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    ALCcontext* context = direct->alIsBufferDirect != NULL ? alexp_device_context_(device) : NULL;
+    if(context != NULL) return direct->alIsBufferDirect(context, buffer);
     ALEXP_DEVICE_WRAP(device, (isBuffer = alIsBuffer(buffer)));
     return isBuffer;
 }
@@ -150,147 +1185,255 @@ ALboolean       alIsBufferExplicitEXT           (ALCdevice* device, ALuint buffe
 
 
 void            alDopplerFactorExplicitEXT      (ALCcontext* context, ALfloat value) {
-    ALEXP_CONTEXT_WRAP(context, (alDopplerFactor(value)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(alexp_record_floats_(context, ALEXP_OP_DOPPLER_FACTOR_, 0, 1, &value)) return;
+    if(direct->alDopplerFactorDirect != NULL) direct->alDopplerFactorDirect(context, value);
+    else ALEXP_CONTEXT_WRAP(context, (alDopplerFactor(value)))
 }
+/* deprecated, so AL_EXT_direct_context has no version of it */
 void            alDopplerVelocityExplicitEXT    (ALCcontext* context, ALfloat value) {
+    if(alexp_record_floats_(context, ALEXP_OP_DOPPLER_VELOCITY_, 0, 1, &value)) return;
     ALEXP_CONTEXT_WRAP(context, (alDopplerVelocity(value)))
 }
 void            alSpeedOfSoundExplicitEXT       (ALCcontext* context, ALfloat value) {
-    ALEXP_CONTEXT_WRAP(context, (alSpeedOfSound(value)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(alexp_record_floats_(context, ALEXP_OP_SPEED_OF_SOUND_, 0, 1, &value)) return;
+    if(direct->alSpeedOfSoundDirect != NULL) direct->alSpeedOfSoundDirect(context, value);
+    else ALEXP_CONTEXT_WRAP(context, (alSpeedOfSound(value)))
 }
 void            alDistanceModelExplicitEXT      (ALCcontext* context, ALenum distanceModel) {
-    ALEXP_CONTEXT_WRAP(context, (alDistanceModel(distanceModel)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(alexp_record_(context, ALEXP_OP_DISTANCE_MODEL_, distanceModel) != NULL) return;
+    if(direct->alDistanceModelDirect != NULL) direct->alDistanceModelDirect(context, distanceModel);
+    else ALEXP_CONTEXT_WRAP(context, (alDistanceModel(distanceModel)))
 }
 void            alEnableExplicitEXT             (ALCcontext* context, ALenum capability) {
-    ALEXP_CONTEXT_WRAP(context, (alEnable(capability)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(alexp_record_(context, ALEXP_OP_ENABLE_, capability) != NULL) return;
+    if(direct->alEnableDirect != NULL) direct->alEnableDirect(context, capability);
+    else ALEXP_CONTEXT_WRAP(context, (alEnable(capability)))
 }
 void            alDisableExplicitEXT            (ALCcontext* context, ALenum capability) {
-    ALEXP_CONTEXT_WRAP(context, (alDisable(capability)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(alexp_record_(context, ALEXP_OP_DISABLE_, capability) != NULL) return;
+    if(direct->alDisableDirect != NULL) direct->alDisableDirect(context, capability);
+    else ALEXP_CONTEXT_WRAP(context, (alDisable(capability)))
 }
 ALboolean       alIsEnabledExplicitEXT          (ALCcontext* context, ALenum capability) {
     ALboolean isEnabled;
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alIsEnabledDirect != NULL) return direct->alIsEnabledDirect(context, capability);
     ALEXP_CONTEXT_WRAP(context, (isEnabled = alIsEnabled(capability)))
     return isEnabled;
 }
 const ALchar*   alGetStringExplicitEXT          (ALCcontext* context, ALenum param) {
     const ALchar* str;
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetStringDirect != NULL) return direct->alGetStringDirect(context, param);
     ALEXP_CONTEXT_WRAP(context, (str = alGetString(param)))
     return str;
 }
 void            alGetBooleanvExplicitEXT        (ALCcontext* context, ALenum param, ALboolean *values) {
-    ALEXP_CONTEXT_WRAP(context, (alGetBooleanv(param, values)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetBooleanvDirect != NULL) direct->alGetBooleanvDirect(context, param, values);
+    else ALEXP_CONTEXT_WRAP(context, (alGetBooleanv(param, values)))
 }
 void            alGetIntegervExplicitEXT        (ALCcontext* context, ALenum param, ALint *values) {
-    ALEXP_CONTEXT_WRAP(context, (alGetIntegerv(param, values)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetIntegervDirect != NULL) direct->alGetIntegervDirect(context, param, values);
+    else ALEXP_CONTEXT_WRAP(context, (alGetIntegerv(param, values)))
 }
 void            alGetFloatvExplicitEXT          (ALCcontext* context, ALenum param, ALfloat *values) {
-    ALEXP_CONTEXT_WRAP(context, (alGetFloatv(param,values)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetFloatvDirect != NULL) direct->alGetFloatvDirect(context, param,values);
+    else ALEXP_CONTEXT_WRAP(context, (alGetFloatv(param,values)))
 }
 void            alGetDoublevExplicitEXT         (ALCcontext* context, ALenum param, ALdouble *values) {
-    ALEXP_CONTEXT_WRAP(context, (alGetDoublev(param, values)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetDoublevDirect != NULL) direct->alGetDoublevDirect(context, param, values);
+    else ALEXP_CONTEXT_WRAP(context, (alGetDoublev(param, values)))
 }
 ALboolean       alGetBooleanExplicitEXT         (ALCcontext* context, ALenum param) {
     ALboolean b;
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetBooleanDirect != NULL) return direct->alGetBooleanDirect(context, param);
     ALEXP_CONTEXT_WRAP(context, (b = alGetBoolean(param)))
     return b;
 }
 ALint           alGetIntegerExplicitEXT         (ALCcontext* context, ALenum param) {
     ALint i;
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetIntegerDirect != NULL) return direct->alGetIntegerDirect(context, param);
     ALEXP_CONTEXT_WRAP(context, (i = alGetInteger(param)))
     return i;
 }
 ALfloat         alGetFloatExplicitEXT           (ALCcontext* context, ALenum param) {
     ALfloat f;
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetFloatDirect != NULL) return direct->alGetFloatDirect(context, param);
     ALEXP_CONTEXT_WRAP(context, (f = alGetFloat(param)))
     return f;
 }
 ALdouble        alGetDoubleExplicitEXT          (ALCcontext* context, ALenum param) {
     ALdouble d;
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetDoubleDirect != NULL) return direct->alGetDoubleDirect(context, param);
     ALEXP_CONTEXT_WRAP(context, (d = alGetDouble(param)))
     return d;
 }
-ALenum          alGetErrorExplicitEXT           (ALCcontext* context, void) {
+ALenum          alGetErrorExplicitEXT           (ALCcontext* context) {
     ALenum e;
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetErrorDirect != NULL) return direct->alGetErrorDirect(context);
     ALEXP_CONTEXT_WRAP(context, (e = alGetError()))
     return e;
 }
 ALboolean       alIsExtensionPresentExplicitEXT (ALCcontext* context, const ALchar *extname) {
     ALboolean isPresent;
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alIsExtensionPresentDirect != NULL) return direct->alIsExtensionPresentDirect(context, extname);
     ALEXP_CONTEXT_WRAP(context, (isPresent = alIsExtensionPresent(extname)))
     return isPresent;
 }
 void*           alGetProcAddressExplicitEXT     (ALCcontext* context, const ALchar *fname) {
     void *pfn;
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetProcAddressDirect != NULL) return direct->alGetProcAddressDirect(context, fname);
     ALEXP_CONTEXT_WRAP(context, (pfn =  alGetProcAddress(fname)))
     return pfn;
 }
 ALenum          alGetEnumValueExplicitEXT       (ALCcontext* context, const ALchar *ename) {
     ALenum e;
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetEnumValueDirect != NULL) return direct->alGetEnumValueDirect(context, ename);
     ALEXP_CONTEXT_WRAP(context, (e = alGetEnumValue(ename)))
     return e;
 }
 
 void            alGenSourcesExplicitEXT         (ALCcontext* context, ALsizei n, ALuint *sources) {
-    ALEXP_CONTEXT_WRAP(context, (alGenSources(n, sources)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(sources != NULL && n > 0) memset(sources, 0, (size_t) n * sizeof(ALuint));
+    if(direct->alGenSourcesDirect != NULL) direct->alGenSourcesDirect(context, n, sources);
+    else ALEXP_CONTEXT_WRAP(context, (alGenSources(n, sources)))
+    if(sources != NULL) {
+        alexp_add_routes_(&alexp_source_routes_, n, sources, context);
+        alexp_mirror_gen_sources_(context, n, sources);
+    }
 }
 void            alDeleteSourcesExplicitEXT      (ALCcontext* context, ALsizei n, const ALuint *sources) {
-    ALEXP_CONTEXT_WRAP(context, (alDeleteSources(n, sources)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alDeleteSourcesDirect != NULL) direct->alDeleteSourcesDirect(context, n, sources);
+    else ALEXP_CONTEXT_WRAP(context, (alDeleteSources(n, sources)))
+    alexp_remove_routes_(&alexp_source_routes_, n, sources, context);
+    alexp_mirror_delete_sources_(context, n, sources);
 }
 ALboolean       alIsSourceExplicitEXT           (ALCcontext* context, ALuint source) {
     ALboolean isSource;
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alIsSourceDirect != NULL) return direct->alIsSourceDirect(context, source);
     ALEXP_CONTEXT_WRAP(context, (isSource = alIsSource(source)))
     return isSource;
 }
 void            alSourcePlayvExplicitEXT        (ALCcontext* context, ALsizei n, const ALuint *sources) {
-    ALEXP_CONTEXT_WRAP(context, (alSourcePlayv(n, sources)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(alexp_record_sources_(context, ALEXP_OP_SOURCE_PLAYV_, n, sources)) return;
+    if(direct->alSourcePlayvDirect != NULL) direct->alSourcePlayvDirect(context, n, sources);
+    else ALEXP_CONTEXT_WRAP(context, (alSourcePlayv(n, sources)))
+    alexp_mirror_statev_(context, n, sources, ALEXP_MIRROR_PLAY_);
 }
 void            alSourceStopvExplicitEXT        (ALCcontext* context, ALsizei n, const ALuint *sources) {
-    ALEXP_CONTEXT_WRAP(context, (alSourceStopv(n, sources)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(alexp_record_sources_(context, ALEXP_OP_SOURCE_STOPV_, n, sources)) return;
+    if(direct->alSourceStopvDirect != NULL) direct->alSourceStopvDirect(context, n, sources);
+    else ALEXP_CONTEXT_WRAP(context, (alSourceStopv(n, sources)))
+    alexp_mirror_statev_(context, n, sources, ALEXP_MIRROR_STOP_);
 }
 void            alSourceRewindvExplicitEXT      (ALCcontext* context, ALsizei n, const ALuint *sources) {
-    ALEXP_CONTEXT_WRAP(context, (alSourceRewindv(n, sources)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(alexp_record_sources_(context, ALEXP_OP_SOURCE_REWINDV_, n, sources)) return;
+    if(direct->alSourceRewindvDirect != NULL) direct->alSourceRewindvDirect(context, n, sources);
+    else ALEXP_CONTEXT_WRAP(context, (alSourceRewindv(n, sources)))
+    alexp_mirror_statev_(context, n, sources, ALEXP_MIRROR_REWIND_);
 }
 void            alSourcePausevExplicitEXT       (ALCcontext* context, ALsizei n, const ALuint *sources) {
-    ALEXP_CONTEXT_WRAP(context, (alSourcePausev(n, sources)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(alexp_record_sources_(context, ALEXP_OP_SOURCE_PAUSEV_, n, sources)) return;
+    if(direct->alSourcePausevDirect != NULL) direct->alSourcePausevDirect(context, n, sources);
+    else ALEXP_CONTEXT_WRAP(context, (alSourcePausev(n, sources)))
+    alexp_mirror_statev_(context, n, sources, ALEXP_MIRROR_PAUSE_);
 }
 
 
 
 void            alListenerfExplicitEXT          (ALlistener listener, ALenum param, ALfloat value) {
-    ALEXP_LISTENER_WRAP(listener, (alListenerf(param, value)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(alexp_record_floats_(listener, ALEXP_OP_LISTENERF_, param, 1, &value)) return;
+    if(direct->alListenerfDirect != NULL) direct->alListenerfDirect(listener, param, value);
+    else ALEXP_LISTENER_WRAP(listener, (alListenerf(param, value)))
 }
 void            alListener3fExplicitEXT         (ALlistener listener, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3) {
-    ALEXP_LISTENER_WRAP(listener, (alListener3f(param, value1, value2, value3)))
+    ALfloat values[3];
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    values[0] = value1; values[1] = value2; values[2] = value3;
+    if(alexp_record_floats_(listener, ALEXP_OP_LISTENER3F_, param, 3, values)) return;
+    if(direct->alListener3fDirect != NULL) direct->alListener3fDirect(listener, param, value1, value2, value3);
+    else ALEXP_LISTENER_WRAP(listener, (alListener3f(param, value1, value2, value3)))
 }
 void            alListenerfvExplicitEXT         (ALlistener listener, ALenum param, const ALfloat *values) {
-    ALEXP_LISTENER_WRAP(listener, (alListenerfv(param, values)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(alexp_record_floats_(listener, ALEXP_OP_LISTENERFV_, param, alexp_listener_values_(param), values)) return;
+    if(direct->alListenerfvDirect != NULL) direct->alListenerfvDirect(listener, param, values);
+    else ALEXP_LISTENER_WRAP(listener, (alListenerfv(param, values)))
 }
 void            alListeneriExplicitEXT          (ALlistener listener, ALenum param, ALint value) {
-    ALEXP_LISTENER_WRAP(listener, (alListeneri(param, value)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(alexp_record_ints_(listener, ALEXP_OP_LISTENERI_, param, 1, &value)) return;
+    if(direct->alListeneriDirect != NULL) direct->alListeneriDirect(listener, param, value);
+    else ALEXP_LISTENER_WRAP(listener, (alListeneri(param, value)))
 }
 void            alListener3iExplicitEXT         (ALlistener listener, ALenum param, ALint value1, ALint value2, ALint value3) {
-    ALEXP_LISTENER_WRAP(listener, (alListener3i(param, value1, value2, value3)))
+    ALint values[3];
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    values[0] = value1; values[1] = value2; values[2] = value3;
+    if(alexp_record_ints_(listener, ALEXP_OP_LISTENER3I_, param, 3, values)) return;
+    if(direct->alListener3iDirect != NULL) direct->alListener3iDirect(listener, param, value1, value2, value3);
+    else ALEXP_LISTENER_WRAP(listener, (alListener3i(param, value1, value2, value3)))
 }
 void            alListenerivExplicitEXT         (ALlistener listener, ALenum param, const ALint *values) {
-    ALEXP_LISTENER_WRAP(listener, (alListeneriv(param, values)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(alexp_record_ints_(listener, ALEXP_OP_LISTENERIV_, param, alexp_listener_values_(param), values)) return;
+    if(direct->alListenerivDirect != NULL) direct->alListenerivDirect(listener, param, values);
+    else ALEXP_LISTENER_WRAP(listener, (alListeneriv(param, values)))
 }
 void            alGetListenerfExplicitEXT       (ALlistener listener, ALenum param, ALfloat *value) {
-    ALEXP_LISTENER_WRAP(listener, (alGetListenerf(param, value)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetListenerfDirect != NULL) direct->alGetListenerfDirect(listener, param, value);
+    else ALEXP_LISTENER_WRAP(listener, (alGetListenerf(param, value)))
 }
 void            alGetListener3fExplicitEXT      (ALlistener listener, ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3) {
-    ALEXP_LISTENER_WRAP(listener, (alGetListener3f(param, value1, value2, value3)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetListener3fDirect != NULL) direct->alGetListener3fDirect(listener, param, value1, value2, value3);
+    else ALEXP_LISTENER_WRAP(listener, (alGetListener3f(param, value1, value2, value3)))
 }
 void            alGetListenerfvExplicitEXT      (ALlistener listener, ALenum param, ALfloat *values) {
-    ALEXP_LISTENER_WRAP(listener, (alGetListenerfv(param, values)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetListenerfvDirect != NULL) direct->alGetListenerfvDirect(listener, param, values);
+    else ALEXP_LISTENER_WRAP(listener, (alGetListenerfv(param, values)))
 }
 void            alGetListeneriExplicitEXT       (ALlistener listener, ALenum param, ALint *value) {
-    ALEXP_LISTENER_WRAP(listener, (alGetListeneri(param, value)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetListeneriDirect != NULL) direct->alGetListeneriDirect(listener, param, value);
+    else ALEXP_LISTENER_WRAP(listener, (alGetListeneri(param, value)))
 }
 void            alGetListener3iExplicitEXT      (ALlistener listener, ALenum param, ALint *value1, ALint *value2, ALint *value3) {
-    ALEXP_LISTENER_WRAP(listener, (alGetListener3i(param, value1, value2, value3)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetListener3iDirect != NULL) direct->alGetListener3iDirect(listener, param, value1, value2, value3);
+    else ALEXP_LISTENER_WRAP(listener, (alGetListener3i(param, value1, value2, value3)))
 }
 void            alGetListenerivExplicitEXT      (ALlistener listener, ALenum param, ALint *values) {
-    ALEXP_LISTENER_WRAP(listener, (alGetListeneriv(param, values)))
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetListenerivDirect != NULL) direct->alGetListenerivDirect(listener, param, values);
+    else ALEXP_LISTENER_WRAP(listener, (alGetListeneriv(param, values)))
 }
 
 
@@ -301,16 +1444,251 @@ void            alGetListenerivExplicitEXT      (ALlistener listener, ALenum par
 
 
 
+void            alSourcefExplicitEXT            (ALuint source, ALenum param, ALfloat value) {
+    ALCcontext* context = alexp_source_context_(source);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(alexp_record_source_floats_(context, ALEXP_OP_SOURCEF_, source, param, 1, &value)) return;
+    if(direct->alSourcefDirect != NULL) direct->alSourcefDirect(context, source, param, value);
+    else ALEXP_CONTEXT_WRAP(context, (alSourcef(source, param, value)))
+    ALEXP_MIRROR_SOURCE(context, source, (alSourcef(mirror, param, value)))
+}
+void            alSource3fExplicitEXT           (ALuint source, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3) {
+    ALfloat values[3];
+    ALCcontext* context = alexp_source_context_(source);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    values[0] = value1; values[1] = value2; values[2] = value3;
+    if(alexp_record_source_floats_(context, ALEXP_OP_SOURCE3F_, source, param, 3, values)) return;
+    if(direct->alSource3fDirect != NULL) direct->alSource3fDirect(context, source, param, value1, value2, value3);
+    else ALEXP_CONTEXT_WRAP(context, (alSource3f(source, param, value1, value2, value3)))
+    ALEXP_MIRROR_SOURCE(context, source, (alSource3f(mirror, param, value1, value2, value3)))
+}
+void            alSourcefvExplicitEXT           (ALuint source, ALenum param, const ALfloat *values) {
+    ALCcontext* context = alexp_source_context_(source);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(alexp_record_source_floats_(context, ALEXP_OP_SOURCEFV_, source, param, alexp_source_values_(param), values)) return;
+    if(direct->alSourcefvDirect != NULL) direct->alSourcefvDirect(context, source, param, values);
+    else ALEXP_CONTEXT_WRAP(context, (alSourcefv(source, param, values)))
+    ALEXP_MIRROR_SOURCE(context, source, (alSourcefv(mirror, param, values)))
+}
+void            alSourceiExplicitEXT            (ALuint source, ALenum param, ALint value) {
+    ALCcontext* context = alexp_source_context_(source);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(alexp_record_source_ints_(context, ALEXP_OP_SOURCEI_, source, param, 1, &value)) return;
+    if(direct->alSourceiDirect != NULL) direct->alSourceiDirect(context, source, param, value);
+    else ALEXP_CONTEXT_WRAP(context, (alSourcei(source, param, value)))
+    ALEXP_MIRROR_SOURCE(context, source, (param == AL_BUFFER ? alexp_mirror_set_buffer_(listener, source, value) : alSourcei(mirror, param, value)))
+}
+void            alSource3iExplicitEXT           (ALuint source, ALenum param, ALint value1, ALint value2, ALint value3) {
+    ALint values[3];
+    ALCcontext* context = alexp_source_context_(source);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    values[0] = value1; values[1] = value2; values[2] = value3;
+    if(alexp_record_source_ints_(context, ALEXP_OP_SOURCE3I_, source, param, 3, values)) return;
+    if(direct->alSource3iDirect != NULL) direct->alSource3iDirect(context, source, param, value1, value2, value3);
+    else ALEXP_CONTEXT_WRAP(context, (alSource3i(source, param, value1, value2, value3)))
+    ALEXP_MIRROR_SOURCE(context, source, (alSource3i(mirror, param, value1, value2, value3)))
+}
+void            alSourceivExplicitEXT           (ALuint source, ALenum param, const ALint *values) {
+    ALCcontext* context = alexp_source_context_(source);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(alexp_record_source_ints_(context, ALEXP_OP_SOURCEIV_, source, param, alexp_source_values_(param), values)) return;
+    if(direct->alSourceivDirect != NULL) direct->alSourceivDirect(context, source, param, values);
+    else ALEXP_CONTEXT_WRAP(context, (alSourceiv(source, param, values)))
+    ALEXP_MIRROR_SOURCE(context, source, (alSourceiv(mirror, param, values)))
+}
+void            alGetSourcefExplicitEXT         (ALuint source, ALenum param, ALfloat *value) {
+    ALCcontext* context = alexp_source_context_(source);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetSourcefDirect != NULL) direct->alGetSourcefDirect(context, source, param, value);
+    else ALEXP_CONTEXT_WRAP(context, (alGetSourcef(source, param, value)))
+}
+void            alGetSource3fExplicitEXT        (ALuint source, ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3) {
+    ALCcontext* context = alexp_source_context_(source);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetSource3fDirect != NULL) direct->alGetSource3fDirect(context, source, param, value1, value2, value3);
+    else ALEXP_CONTEXT_WRAP(context, (alGetSource3f(source, param, value1, value2, value3)))
+}
+void            alGetSourcefvExplicitEXT        (ALuint source, ALenum param, ALfloat *values) {
+    ALCcontext* context = alexp_source_context_(source);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetSourcefvDirect != NULL) direct->alGetSourcefvDirect(context, source, param, values);
+    else ALEXP_CONTEXT_WRAP(context, (alGetSourcefv(source, param, values)))
+}
+void            alGetSourceiExplicitEXT         (ALuint source, ALenum param, ALint *value) {
+    ALCcontext* context = alexp_source_context_(source);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetSourceiDirect != NULL) direct->alGetSourceiDirect(context, source, param, value);
+    else ALEXP_CONTEXT_WRAP(context, (alGetSourcei(source, param, value)))
+}
+void            alGetSource3iExplicitEXT        (ALuint source, ALenum param, ALint *value1, ALint *value2, ALint *value3) {
+    ALCcontext* context = alexp_source_context_(source);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetSource3iDirect != NULL) direct->alGetSource3iDirect(context, source, param, value1, value2, value3);
+    else ALEXP_CONTEXT_WRAP(context, (alGetSource3i(source, param, value1, value2, value3)))
+}
+void            alGetSourceivExplicitEXT        (ALuint source, ALenum param, ALint *values) {
+    ALCcontext* context = alexp_source_context_(source);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alGetSourceivDirect != NULL) direct->alGetSourceivDirect(context, source, param, values);
+    else ALEXP_CONTEXT_WRAP(context, (alGetSourceiv(source, param, values)))
+}
+void            alSourcePlayExplicitEXT         (ALuint source) {
+    ALCcontext* context = alexp_source_context_(source);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(alexp_record_sources_(context, ALEXP_OP_SOURCE_PLAYV_, 1, &source)) return;
+    if(direct->alSourcePlayDirect != NULL) direct->alSourcePlayDirect(context, source);
+    else ALEXP_CONTEXT_WRAP(context, (alSourcePlay(source)))
+    ALEXP_MIRROR_SOURCE(context, source, (alSourcePlay(mirror)))
+}
+void            alSourceStopExplicitEXT         (ALuint source) {
+    ALCcontext* context = alexp_source_context_(source);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(alexp_record_sources_(context, ALEXP_OP_SOURCE_STOPV_, 1, &source)) return;
+    if(direct->alSourceStopDirect != NULL) direct->alSourceStopDirect(context, source);
+    else ALEXP_CONTEXT_WRAP(context, (alSourceStop(source)))
+    ALEXP_MIRROR_SOURCE(context, source, (alSourceStop(mirror)))
+}
+void            alSourceRewindExplicitEXT       (ALuint source) {
+    ALCcontext* context = alexp_source_context_(source);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(alexp_record_sources_(context, ALEXP_OP_SOURCE_REWINDV_, 1, &source)) return;
+    if(direct->alSourceRewindDirect != NULL) direct->alSourceRewindDirect(context, source);
+    else ALEXP_CONTEXT_WRAP(context, (alSourceRewind(source)))
+    ALEXP_MIRROR_SOURCE(context, source, (alSourceRewind(mirror)))
+}
+void            alSourcePauseExplicitEXT        (ALuint source) {
+    ALCcontext* context = alexp_source_context_(source);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(alexp_record_sources_(context, ALEXP_OP_SOURCE_PAUSEV_, 1, &source)) return;
+    if(direct->alSourcePauseDirect != NULL) direct->alSourcePauseDirect(context, source);
+    else ALEXP_CONTEXT_WRAP(context, (alSourcePause(source)))
+    ALEXP_MIRROR_SOURCE(context, source, (alSourcePause(mirror)))
+}
+void            alSourceQueueBuffersExplicitEXT (ALuint source, ALsizei nb, const ALuint *buffers) {
+    ALCcontext* context = alexp_source_context_(source);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(direct->alSourceQueueBuffersDirect != NULL) direct->alSourceQueueBuffersDirect(context, source, nb, buffers);
+    else ALEXP_CONTEXT_WRAP(context, (alSourceQueueBuffers(source, nb, buffers)))
+    ALEXP_MIRROR_SOURCE(context, source, (alexp_mirror_queue_(listener, source, nb, buffers, AL_TRUE)))
+}
+void            alSourceUnqueueBuffersExplicitEXT (ALuint source, ALsizei nb, ALuint *buffers) {
+    ALCcontext* context = alexp_source_context_(source);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    if(buffers != NULL && nb > 0) memset(buffers, 0, (size_t) nb * sizeof(ALuint));
+    if(direct->alSourceUnqueueBuffersDirect != NULL) direct->alSourceUnqueueBuffersDirect(context, source, nb, buffers);
+    else ALEXP_CONTEXT_WRAP(context, (alSourceUnqueueBuffers(source, nb, buffers)))
+    ALEXP_MIRROR_SOURCE(context, source, (alexp_mirror_queue_(listener, source, nb, buffers, AL_FALSE)))
+}
+void            alBufferDataExplicitEXT         (ALuint buffer, ALenum format, const ALvoid *data, ALsizei size, ALsizei samplerate) {
+    ALCdevice* device = alexp_buffer_device_(buffer);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    ALCcontext* context = direct->alBufferDataDirect != NULL ? alexp_device_context_(device) : NULL;
+    if(context != NULL) direct->alBufferDataDirect(context, buffer, format, data, size, samplerate);
+    else ALEXP_DEVICE_WRAP(device, (alBufferData(buffer, format, data, size, samplerate)));
+#ifdef ALEXP_LISTENER_BUFFER_DATA
+    alexp_keep_buffer_data_(device, buffer, format, data, size, samplerate);
+#endif
+    ALEXP_MIRROR_BUFFER(device, buffer, (alexp_mirror_buffer_data_(listener, mirror, format, data, size, samplerate)))
+}
+void            alBufferfExplicitEXT            (ALuint buffer, ALenum param, ALfloat value) {
+    ALCdevice* device = alexp_buffer_device_(buffer);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    ALCcontext* context = direct->alBufferfDirect != NULL ? alexp_device_context_(device) : NULL;
+    if(context != NULL) direct->alBufferfDirect(context, buffer, param, value);
+    else ALEXP_DEVICE_WRAP(device, (alBufferf(buffer, param, value)));
+    ALEXP_MIRROR_BUFFER(device, buffer, (alBufferf(mirror, param, value)))
+}
+void            alBufferiExplicitEXT            (ALuint buffer, ALenum param, ALint value) {
+    ALCdevice* device = alexp_buffer_device_(buffer);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    ALCcontext* context = direct->alBufferiDirect != NULL ? alexp_device_context_(device) : NULL;
+    if(context != NULL) direct->alBufferiDirect(context, buffer, param, value);
+    else ALEXP_DEVICE_WRAP(device, (alBufferi(buffer, param, value)));
+    ALEXP_MIRROR_BUFFER(device, buffer, (alBufferi(mirror, param, value)))
+}
+void            alGetBufferfExplicitEXT         (ALuint buffer, ALenum param, ALfloat *value) {
+    ALCdevice* device = alexp_buffer_device_(buffer);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    ALCcontext* context = direct->alGetBufferfDirect != NULL ? alexp_device_context_(device) : NULL;
+    if(context != NULL) direct->alGetBufferfDirect(context, buffer, param, value);
+    else ALEXP_DEVICE_WRAP(device, (alGetBufferf(buffer, param, value)));
+}
+void            alGetBufferiExplicitEXT         (ALuint buffer, ALenum param, ALint *value) {
+    ALCdevice* device = alexp_buffer_device_(buffer);
+    const aladDirectFunctions* direct = alexp_direct_functions_();
+    ALCcontext* context = direct->alGetBufferiDirect != NULL ? alexp_device_context_(device) : NULL;
+    if(context != NULL) direct->alGetBufferiDirect(context, buffer, param, value);
+    else ALEXP_DEVICE_WRAP(device, (alGetBufferi(buffer, param, value)));
+}
+
+
+
 ALlistener      alCreateListenerEXT             (ALCcontext* context) {
-  return context;
+    alexp_listener_t_* listener = NULL;
+    ALCint attributes[7];
+    ALCint frequency = 0;
+    size_t i;
+    if(context == NULL || alcLoopbackOpenDeviceSOFT == NULL || alcRenderSamplesSOFT == NULL) return context;
+    alexp_spin_lock_(&alexp_lock_);
+    for(i = 0; i < ALEXP_LISTENERS && listener == NULL; i++) {
+        if(alexp_listeners_[i].claimed == 0) listener = &alexp_listeners_[i];
+    }
+    if(listener != NULL) listener->claimed = 1;
+    alexp_spin_unlock_(&alexp_lock_);
+    if(listener == NULL) return context;
+    listener->parent = context;
+    listener->parentDevice = alcGetContextsDevice(context);
+    if(listener->parentDevice != NULL) alcGetIntegerv(listener->parentDevice, ALC_FREQUENCY, 1, &frequency);
+    attributes[0] = ALC_FORMAT_CHANNELS_SOFT;
+    attributes[1] = ALC_STEREO_SOFT;
+    attributes[2] = ALC_FORMAT_TYPE_SOFT;
+    attributes[3] = ALC_FLOAT_SOFT;
+    attributes[4] = ALC_FREQUENCY;
+    attributes[5] = frequency > 0 ? frequency : 48000;
+    attributes[6] = 0;
+    listener->samples = REINTERPRET_CAST(ALfloat*, malloc((size_t) ALEXP_LISTENER_FRAMES * 2 * sizeof(ALfloat)));
+    if(listener->samples != NULL) listener->device = alcLoopbackOpenDeviceSOFT(NULL);
+    if(listener->device != NULL) listener->context = alcCreateContext(listener->device, attributes);
+    if(listener->context == NULL) {
+        if(listener->device != NULL) alcCloseDevice(listener->device);
+        free(listener->samples);
+        listener->samples = NULL;
+        listener->device = NULL;
+        alexp_atomic_store_long_(&listener->claimed, 0);
+        return context;
+    }
+    /* the listener goes live before the replay, so the objects generated meanwhile are either in it or mirrored right after it */
+    alexp_atomic_add_long_(&alexp_listener_count_, 1);
+    alexp_atomic_store_long_(&listener->live, 1);
+    if(alexp_enter_listener_(listener)) {
+        alexp_replay_listener_(listener);
+        alexp_leave_listener_(listener);
+    }
+    return listener->context;
 }
 ALboolean       alIsListenerinContextEXT        (ALCcontext* context, ALlistener listener) {
-  return context == listener;
+    return context == listener || alexp_find_listener_(context, listener) != NULL;
 }
 void            alDestroyListenerEXT            (ALCcontext* context, ALlistener listener) {
-        /* currently not needed, but could perform this check among other things */
-   /* assert(alIsListenerinContextEXT(context,listener)); */ 
-   (void)0;
+    alexp_listener_t_* found = alexp_find_listener_(context, listener);
+    if(found == NULL || alexp_atomic_exchange_long_(&found->live, 0) == 0) return;
+    alexp_atomic_add_long_(&alexp_listener_count_, -1);
+    while(alexp_atomic_add_long_(&found->users, 0) != 0);
+    alcDestroyContext(found->context);
+    alcCloseDevice(found->device);
+    free(found->sources.entries);
+    free(found->buffers.entries);
+    free(found->samples);
+    /* live and users stay as they are, a user may still count itself in and out again until it sees that live is 0 */
+    memset(&found->sources, 0, sizeof(alexp_routes_t_));
+    memset(&found->buffers, 0, sizeof(alexp_routes_t_));
+    found->parent = NULL;
+    found->parentDevice = NULL;
+    found->device = NULL;
+    found->context = NULL;
+    found->samples = NULL;
+    found->unqueue = 0;
+    alexp_atomic_store_long_(&found->claimed, 0);
 }
 
 #endif /* OPENAL_EXPLICIT_POLYFILL_IMPLEMENTATION */
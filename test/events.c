@@ -0,0 +1,114 @@
+/*
+ *  events.c: checks the event queue of alad-utils.h, first on one thread and then with several threads calling the event callback at
+ *  once while another one waits for and takes the events, against stand-ins for the AL_SOFT_events functions instead of an OpenAL
+ *  implementation. Every event has to come out exactly once, in the order its thread sent it, or be counted as dropped.
+ *
+ *  Build and run it with
+ *
+ *      cc -I[path to the AL headers] -o events events.c -ldl -lpthread
+ *      ./events
+ *
+ *  It needs POSIX threads. The program prints the failed checks and exits with 1 if there are any.
+ */
+
+#define ALAD_IMPLEMENTATION
+#define ALAD_UTILS_IMPLEMENTATION
+#include "../alad.h"
+#include "../alad-utils.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+
+#define PRODUCERS   4
+#define EVENTS      20000
+#define CAPACITY    64
+
+static ALEVENTPROCSOFT  callback_ = NULL;
+static int              failures_ = 0;
+
+static void AL_APIENTRY stub_event_callback_ (ALEVENTPROCSOFT callback, void* userParam) {
+    (void) userParam;
+    callback_ = callback;
+}
+static void AL_APIENTRY stub_event_control_ (ALsizei count, const ALenum* types, ALboolean enable) {
+    (void) count;
+    (void) types;
+    (void) enable;
+}
+
+/* sends EVENTS source state changes for the source numbered like the thread, with the count so far as the state, and lets the others
+   run now and then, so that on a single core the queue doesn't just overflow */
+static void* producer_ (void* argument) {
+    ALuint source = (ALuint) (size_t) argument;
+    ALuint i;
+    for(i = 1; i <= EVENTS; i++) {
+        callback_(AL_EVENT_TYPE_SOURCE_STATE_CHANGED_SOFT, source, i, 0, "", NULL);
+        if(i % 16 == 0) sched_yield();
+    }
+    return NULL;
+}
+
+static void check_ (int condition, const char* what) {
+    if(condition) return;
+    printf("failed: %s\n", what);
+    failures_++;
+}
+
+int main (void) {
+    pthread_t producers[PRODUCERS];
+    aladEvent events[CAPACITY];
+    ALuint last[PRODUCERS + 1] = { 0 };
+    unsigned long received = 0, dropped = 0, total = (unsigned long) PRODUCERS * EVENTS;
+    int ordered = 1, known = 1, idle = 0;
+    ALsizei n, i;
+
+    aladAL.EventCallbackSOFT = stub_event_callback_;
+    aladAL.EventControlSOFT = stub_event_control_;
+    check_(aladEnableEventQueue(CAPACITY) == AL_TRUE && callback_ != NULL, "the queue registers its callback");
+    if(callback_ == NULL) return 1;
+
+    check_(aladWaitEvents(0) == AL_FALSE, "an empty queue has nothing to wait for");
+    for(i = 0; i < CAPACITY + 3; i++) callback_(AL_EVENT_TYPE_BUFFER_COMPLETED_SOFT, 1, (ALuint) i, 0, "", NULL);
+    check_(aladWaitEvents(0) == AL_TRUE, "a queued event ends the wait");
+    n = aladPollEvents(events, CAPACITY);
+    check_(n == CAPACITY && events[0].param == 0 && events[CAPACITY - 1].param == CAPACITY - 1, "a full queue keeps the events that came first");
+    check_(aladPollEvents(events, CAPACITY) == 0, "polling takes them out");
+    check_(aladGetDroppedEvents(AL_TRUE) == 3, "the events that didn't fit are counted");
+    check_(aladGetDroppedEvents(AL_FALSE) == 0, "and the count is reset");
+    aladWaitEvents(0);
+
+    for(i = 0; i < PRODUCERS; i++) pthread_create(&producers[i], NULL, producer_, (void*) (size_t) (i + 1));
+    /* a wait that times out several times in a row without anything arriving means the events got lost */
+    while(received + dropped < total && idle < 50) {
+        if(!aladWaitEvents(100)) {
+            idle++;
+        } else {
+            idle = 0;
+        }
+        while((n = aladPollEvents(events, CAPACITY)) > 0) {
+            for(i = 0; i < n; i++) {
+                if(events[i].object < 1 || events[i].object > PRODUCERS) {
+                    known = 0;
+                    continue;
+                }
+                if(events[i].param <= last[events[i].object]) ordered = 0;
+                last[events[i].object] = events[i].param;
+            }
+            received += (unsigned long) n;
+        }
+        dropped = aladGetDroppedEvents(AL_FALSE);
+    }
+    for(i = 0; i < PRODUCERS; i++) pthread_join(producers[i], NULL);
+    received += (unsigned long) aladPollEvents(events, CAPACITY);
+    dropped = aladGetDroppedEvents(AL_FALSE);
+
+    check_(known, "every event comes from one of the threads");
+    check_(ordered, "the events of a thread come out in the order it sent them");
+    check_(received + dropped == total, "every event comes out or is counted as dropped");
+    aladDisableEventQueue();
+    check_(callback_ == NULL, "disabling the queue unregisters its callback");
+
+    if(failures_ == 0) printf("all checks passed\n");
+    return failures_ != 0 ? 1 : 0;
+}
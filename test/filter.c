@@ -0,0 +1,111 @@
+/*
+ *  filter.c: checks which writes the filter of alad-utils.h drops and which it passes on to the driver, against stand-ins for the
+ *  driver functions instead of an OpenAL implementation.
+ *
+ *  Build and run it with
+ *
+ *      cc -I[path to the AL headers] -o filter filter.c -ldl
+ *      ./filter
+ *
+ *  The program prints the failed checks and exits with 1 if there are any.
+ */
+
+#define ALAD_IMPLEMENTATION
+#define ALAD_UTILS_IMPLEMENTATION
+#include "../alad.h"
+#include "../alad-utils.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static char         contexts_[2];
+static ALCcontext*  current_ = NULL;
+static ALuint       nextSource_ = 1;
+static int          writes_ = 0;
+static int          failures_ = 0;
+
+static ALCcontext* ALC_APIENTRY stub_get_current_context_ (void) {
+    return current_;
+}
+static void AL_APIENTRY stub_gen_sources_ (ALsizei n, ALuint* sources) {
+    ALsizei i;
+    for(i = 0; i < n; i++) sources[i] = nextSource_++;
+}
+static void AL_APIENTRY stub_delete_sources_ (ALsizei n, const ALuint* sources) {
+    (void) n;
+    (void) sources;
+}
+static void AL_APIENTRY stub_sourcef_ (ALuint source, ALenum param, ALfloat value) {
+    (void) source;
+    (void) param;
+    (void) value;
+    writes_++;
+}
+static void AL_APIENTRY stub_sourcei_ (ALuint source, ALenum param, ALint value) {
+    (void) source;
+    (void) param;
+    (void) value;
+    writes_++;
+}
+
+static void check_ (int condition, const char* what) {
+    if(condition) return;
+    printf("failed: %s\n", what);
+    failures_++;
+}
+
+int main (void) {
+    ALCcontext* a = (ALCcontext*) &contexts_[0];
+    ALCcontext* b = (ALCcontext*) &contexts_[1];
+    aladFilterStatistics statistics;
+    ALfloat half = 0.5f;
+    ALint halfBits;
+    ALuint source;
+
+    aladALC.GetCurrentContext = stub_get_current_context_;
+    aladAL.GenSources = stub_gen_sources_;
+    aladAL.DeleteSources = stub_delete_sources_;
+    aladAL.Sourcef = stub_sourcef_;
+    aladAL.Sourcei = stub_sourcei_;
+    current_ = a;
+    memcpy(&halfBits, &half, sizeof(halfBits));
+
+    check_(aladEnableFilter(4, 4) == AL_TRUE, "the filter is enabled");
+    alGenSources(1, &source);
+
+    alSourcef(source, AL_GAIN, 0.5f);
+    alSourcef(source, AL_GAIN, 0.5f);
+    statistics = aladGetFilterStatistics(AL_TRUE);
+    check_(writes_ == 1, "a repeated write is dropped");
+    check_(statistics.writes == 2 && statistics.dropped == 1, "the dropped write is counted");
+
+    writes_ = 0;
+    alSourcei(source, AL_GAIN, halfBits);
+    check_(writes_ == 1, "an int write with the bits of the float before isn't the same value");
+    alSourcef(source, AL_GAIN, 0.5f);
+    check_(writes_ == 2, "nor is the float write after it");
+
+    writes_ = 0;
+    alSourcef(source, AL_GAIN, -1.0f);
+    check_(writes_ == 1, "a value out of range is passed on");
+    alSourcef(source, AL_GAIN, 0.5f);
+    check_(writes_ == 2, "and the value before it is forgotten");
+
+    writes_ = 0;
+    current_ = b;
+    alSourcef(source, AL_GAIN, 0.5f);
+    check_(writes_ == 1, "a write while another context is current is passed on");
+    current_ = a;
+    alSourcef(source, AL_GAIN, 0.5f);
+    check_(writes_ == 2, "and the value is forgotten for the filter's context");
+
+    writes_ = 0;
+    alSourcef(source + 100, AL_GAIN, 0.5f);
+    alSourcef(source + 100, AL_GAIN, 0.5f);
+    check_(writes_ == 2, "the writes to a source that was never generated are passed on");
+
+    alDeleteSources(1, &source);
+    aladDisableFilter();
+    if(failures_ == 0) printf("all checks passed\n");
+    return failures_ != 0 ? 1 : 0;
+}
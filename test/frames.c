@@ -0,0 +1,84 @@
+/*
+ *  frames.c: checks that aladEndFrame applies the held back updates of the context the frame was opened on, even if another context
+ *  was made current in between, against stand-ins for the driver functions instead of an OpenAL implementation.
+ *
+ *  Build and run it with
+ *
+ *      cc -I[path to the AL headers] -o frames frames.c -ldl
+ *      ./frames
+ *
+ *  The program prints the failed checks and exits with 1 if there are any.
+ */
+
+#define ALAD_IMPLEMENTATION
+#include "../alad.h"
+
+#include <stdio.h>
+
+static char         contexts_[2];
+static ALCcontext*  current_ = NULL;
+static ALCcontext*  deferred_ = NULL;
+static ALCcontext*  processed_ = NULL;
+static ALCcontext*  suspended_ = NULL;
+static ALCcontext*  resumed_ = NULL;
+static int          failures_ = 0;
+
+static ALCboolean ALC_APIENTRY stub_make_context_current_ (ALCcontext* context) {
+    current_ = context;
+    return ALC_TRUE;
+}
+static ALCcontext* ALC_APIENTRY stub_get_current_context_ (void) {
+    return current_;
+}
+static void ALC_APIENTRY stub_suspend_context_ (ALCcontext* context) {
+    suspended_ = context;
+}
+static void ALC_APIENTRY stub_process_context_ (ALCcontext* context) {
+    resumed_ = context;
+}
+static void AL_APIENTRY stub_defer_updates_ (void) {
+    deferred_ = current_;
+}
+static void AL_APIENTRY stub_process_updates_ (void) {
+    processed_ = current_;
+}
+
+static void check_ (int condition, const char* what) {
+    if(condition) return;
+    printf("failed: %s\n", what);
+    failures_++;
+}
+
+int main (void) {
+    ALCcontext* a = (ALCcontext*) &contexts_[0];
+    ALCcontext* b = (ALCcontext*) &contexts_[1];
+
+    aladALC.MakeContextCurrent = stub_make_context_current_;
+    aladALC.GetCurrentContext = stub_get_current_context_;
+    aladALC.SuspendContext = stub_suspend_context_;
+    aladALC.ProcessContext = stub_process_context_;
+    aladAL.DeferUpdatesSOFT = stub_defer_updates_;
+    aladAL.ProcessUpdatesSOFT = stub_process_updates_;
+    current_ = a;
+
+    check_(aladBeginFrame(NULL) == a, "a frame without a context opens on the current one");
+    check_(deferred_ == a && suspended_ == NULL, "the current context defers its updates");
+    check_(aladBeginFrame(a) == a, "frames nest");
+    aladEndFrame(a);
+    check_(processed_ == NULL, "an inner end leaves the updates deferred");
+
+    current_ = b;
+    aladEndFrame(a);
+    check_(processed_ == a, "the outermost end processes the updates of the frame's context");
+    check_(current_ == b, "the current context is restored");
+    check_(resumed_ == NULL, "a deferred frame isn't ended with alcProcessContext");
+
+    processed_ = NULL;
+    check_(aladBeginFrame(a) == a, "a frame opens on a context that isn't current");
+    check_(suspended_ == a, "a context that isn't current is suspended");
+    aladEndFrame(a);
+    check_(resumed_ == a && processed_ == NULL, "a suspended frame is ended with alcProcessContext");
+
+    if(failures_ == 0) printf("all checks passed\n");
+    return failures_ != 0 ? 1 : 0;
+}
@@ -0,0 +1,17 @@
+/*
+ *  headers.c: includes the headers together with their implementations, so that "make headers" can check that they compile
+ *  without warnings as C and as C++ in every configuration.
+ */
+
+#define ALAD_IMPLEMENTATION
+#define ALAD_UTILS_IMPLEMENTATION
+#define OPENAL_EXPLICIT_POLYFILL_IMPLEMENTATION
+#include "../alad.h"
+#include "../alad-utils.h"
+#include "../openal-explicit-polyfill.h"
+
+int main (void) {
+    aladLoadAL();
+    aladTerminate();
+    return 0;
+}
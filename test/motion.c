@@ -0,0 +1,74 @@
+/*
+ *  motion.c: checks the velocities aladUpdateSourcesEx derives from the positions of the last call, in particular for indices an
+ *  earlier, longer call left behind, against stand-ins for the driver functions instead of an OpenAL implementation.
+ *
+ *  Build and run it with
+ *
+ *      cc -I[path to the AL headers] -o motion motion.c -ldl
+ *      ./motion
+ *
+ *  The program prints the failed checks and exits with 1 if there are any.
+ */
+
+#define ALAD_IMPLEMENTATION
+#define ALAD_UTILS_IMPLEMENTATION
+#include "../alad.h"
+#include "../alad-utils.h"
+
+#include <stdio.h>
+
+static ALfloat  velocity_[4][3];
+static int      failures_ = 0;
+
+static void AL_APIENTRY stub_source3f_ (ALuint source, ALenum param, ALfloat x, ALfloat y, ALfloat z) {
+    if(param != AL_VELOCITY || source >= 4) return;
+    velocity_[source][0] = x;
+    velocity_[source][1] = y;
+    velocity_[source][2] = z;
+}
+
+static void check_ (int condition, const char* what) {
+    if(condition) return;
+    printf("failed: %s\n", what);
+    failures_++;
+}
+
+int main (void) {
+    aladSourceMotion* motion;
+    ALuint sources[3] = { 1, 2, 3 };
+    ALfloat px[3] = { 0.0f, 0.0f, 0.0f };
+    ALfloat py[3] = { 0.0f, 0.0f, 0.0f };
+    ALfloat pz[3] = { 0.0f, 0.0f, 0.0f };
+
+    aladAL.Source3f = stub_source3f_;
+    motion = aladCreateSourceMotion();
+    check_(motion != NULL, "a motion is created");
+    if(motion == NULL) return 1;
+
+    check_(aladUpdateSourcesEx(motion, 3, sources, px, py, pz, 0.5f) == AL_TRUE, "the first update derives velocities");
+    check_(velocity_[1][0] == 0.0f && velocity_[2][0] == 0.0f && velocity_[3][0] == 0.0f, "new sources start at rest");
+
+    px[0] = 1.0f;
+    aladUpdateSourcesEx(motion, 1, sources, px, py, pz, 0.5f);
+    check_(velocity_[1][0] == 2.0f, "a source that moved 1 in half a second has a velocity of 2");
+
+    px[0] = 2.0f;
+    px[1] = 100.0f;
+    px[2] = 100.0f;
+    aladUpdateSourcesEx(motion, 3, sources, px, py, pz, 0.5f);
+    check_(velocity_[1][0] == 2.0f, "the source the last call reached keeps its velocity");
+    check_(velocity_[2][0] == 0.0f && velocity_[3][0] == 0.0f, "indices the last call didn't reach start at rest again");
+
+    px[1] = 101.0f;
+    aladUpdateSourcesEx(motion, 3, sources, px, py, pz, 0.5f);
+    check_(velocity_[2][0] == 2.0f && velocity_[3][0] == 0.0f, "they move from the positions of the call before");
+
+    sources[1] = 3;
+    sources[2] = 2;
+    aladUpdateSourcesEx(motion, 3, sources, px, py, pz, 0.5f);
+    check_(velocity_[2][0] == 0.0f && velocity_[3][0] == 0.0f, "a source at an index that held another one starts at rest");
+
+    aladDestroySourceMotion(motion);
+    if(failures_ == 0) printf("all checks passed\n");
+    return failures_ != 0 ? 1 : 0;
+}
@@ -0,0 +1,114 @@
+/*
+ *  polyfill-routes.c: checks that openal-explicit-polyfill.h sends calls with a source ID to the context that handed out the source,
+ *  and sends IDs that several contexts handed out to the current context unchanged, against stand-ins for the driver functions instead
+ *  of an OpenAL implementation.
+ *
+ *  Build and run it with
+ *
+ *      cc -I[path to the AL headers] -o polyfill-routes polyfill-routes.c -ldl
+ *      ./polyfill-routes
+ *
+ *  Every context numbers its sources from 1, like OpenAL Soft does. The program prints the failed checks and exits with 1 if there
+ *  are any.
+ */
+
+#define ALAD_IMPLEMENTATION
+#define OPENAL_EXPLICIT_POLYFILL_IMPLEMENTATION
+#include "../openal-explicit-polyfill.h"
+
+#include <stdio.h>
+
+static char         devices_[2];
+static char         contexts_[2];
+static ALCcontext*  current_ = NULL;
+static ALuint       nextSource_[2] = { 1, 1 };
+static ALuint       gainSource_;
+static ALCcontext*  gainContext_;
+static int          failures_ = 0;
+
+static int context_index_ (ALCcontext* context) {
+    return context == (ALCcontext*) &contexts_[1] ? 1 : 0;
+}
+
+static ALCboolean ALC_APIENTRY stub_make_context_current_ (ALCcontext* context) {
+    current_ = context;
+    return ALC_TRUE;
+}
+static ALCcontext* ALC_APIENTRY stub_get_current_context_ (void) {
+    return current_;
+}
+static ALCdevice* ALC_APIENTRY stub_get_contexts_device_ (ALCcontext* context) {
+    return (ALCdevice*) &devices_[context_index_(context)];
+}
+static ALCboolean ALC_APIENTRY stub_is_extension_present_ (ALCdevice* device, const ALCchar* extname) {
+    (void) device;
+    (void) extname;
+    return ALC_FALSE;
+}
+static void AL_APIENTRY stub_gen_sources_ (ALsizei n, ALuint* sources) {
+    ALsizei i;
+    for(i = 0; i < n; i++) sources[i] = nextSource_[context_index_(current_)]++;
+}
+static void AL_APIENTRY stub_delete_sources_ (ALsizei n, const ALuint* sources) {
+    (void) n;
+    (void) sources;
+}
+static void AL_APIENTRY stub_sourcef_ (ALuint source, ALenum param, ALfloat value) {
+    (void) param;
+    (void) value;
+    gainSource_ = source;
+    gainContext_ = current_;
+}
+
+static void check_ (int condition, const char* what) {
+    if(condition) return;
+    printf("failed: %s\n", what);
+    failures_++;
+}
+
+int main (void) {
+    ALCcontext* a = (ALCcontext*) &contexts_[0];
+    ALCcontext* b = (ALCcontext*) &contexts_[1];
+    ALuint sourceA;
+    ALuint sourceB;
+
+    aladALC.MakeContextCurrent = stub_make_context_current_;
+    aladALC.GetCurrentContext = stub_get_current_context_;
+    aladALC.GetContextsDevice = stub_get_contexts_device_;
+    aladALC.IsExtensionPresent = stub_is_extension_present_;
+    aladAL.GenSources = stub_gen_sources_;
+    aladAL.DeleteSources = stub_delete_sources_;
+    aladAL.Sourcef = stub_sourcef_;
+    current_ = a;
+
+    alGenSourcesExplicitEXT(a, 1, &sourceA);
+    check_(sourceA == 1, "the first context hands out source 1");
+    alSourcefExplicitEXT(sourceA, AL_GAIN, 0.5f);
+    check_(gainSource_ == 1 && gainContext_ == a, "a source of one context goes to that context");
+
+    current_ = b;
+    alGenSourcesExplicitEXT(b, 1, &sourceB);
+    check_(sourceB == 1, "the second context hands out source 1 as well");
+    current_ = a;
+    alSourcefExplicitEXT(1, AL_GAIN, 0.5f);
+    check_(gainSource_ == 1 && gainContext_ == a, "source 1 of both contexts goes to the current context unchanged");
+    current_ = b;
+    alSourcefExplicitEXT(1, AL_GAIN, 0.5f);
+    check_(gainSource_ == 1 && gainContext_ == b, "source 1 of both contexts follows the current context");
+    current_ = a;
+
+    alDeleteSourcesExplicitEXT(a, 1, &sourceA);
+    alSourcefExplicitEXT(1, AL_GAIN, 0.5f);
+    check_(gainSource_ == 1 && gainContext_ == b, "source 1 goes to the second context once the first deleted its own");
+    check_(current_ == a, "the current context is restored");
+
+    alDeleteSourcesExplicitEXT(b, 1, &sourceB);
+    current_ = b;
+    alGenSourcesExplicitEXT(b, 1, &sourceB);
+    current_ = a;
+    alSourcefExplicitEXT(sourceB, AL_GAIN, 0.5f);
+    check_(gainSource_ == 2 && gainContext_ == b, "a new source of the second context goes to the second context");
+
+    if(failures_ == 0) printf("all checks passed\n");
+    return failures_ != 0 ? 1 : 0;
+}
@@ -0,0 +1,114 @@
+/*
+ *  pool.c: checks acquiring, releasing and recycling the sources of an aladSourcePool of alad-utils.h on one thread, with and without
+ *  an aladSourceCache, against stand-ins for the driver functions instead of an OpenAL implementation.
+ *
+ *  Build and run it with
+ *
+ *      cc -I[path to the AL headers] -o pool pool.c -ldl
+ *      ./pool
+ *
+ *  The program prints the failed checks and exits with 1 if there are any.
+ */
+
+#define ALAD_IMPLEMENTATION
+#define ALAD_UTILS_IMPLEMENTATION
+#include "../alad.h"
+#include "../alad-utils.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static ALuint   nextSource_ = 10;
+static ALsizei  stopped_ = 0;
+static ALsizei  detached_ = 0;
+static ALsizei  deleted_ = 0;
+static int      failures_ = 0;
+
+static ALenum AL_APIENTRY stub_get_error_ (void) {
+    return AL_NO_ERROR;
+}
+static void AL_APIENTRY stub_gen_sources_ (ALsizei n, ALuint* sources) {
+    ALsizei i;
+    for(i = 0; i < n; i++) sources[i] = nextSource_++;
+}
+static void AL_APIENTRY stub_delete_sources_ (ALsizei n, const ALuint* sources) {
+    (void) sources;
+    deleted_ += n;
+}
+static void AL_APIENTRY stub_source_stopv_ (ALsizei n, const ALuint* sources) {
+    (void) sources;
+    stopped_ += n;
+}
+static void AL_APIENTRY stub_sourcef_ (ALuint source, ALenum param, ALfloat value) {
+    (void) source;
+    (void) param;
+    (void) value;
+}
+static void AL_APIENTRY stub_source3f_ (ALuint source, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3) {
+    (void) source;
+    (void) param;
+    (void) value1;
+    (void) value2;
+    (void) value3;
+}
+static void AL_APIENTRY stub_sourcei_ (ALuint source, ALenum param, ALint value) {
+    (void) source;
+    if(param == AL_BUFFER && value == 0) detached_++;
+}
+
+static void check_ (int condition, const char* what) {
+    if(condition) return;
+    printf("failed: %s\n", what);
+    failures_++;
+}
+
+int main (void) {
+    aladSourceCache cache;
+    aladSourcePool* pool;
+    ALuint sources[4];
+    ALuint source;
+    int i, distinct = 1;
+
+    memset(&cache, 0, sizeof(cache));
+    aladAL.GetError = stub_get_error_;
+    aladAL.GenSources = stub_gen_sources_;
+    aladAL.DeleteSources = stub_delete_sources_;
+    aladAL.SourceStopv = stub_source_stopv_;
+    aladAL.Sourcef = stub_sourcef_;
+    aladAL.Source3f = stub_source3f_;
+    aladAL.Sourcei = stub_sourcei_;
+
+    pool = aladCreateSourcePool(4);
+    check_(pool != NULL, "a pool is created");
+    if(pool == NULL) return 1;
+
+    for(i = 0; i < 4; i++) sources[i] = aladAcquireSource(pool, NULL);
+    for(i = 0; i < 4; i++) distinct = distinct && sources[i] >= 10 && sources[i] < 14 && (i == 0 || sources[i] != sources[i - 1]);
+    check_(distinct, "the pool hands out each of its sources");
+    check_(aladAcquireSource(pool, NULL) == 0, "an empty pool hands out 0");
+
+    aladReleaseSource(pool, sources[1]);
+    aladReleaseSource(pool, sources[1]);
+    aladReleaseSource(pool, 99);
+    check_(aladAcquireSource(pool, NULL) == 0, "a released source isn't handed out before it is recycled");
+    check_(aladRecycleSources(pool) == 1, "releasing a source twice recycles it once");
+    check_(stopped_ == 1 && detached_ == 1, "a recycled source is stopped and its buffer detached");
+    check_(aladRecycleSources(pool) == 0, "there is nothing left to recycle");
+    check_(aladAcquireSource(pool, NULL) == sources[1], "a recycled source is handed out again");
+    check_(aladAcquireSource(pool, NULL) == 0, "and only once");
+
+    for(i = 0; i < 4; i++) aladReleaseSource(pool, sources[i]);
+    check_(aladRecycleSources(pool) == 4, "all released sources are recycled at once");
+    source = aladAcquireSource(pool, &cache);
+    check_(source != 0 && cache.count == (ALAD_SOURCE_CACHE_SIZE / 2 < 4 ? ALAD_SOURCE_CACHE_SIZE / 2 : 4) - 1, "a cache takes half of its size at a time");
+    check_(aladAcquireSource(pool, NULL) == 0, "the sources in a cache aren't in the pool");
+    aladFlushSourceCache(pool, &cache);
+    check_(cache.count == 0, "flushing empties the cache");
+    for(i = 0; i < 3; i++) check_(aladAcquireSource(pool, NULL) != 0, "flushing returns the cached sources to the pool");
+    check_(aladAcquireSource(pool, NULL) == 0, "but not the one acquired through the cache");
+
+    aladDestroySourcePool(pool);
+    check_(deleted_ == 4, "destroying the pool deletes all of its sources");
+    if(failures_ == 0) printf("all checks passed\n");
+    return failures_ != 0 ? 1 : 0;
+}
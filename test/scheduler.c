@@ -0,0 +1,129 @@
+/*
+ *  scheduler.c: checks the order and grouping in which aladUpdateScheduler sends the starts and stops of alad-utils.h, against
+ *  stand-ins for the driver functions and a device clock the program sets instead of an OpenAL implementation.
+ *
+ *  Build and run it with
+ *
+ *      cc -I[path to the AL headers] -o scheduler scheduler.c -ldl
+ *      ./scheduler
+ *
+ *  The program prints the failed checks and exits with 1 if there are any.
+ */
+
+#define ALAD_IMPLEMENTATION
+#define ALAD_UTILS_IMPLEMENTATION
+#include "../alad.h"
+#include "../alad-utils.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* one driver call: which function, the time of a timed start and the sources */
+typedef struct call_ {
+    ALenum      action;
+    ALint64SOFT time;
+    ALsizei     n;
+    ALuint      sources[8];
+} call_;
+
+static char         device_;
+static ALint64SOFT  clock_ = 0;
+static ALboolean    deviceClock_ = AL_TRUE;
+static call_        calls_[16];
+static int          callCount_ = 0;
+static int          failures_ = 0;
+
+static ALCboolean ALC_APIENTRY stub_is_extension_present_ (ALCdevice* device, const ALCchar* extname) {
+    (void) device;
+    return deviceClock_ && strcmp(extname, "ALC_SOFT_device_clock") == 0 ? ALC_TRUE : ALC_FALSE;
+}
+static void ALC_APIENTRY stub_get_integer64v_ (ALCdevice* device, ALCenum pname, ALCsizei size, ALCint64SOFT* values) {
+    (void) device;
+    if(pname == ALC_DEVICE_CLOCK_SOFT && size >= 1) values[0] = (ALCint64SOFT) clock_;
+}
+static void record_ (ALenum action, ALint64SOFT time, ALsizei n, const ALuint* sources) {
+    call_* call;
+    if(callCount_ == 16 || n > 8) return;
+    call = &calls_[callCount_++];
+    call->action = action;
+    call->time = time;
+    call->n = n;
+    memcpy(call->sources, sources, (size_t) n * sizeof(ALuint));
+}
+static void AL_APIENTRY stub_source_play_at_timev_ (ALsizei n, const ALuint* sources, ALint64SOFT start_time) {
+    record_(AL_PLAYING, start_time, n, sources);
+}
+static void AL_APIENTRY stub_source_playv_ (ALsizei n, const ALuint* sources) {
+    record_(AL_PLAYING, -1, n, sources);
+}
+static void AL_APIENTRY stub_source_stopv_ (ALsizei n, const ALuint* sources) {
+    record_(AL_STOPPED, -1, n, sources);
+}
+
+static int is_call_ (int i, ALenum action, ALint64SOFT time, ALsizei n, const ALuint* sources) {
+    return i < callCount_ && calls_[i].action == action && calls_[i].time == time && calls_[i].n == n
+        && memcmp(calls_[i].sources, sources, (size_t) n * sizeof(ALuint)) == 0;
+}
+static void check_ (int condition, const char* what) {
+    if(condition) return;
+    printf("failed: %s\n", what);
+    failures_++;
+}
+
+int main (void) {
+    ALCdevice* device = (ALCdevice*) &device_;
+    aladScheduler* scheduler;
+    const ALuint together[3] = { 3, 1, 2 };
+    const ALuint first[1] = { 4 };
+    const ALuint second[1] = { 5 };
+    const ALuint held[1] = { 6 };
+    const ALuint other[1] = { 7 };
+
+    aladALC.IsExtensionPresent = stub_is_extension_present_;
+    aladALC.GetInteger64vSOFT = stub_get_integer64v_;
+    aladAL.SourcePlayAtTimevSOFT = stub_source_play_at_timev_;
+    aladAL.SourcePlayv = stub_source_playv_;
+    aladAL.SourceStopv = stub_source_stopv_;
+
+    scheduler = aladCreateScheduler(device, 1);
+    check_(scheduler != NULL, "a scheduler is created on the device clock");
+    if(scheduler == NULL) return 1;
+    check_(aladGetSchedulerTime(scheduler) == 0, "its time is the device clock");
+
+    aladSchedulePlay(scheduler, 5, 150);
+    aladSchedulePlay(scheduler, 3, 100);
+    aladSchedulePlay(scheduler, 1, 100);
+    aladSchedulePlay(scheduler, 4, 120);
+    aladSchedulePlay(scheduler, 2, 100);
+    check_(aladUpdateScheduler(scheduler, 50) == 0, "nothing is sent before the window reaches it");
+    check_(aladUpdateScheduler(scheduler, 200) == 5, "all starts in the window are sent");
+    check_(callCount_ == 3, "starts of the same time go out together");
+    check_(is_call_(0, AL_PLAYING, 100, 3, together), "starts of the same time keep the order they were scheduled in");
+    check_(is_call_(1, AL_PLAYING, 120, 1, first) && is_call_(2, AL_PLAYING, 150, 1, second), "the other starts follow by time");
+
+    callCount_ = 0;
+    aladScheduleStop(scheduler, 6, 50);
+    aladSchedulePlay(scheduler, 6, 80);
+    aladSchedulePlay(scheduler, 7, 80);
+    check_(aladUpdateScheduler(scheduler, 100) == 1, "a stop that isn't due holds back the start of its source");
+    check_(callCount_ == 1 && is_call_(0, AL_PLAYING, 80, 1, other), "only the start of the other source is sent");
+    clock_ = 60;
+    check_(aladUpdateScheduler(scheduler, 100) == 2, "the held back events are sent once the stop is due");
+    check_(callCount_ == 3 && is_call_(1, AL_STOPPED, -1, 1, held) && is_call_(2, AL_PLAYING, 80, 1, held), "the stop goes out before the start");
+    check_(aladUpdateScheduler(scheduler, 1000) == 0, "nothing is left");
+    aladDestroyScheduler(scheduler);
+
+    callCount_ = 0;
+    deviceClock_ = AL_FALSE;
+    scheduler = aladCreateScheduler(device, 1);
+    check_(scheduler != NULL, "a scheduler is created on the system clock");
+    if(scheduler == NULL) return 1;
+    aladSchedulePlay(scheduler, 3, 0);
+    aladSchedulePlay(scheduler, 1, 0);
+    aladSchedulePlay(scheduler, 2, 0);
+    check_(aladUpdateScheduler(scheduler, 0) == 3 && callCount_ == 1 && is_call_(0, AL_PLAYING, -1, 3, together), "due starts without a start time go out with one alSourcePlayv");
+    aladDestroyScheduler(scheduler);
+
+    if(failures_ == 0) printf("all checks passed\n");
+    return failures_ != 0 ? 1 : 0;
+}